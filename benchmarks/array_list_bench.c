@@ -0,0 +1,598 @@
+/**
+ * @file array_list_bench.c
+ * @brief Benchmark file for array_list.c
+ * @author Jonathan E
+ * @date 17-10-2026
+ * 
+ * This file contains the benchmarks for array_list.c.
+ * By running this file, you can compare the functions in array_list.c against
+ * the straightforward implementations they replace, with the timings outputted
+ * to the console.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+#include "../src/array_list/array_list.h"
+
+/**
+ * Gets the current time from a monotonic clock.
+ * 
+ * @return The current time in seconds.
+*/
+double bench_now() {
+  struct timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return (double) time.tv_sec + (double) time.tv_nsec / 1e9;
+}
+
+/**
+ * Prints a single benchmark result, comparing the time taken by the array
+ * list against the time taken by the baseline.
+ * 
+ * @param const char* The name of the benchmark.
+ * @param double      The time taken by the baseline, in seconds.
+ * @param double      The time taken by the array list, in seconds.
+*/
+void bench_report(const char* name, double baseline, double result) {
+  printf("\t%-48s baseline %10.3f ms   ArrayList %10.3f ms   %6.2fx\n", name, baseline * 1e3, result * 1e3, baseline / result);
+}
+
+/**
+ * The search loop ArrayList_indexOf() used before it was vectorised.
+ * 
+ * @param ArrayList* The array list to search.
+ * @param void*      The data to search for.
+ * @return The index of the data, or ARRAY_LIST_NPOS if it is not found.
+*/
+size_t baseline_indexOf(ArrayList* list, void* data) {
+  for (size_t i = 0; i < list->size; i++) {
+    if (list->collection[i] == data) {
+      return i;
+    }
+  }
+  return ARRAY_LIST_NPOS;
+}
+
+/**
+ * Benchmarks ArrayList_indexOf() on a list of the given size, searching for
+ * an element that is not in the list so the whole collection is scanned.
+ * 
+ * @param size_t The number of elements in the list.
+*/
+void bench_ArrayList_indexOf(size_t size) {
+  ArrayList* list = new_ArrayListWithCapacity(size);
+  int* elements = malloc(sizeof(int) * size);
+  if (list == NULL || elements == NULL) {
+    printf("\tallocation failed\n");
+    exit(1);
+  }
+
+  for (size_t i = 0; i < size; i++) {
+    ArrayList_add(list, &elements[i]);
+  }
+
+  // Repeat the search so every size scans roughly the same number of pointers.
+  size_t repeats = 100000000 / size;
+  int missing = 0;
+  volatile size_t sink = 0;
+
+  double start = bench_now();
+  for (size_t i = 0; i < repeats; i++) {
+    sink += baseline_indexOf(list, &missing);
+  }
+  double baseline = bench_now() - start;
+
+  start = bench_now();
+  for (size_t i = 0; i < repeats; i++) {
+    sink += ArrayList_indexOf(list, &missing);
+  }
+  double result = bench_now() - start;
+
+  char name[64];
+  snprintf(name, sizeof(name), "ArrayList_indexOf() with %zu elements", size);
+  bench_report(name, baseline, result);
+
+  free(elements);
+  ArrayList_free(list);
+}
+
+/**
+ * Compares two pointers to integers, for use as an ArrayList_Comparator.
+ * 
+ * @param const void* The first integer.
+ * @param const void* The second integer.
+ * @return A negative number, zero or a positive number if the first integer
+ *         is less than, equal to or greater than the second.
+*/
+int compare_int(const void* a, const void* b) {
+  int x = *(const int*) a;
+  int y = *(const int*) b;
+  return (x > y) - (x < y);
+}
+
+/**
+ * Compares two slots of a collection of pointers to integers, for use with
+ * qsort().
+ * 
+ * @param const void* The first slot.
+ * @param const void* The second slot.
+ * @return The result of comparing the integers the slots point to.
+*/
+int baseline_compare_int(const void* a, const void* b) {
+  return compare_int(*(void* const*) a, *(void* const*) b);
+}
+
+/**
+ * Benchmarks ArrayList_sort() on a list of the given size holding pointers to
+ * random integers, against sorting the same collection with qsort().
+ * 
+ * @param size_t The number of elements in the list.
+*/
+void bench_ArrayList_sort(size_t size) {
+  ArrayList* list = new_ArrayListWithCapacity(size);
+  int* elements = malloc(sizeof(int) * size);
+  void** input = malloc(sizeof(void*) * size);
+  if (list == NULL || elements == NULL || input == NULL) {
+    printf("\tallocation failed\n");
+    exit(1);
+  }
+
+  srand(1);
+  for (size_t i = 0; i < size; i++) {
+    elements[i] = rand();
+    input[i] = &elements[i];
+  }
+
+  // Repeat short sorts so every size sorts roughly the same number of elements.
+  size_t repeats = size < 10000000 ? 10000000 / size : 1;
+
+  double start = bench_now();
+  for (size_t i = 0; i < repeats; i++) {
+    memcpy(list->collection, input, sizeof(void*) * size);
+    list->size = size;
+    qsort(list->collection, size, sizeof(void*), baseline_compare_int);
+  }
+  double baseline = bench_now() - start;
+
+  start = bench_now();
+  for (size_t i = 0; i < repeats; i++) {
+    memcpy(list->collection, input, sizeof(void*) * size);
+    list->size = size;
+    ArrayList_sort(list, compare_int);
+  }
+  double result = bench_now() - start;
+
+  char name[64];
+  snprintf(name, sizeof(name), "ArrayList_sort() with %zu elements", size);
+  bench_report(name, baseline, result);
+
+  free(input);
+  free(elements);
+  ArrayList_free(list);
+}
+
+/**
+ * Benchmarks scanning an array list of values against scanning an array list
+ * of pointers to the same values, each in its own heap allocation. The heap
+ * allocations are shuffled, as they would be after a program has been running
+ * for a while, so the pointer list misses the cache on most elements.
+ * 
+ * @param size_t The number of elements in the list.
+*/
+void bench_ArrayList_valueScan(size_t size) {
+  ArrayList* pointers = new_ArrayListWithCapacity(size);
+  ArrayList* values = new_ArrayListOfWithCapacity(sizeof(int), size);
+  int** elements = malloc(sizeof(int*) * size);
+  if (pointers == NULL || values == NULL || elements == NULL) {
+    printf("\tallocation failed\n");
+    exit(1);
+  }
+
+  srand(2);
+  for (size_t i = 0; i < size; i++) {
+    elements[i] = malloc(sizeof(int));
+    if (elements[i] == NULL) {
+      printf("\tallocation failed\n");
+      exit(1);
+    }
+    *elements[i] = rand();
+  }
+  for (size_t i = size - 1; i > 0; i--) {
+    size_t j = (size_t) rand() % (i + 1);
+    int* temp = elements[i];
+    elements[i] = elements[j];
+    elements[j] = temp;
+  }
+  for (size_t i = 0; i < size; i++) {
+    ArrayList_add(pointers, elements[i]);
+    ArrayList_add(values, elements[i]);
+  }
+
+  // Repeat the scan so every size reads roughly the same number of elements.
+  size_t repeats = size < 100000000 ? 100000000 / size : 1;
+  volatile long sink = 0;
+
+  double start = bench_now();
+  for (size_t r = 0; r < repeats; r++) {
+    long sum = 0;
+    for (size_t i = 0; i < size; i++) {
+      sum += *(int*) ArrayList_get(pointers, i);
+    }
+    sink += sum;
+  }
+  double baseline = bench_now() - start;
+
+  start = bench_now();
+  for (size_t r = 0; r < repeats; r++) {
+    long sum = 0;
+    for (size_t i = 0; i < size; i++) {
+      sum += *(int*) ArrayList_get(values, i);
+    }
+    sink += sum;
+  }
+  double result = bench_now() - start;
+
+  char name[64];
+  snprintf(name, sizeof(name), "value scan with %zu elements", size);
+  bench_report(name, baseline, result);
+
+  for (size_t i = 0; i < size; i++) {
+    free(elements[i]);
+  }
+  free(elements);
+  ArrayList_free(values);
+  ArrayList_free(pointers);
+}
+
+/**
+ * Benchmarks creating many short lived lists of a few elements on the stack
+ * with ArrayList_init(), against creating them on the heap with new_ArrayList().
+ * 
+ * @param size_t The number of elements added to each list.
+*/
+void bench_ArrayList_init(size_t size) {
+  int element = 0;
+  size_t repeats = 10000000;
+  volatile size_t sink = 0;
+
+  double start = bench_now();
+  for (size_t r = 0; r < repeats; r++) {
+    ArrayList* list = new_ArrayList();
+    for (size_t i = 0; i < size; i++) {
+      ArrayList_add(list, &element);
+    }
+    sink += ArrayList_size(list);
+    ArrayList_free(list);
+  }
+  double baseline = bench_now() - start;
+
+  start = bench_now();
+  for (size_t r = 0; r < repeats; r++) {
+    ArrayList list;
+    ArrayList_init(&list);
+    for (size_t i = 0; i < size; i++) {
+      ArrayList_add(&list, &element);
+    }
+    sink += ArrayList_size(&list);
+    ArrayList_deinit(&list);
+  }
+  double result = bench_now() - start;
+
+  char name[64];
+  snprintf(name, sizeof(name), "ArrayList_init() with %zu elements", size);
+  bench_report(name, baseline, result);
+}
+
+/**
+ * Gets the longest time a single ArrayList_add() takes while adding the given
+ * number of elements to an empty array list.
+ * 
+ * @param size_t The number of elements to add.
+ * @param bool   true to add them in incremental resize mode.
+ * @return The time taken by the slowest add, in seconds.
+*/
+double bench_slowestAdd(size_t size, bool incremental) {
+  ArrayList* list = new_ArrayList();
+  if (list == NULL) {
+    printf("\tallocation failed\n");
+    exit(1);
+  }
+  ArrayList_setIncrementalResize(list, incremental);
+
+  int element = 0;
+  double slowest = 0;
+  for (size_t i = 0; i < size; i++) {
+    double start = bench_now();
+    ArrayList_add(list, &element);
+    double taken = bench_now() - start;
+    if (taken > slowest) {
+      slowest = taken;
+    }
+  }
+
+  ArrayList_free(list);
+  return slowest;
+}
+
+/**
+ * Benchmarks the slowest single ArrayList_add() when growing a list to the
+ * given size, with the collection resized all at once against incrementally.
+ * 
+ * @param size_t The number of elements to add.
+*/
+void bench_ArrayList_incrementalResize(size_t size) {
+  double baseline = bench_slowestAdd(size, false);
+  double result = bench_slowestAdd(size, true);
+
+  char name[64];
+  snprintf(name, sizeof(name), "slowest add() to %zu, incremental", size);
+  bench_report(name, baseline, result);
+}
+
+/**
+ * Benchmarks typing elements into the middle of a list one at a time, with
+ * ArrayList_insert() keeping a gap at the cursor, against inserting each one
+ * with ArrayList_insertRange(), which shifts the rest of the list every time.
+ * 
+ * @param size_t The number of elements in the list before typing starts.
+*/
+void bench_ArrayList_insert(size_t size) {
+  size_t typed = 10000;
+  int element = 0;
+  void* item = &element;
+
+  ArrayList* list = new_ArrayListWithCapacity(size + typed);
+  if (list == NULL) {
+    printf("\tallocation failed\n");
+    exit(1);
+  }
+  for (size_t i = 0; i < size; i++) {
+    ArrayList_add(list, &element);
+  }
+
+  double start = bench_now();
+  for (size_t i = 0; i < typed; i++) {
+    ArrayList_insertRange(list, size / 2 + i, &item, 1);
+  }
+  double baseline = bench_now() - start;
+
+  ArrayList_removeRange(list, size / 2, size / 2 + typed);
+  start = bench_now();
+  for (size_t i = 0; i < typed; i++) {
+    ArrayList_insert(list, size / 2 + i, item);
+  }
+  double result = bench_now() - start;
+
+  char name[64];
+  snprintf(name, sizeof(name), "ArrayList_insert() typing into %zu", size);
+  bench_report(name, baseline, result);
+  ArrayList_free(list);
+}
+
+/**
+ * Benchmarks removing a batch of scattered elements from an array list of the
+ * given size, one remove() at a time from the back against marking them with
+ * ArrayList_markRemoved() and squeezing them out with one ArrayList_compact().
+ *
+ * @param size_t The number of elements in the list.
+ * @param size_t The number of elements to remove.
+*/
+void bench_ArrayList_markRemoved(size_t size, size_t count) {
+  ArrayList* list = new_ArrayListOfWithCapacity(sizeof(size_t), size);
+  if (list == NULL) {
+    printf("\tallocation failed\n");
+    exit(1);
+  }
+  for (size_t i = 0; i < size; i++) {
+    ArrayList_add(list, &i);
+  }
+
+  size_t stride = size / count;
+  double start = bench_now();
+  for (size_t i = count; i > 0; i--) {
+    ArrayList_remove(list, (i - 1) * stride);
+  }
+  double baseline = bench_now() - start;
+
+  ArrayList_clear(list);
+  ArrayList_reserve(list, size);
+  for (size_t i = 0; i < size; i++) {
+    ArrayList_add(list, &i);
+  }
+  start = bench_now();
+  for (size_t i = 0; i < count; i++) {
+    ArrayList_markRemoved(list, i * stride);
+  }
+  ArrayList_compact(list);
+  double result = bench_now() - start;
+
+  char name[64];
+  snprintf(name, sizeof(name), "markRemoved() %zu of %zu", count, size);
+  bench_report(name, baseline, result);
+  ArrayList_free(list);
+}
+
+/**
+ * Adds the value an element points to onto the total the context points to.
+ *
+ * @param void* The element.
+ * @param void* The total.
+*/
+void bench_sum(void* element, void* context) {
+  *(size_t*) context += *(size_t*) element;
+}
+
+/**
+ * Benchmarks summing an array list of values of the given size with a loop
+ * over ArrayList_get() against ArrayList_forEach().
+ *
+ * @param size_t The number of elements in the list.
+*/
+void bench_ArrayList_forEach(size_t size) {
+  ArrayList* list = new_ArrayListOfWithCapacity(sizeof(size_t), size);
+  if (list == NULL) {
+    printf("\tallocation failed\n");
+    exit(1);
+  }
+  for (size_t i = 0; i < size; i++) {
+    ArrayList_add(list, &i);
+  }
+
+  size_t expected = 0;
+  double start = bench_now();
+  for (size_t i = 0; i < size; i++) {
+    expected += *(size_t*) ArrayList_get(list, i);
+  }
+  double baseline = bench_now() - start;
+
+  size_t total = 0;
+  start = bench_now();
+  ArrayList_forEach(list, bench_sum, &total);
+  double result = bench_now() - start;
+
+  if (total != expected) {
+    printf("\tforEach() gave the wrong total\n");
+    exit(1);
+  }
+
+  char name[64];
+  snprintf(name, sizeof(name), "ArrayList_forEach() over %zu values", size);
+  bench_report(name, baseline, result);
+  ArrayList_free(list);
+}
+
+/**
+ * Benchmarks keeping an array list free of duplicates by calling
+ * ArrayList_contains() before every add, against adding everything and
+ * calling ArrayList_unique() once.
+ *
+ * @param size_t The number of elements to add, a quarter of which are
+ *               duplicates.
+*/
+void bench_ArrayList_unique(size_t size) {
+  int* data = malloc(sizeof(int) * size);
+  ArrayList* list = new_ArrayList();
+  ArrayList* deduplicated = new_ArrayList();
+  if (data == NULL || list == NULL || deduplicated == NULL) {
+    printf("\tallocation failed\n");
+    exit(1);
+  }
+
+  double start = bench_now();
+  for (size_t i = 0; i < size; i++) {
+    void* element = &data[i / 4 * 3 + i % 4 % 3];
+    if (!ArrayList_contains(list, element)) {
+      ArrayList_add(list, element);
+    }
+  }
+  double baseline = bench_now() - start;
+
+  start = bench_now();
+  for (size_t i = 0; i < size; i++) {
+    ArrayList_add(deduplicated, &data[i / 4 * 3 + i % 4 % 3]);
+  }
+  ArrayList_unique(deduplicated);
+  double result = bench_now() - start;
+
+  if (ArrayList_size(list) != ArrayList_size(deduplicated)) {
+    printf("\tunique() kept the wrong number of elements\n");
+    exit(1);
+  }
+
+  char name[64];
+  snprintf(name, sizeof(name), "ArrayList_unique() of %zu", size);
+  bench_report(name, baseline, result);
+  ArrayList_free(deduplicated);
+  ArrayList_free(list);
+  free(data);
+}
+
+/**
+ * Benchmarks looking up every tenth element of an array list of the given
+ * size with ArrayList_indexOf(), scanning against the side index turned on by
+ * ArrayList_setIndexed(), including the time to build it.
+ *
+ * @param size_t The number of elements in the list.
+*/
+void bench_ArrayList_setIndexed(size_t size) {
+  int* data = malloc(sizeof(int) * size);
+  ArrayList* list = new_ArrayListWithCapacity(size);
+  if (data == NULL || list == NULL) {
+    printf("\tallocation failed\n");
+    exit(1);
+  }
+  for (size_t i = 0; i < size; i++) {
+    ArrayList_add(list, &data[i]);
+  }
+
+  size_t found = 0;
+  double start = bench_now();
+  for (size_t i = 0; i < size; i += 10) {
+    found += ArrayList_indexOf(list, &data[i]) == i;
+  }
+  double baseline = bench_now() - start;
+
+  ArrayList_setIndexed(list, true);
+  start = bench_now();
+  for (size_t i = 0; i < size; i += 10) {
+    found += ArrayList_indexOf(list, &data[i]) == i;
+  }
+  double result = bench_now() - start;
+
+  if (found != (size + 9) / 10 * 2) {
+    printf("\tindexOf() gave the wrong index\n");
+    exit(1);
+  }
+
+  char name[64];
+  snprintf(name, sizeof(name), "ArrayList_setIndexed() indexOf() over %zu", size);
+  bench_report(name, baseline, result);
+  ArrayList_free(list);
+  free(data);
+}
+
+/**
+ * Main function used to run the benchmarks.
+ * The largest list sorted can be given as the first argument, which defaults
+ * to 10 million elements.
+*/
+int main(int argc, char** argv) {
+  printf("Running benchmarks for ArrayList.h (search: %s)...\n", ArrayList_searchImplementation());
+
+  bench_ArrayList_indexOf(1000);
+  bench_ArrayList_indexOf(100000);
+  bench_ArrayList_indexOf(1000000);
+
+  bench_ArrayList_valueScan(1000);
+  bench_ArrayList_valueScan(1000000);
+
+  bench_ArrayList_init(3);
+
+  bench_ArrayList_insert(100000);
+  bench_ArrayList_insert(1000000);
+
+  bench_ArrayList_forEach(1000000);
+
+  bench_ArrayList_setIndexed(10000);
+  bench_ArrayList_setIndexed(100000);
+
+  bench_ArrayList_unique(10000);
+  bench_ArrayList_unique(100000);
+
+  bench_ArrayList_markRemoved(100000, 1000);
+  bench_ArrayList_markRemoved(1000000, 1000);
+
+  bench_ArrayList_incrementalResize(1000000);
+  bench_ArrayList_incrementalResize(10000000);
+
+  size_t max_size = argc > 1 ? strtoull(argv[1], NULL, 10) : 10000000;
+  for (size_t size = 1000; size <= max_size; size *= 10) {
+    bench_ArrayList_sort(size);
+  }
+
+  printf("Benchmarks complete.\n");
+}
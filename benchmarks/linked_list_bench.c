@@ -0,0 +1,148 @@
+/**
+ * @file linked_list_bench.c
+ * @brief Benchmark file for linked_list.c
+ * @author Jonathan E
+ * @date 17-10-2026
+ *
+ * This file contains the benchmarks for linked_list.c.
+ * By running this file, you can compare walking a linked list by index from
+ * the head against walking it by index from the finger, and with a cursor,
+ * with the timings outputted to the console.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "../src/linked_list/linked_list.h"
+
+/**
+ * Gets the current time from a monotonic clock.
+ *
+ * @return The current time in seconds.
+*/
+double bench_now() {
+  struct timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return (double) time.tv_sec + (double) time.tv_nsec / 1e9;
+}
+
+/**
+ * Prints a single benchmark result, comparing the time taken by the new
+ * approach against the time taken by the baseline.
+ *
+ * @param const char* The name of the benchmark.
+ * @param double      The time taken by the baseline, in seconds.
+ * @param double      The time taken by the new approach, in seconds.
+*/
+void bench_report(const char* name, double baseline, double result) {
+  printf("\t%-44s baseline %10.3f ms   LinkedList %10.3f ms   %8.2fx\n", name, baseline * 1e3, result * 1e3, baseline / result);
+}
+
+/**
+ * Benchmarks summing a linked list of the given size with a loop over
+ * LinkedList_get() against a loop with a LinkedListCursor. With the finger
+ * both are O(n), so this measures the cost of the calls rather than the walks.
+ *
+ * @param size_t The number of elements in the list.
+*/
+void bench_LinkedList_cursor(size_t size) {
+  int* data = malloc(sizeof(int) * size);
+  LinkedList* list = new_LinkedList();
+  if (data == NULL || list == NULL) {
+    printf("\tallocation failed\n");
+    exit(1);
+  }
+  for (size_t i = 0; i < size; i++) {
+    data[i] = (int) i;
+    LinkedList_add(list, &data[i]);
+  }
+
+  long expected = 0;
+  double start = bench_now();
+  for (size_t i = 0; i < size; i++) {
+    expected += *(int*) LinkedList_get(list, i);
+  }
+  double baseline = bench_now() - start;
+
+  long total = 0;
+  start = bench_now();
+  for (LinkedListCursor cursor = LinkedList_begin(list); !LinkedListCursor_atEnd(&cursor); LinkedListCursor_next(&cursor)) {
+    total += *(int*) LinkedListCursor_get(&cursor);
+  }
+  double result = bench_now() - start;
+
+  if (total != expected) {
+    printf("\tthe cursor gave the wrong total\n");
+    exit(1);
+  }
+
+  char name[64];
+  snprintf(name, sizeof(name), "cursor walk over %zu", size);
+  bench_report(name, baseline, result);
+  LinkedList_free(list);
+  free(data);
+}
+
+/**
+ * Benchmarks summing a linked list of the given size with a loop over
+ * LinkedList_get(), first with the finger dropped before every call so each
+ * walk starts from the head, then with the finger left in place.
+ *
+ * @param size_t The number of elements in the list.
+*/
+void bench_LinkedList_finger(size_t size) {
+  int* data = malloc(sizeof(int) * size);
+  LinkedList* list = new_LinkedList();
+  if (data == NULL || list == NULL) {
+    printf("\tallocation failed\n");
+    exit(1);
+  }
+  for (size_t i = 0; i < size; i++) {
+    data[i] = (int) i;
+    LinkedList_add(list, &data[i]);
+  }
+
+  long expected = 0;
+  double start = bench_now();
+  for (size_t i = 0; i < size; i++) {
+    list->finger = NULL;
+    expected += *(int*) LinkedList_get(list, i);
+  }
+  double baseline = bench_now() - start;
+
+  long total = 0;
+  start = bench_now();
+  for (size_t i = 0; i < size; i++) {
+    total += *(int*) LinkedList_get(list, i);
+  }
+  double result = bench_now() - start;
+
+  if (total != expected) {
+    printf("\tthe finger gave the wrong total\n");
+    exit(1);
+  }
+
+  char name[64];
+  snprintf(name, sizeof(name), "get() loop with finger over %zu", size);
+  bench_report(name, baseline, result);
+  LinkedList_free(list);
+  free(data);
+}
+
+/**
+ * Main function used to run the benchmarks. The largest list walked can be
+ * given as the first argument.
+*/
+int main(int argc, char** argv) {
+  printf("Running benchmarks for LinkedList.h...\n");
+
+  size_t max_size = argc > 1 ? strtoull(argv[1], NULL, 10) : 10000;
+  for (size_t size = 1000; size <= max_size; size *= 10) {
+    bench_LinkedList_finger(size);
+    bench_LinkedList_cursor(size);
+  }
+
+  printf("Benchmarks complete.\n");
+}
@@ -0,0 +1,105 @@
+/**
+ * @file segmented_list_bench.c
+ * @brief Benchmark file for segmented_list.c
+ * @author Jonathan E
+ * @date 17-10-2026
+ *
+ * This file contains the benchmarks for segmented_list.c.
+ * By running this file, you can compare appending to a segmented list against
+ * appending to an array list, with the timings outputted to the console.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "../src/array_list/array_list.h"
+#include "../src/segmented_list/segmented_list.h"
+
+/**
+ * Gets the current time from a monotonic clock.
+ *
+ * @return The current time in seconds.
+*/
+double bench_now() {
+  struct timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return (double) time.tv_sec + (double) time.tv_nsec / 1e9;
+}
+
+/**
+ * Prints a single benchmark result, comparing the time taken by the segmented
+ * list against the time taken by the array list.
+ *
+ * @param const char* The name of the benchmark.
+ * @param double      The time taken by the array list, in seconds.
+ * @param double      The time taken by the segmented list, in seconds.
+*/
+void bench_report(const char* name, double baseline, double result) {
+  printf("\t%-44s ArrayList %10.3f ms   SegmentedList %10.3f ms   %6.2fx\n", name, baseline * 1e3, result * 1e3, baseline / result);
+}
+
+/**
+ * Benchmarks appending the given number of values to an array list and to a
+ * segmented list of values, reporting both the total time and the slowest
+ * single append, which is where the array list copies its whole collection.
+ *
+ * @param size_t The number of values to append.
+*/
+void bench_SegmentedList_add(size_t size) {
+  ArrayList* array = new_ArrayListOf(sizeof(size_t));
+  SegmentedList* segmented = new_SegmentedListOf(sizeof(size_t));
+  if (array == NULL || segmented == NULL) {
+    printf("\tallocation failed\n");
+    exit(1);
+  }
+
+  double array_worst = 0;
+  double start = bench_now();
+  for (size_t i = 0; i < size; i++) {
+    double before = bench_now();
+    ArrayList_add(array, &i);
+    double taken = bench_now() - before;
+    if (taken > array_worst) {
+      array_worst = taken;
+    }
+  }
+  double array_total = bench_now() - start;
+
+  double segmented_worst = 0;
+  start = bench_now();
+  for (size_t i = 0; i < size; i++) {
+    double before = bench_now();
+    SegmentedList_add(segmented, &i);
+    double taken = bench_now() - before;
+    if (taken > segmented_worst) {
+      segmented_worst = taken;
+    }
+  }
+  double segmented_total = bench_now() - start;
+
+  char name[64];
+  snprintf(name, sizeof(name), "add() total, %zu values", size);
+  bench_report(name, array_total, segmented_total);
+  snprintf(name, sizeof(name), "add() slowest single call, %zu values", size);
+  bench_report(name, array_worst, segmented_worst);
+
+  SegmentedList_free(segmented);
+  ArrayList_free(array);
+}
+
+/**
+ * Main function used to run the benchmarks. The largest number of values to
+ * append can be given as the first argument.
+*/
+int main(int argc, char** argv) {
+  printf("Running benchmarks for SegmentedList.h...\n");
+
+  size_t max_size = argc > 1 ? strtoull(argv[1], NULL, 10) : 10000000;
+  for (size_t size = 10000; size <= max_size; size *= 10) {
+    bench_SegmentedList_add(size);
+  }
+
+  printf("Benchmarks complete.\n");
+}
@@ -0,0 +1,132 @@
+/**
+ * @file skip_list_bench.c
+ * @brief Benchmark file for skip_list.c
+ * @author Jonathan E
+ * @date 17-10-2026
+ *
+ * This file contains the benchmarks for skip_list.c.
+ * By running this file, you can compare getting and removing elements at
+ * random indices of a skip list against a linked list, with the timings
+ * outputted to the console.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "../src/linked_list/linked_list.h"
+#include "../src/skip_list/skip_list.h"
+
+/**
+ * The number of random gets and removes timed for each size.
+*/
+#define BENCH_OPERATIONS 1000
+
+/**
+ * Gets the current time from a monotonic clock.
+ *
+ * @return The current time in seconds.
+*/
+double bench_now() {
+  struct timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return (double) time.tv_sec + (double) time.tv_nsec / 1e9;
+}
+
+/**
+ * Prints a single benchmark result, comparing the time taken by the skip list
+ * against the time taken by the linked list.
+ *
+ * @param const char* The name of the benchmark.
+ * @param double      The time taken by the linked list, in seconds.
+ * @param double      The time taken by the skip list, in seconds.
+*/
+void bench_report(const char* name, double baseline, double result) {
+  printf("\t%-44s LinkedList %10.3f ms   SkipList %10.3f ms   %8.2fx\n", name, baseline * 1e3, result * 1e3, baseline / result);
+}
+
+/**
+ * Benchmarks getting and then removing elements at the same random indices of
+ * a linked list and a skip list of the given size.
+ *
+ * @param size_t The number of elements in each list.
+*/
+void bench_SkipList_random(size_t size) {
+  int* data = malloc(sizeof(int) * size);
+  size_t* indices = malloc(sizeof(size_t) * BENCH_OPERATIONS);
+  LinkedList* linked = new_LinkedList();
+  SkipList* skip = new_SkipList();
+  if (data == NULL || indices == NULL || linked == NULL || skip == NULL) {
+    printf("\tallocation failed\n");
+    exit(1);
+  }
+  for (size_t i = 0; i < size; i++) {
+    data[i] = (int) i;
+    LinkedList_add(linked, &data[i]);
+    SkipList_add(skip, &data[i]);
+  }
+
+  // Pick indices that stay in bounds as the lists shrink.
+  srand(1);
+  for (size_t i = 0; i < BENCH_OPERATIONS; i++) {
+    indices[i] = (size_t) rand() % (size - i);
+  }
+
+  long expected = 0;
+  double start = bench_now();
+  for (size_t i = 0; i < BENCH_OPERATIONS; i++) {
+    expected += *(int*) LinkedList_get(linked, indices[i]);
+  }
+  double linked_get = bench_now() - start;
+
+  long total = 0;
+  start = bench_now();
+  for (size_t i = 0; i < BENCH_OPERATIONS; i++) {
+    total += *(int*) SkipList_get(skip, indices[i]);
+  }
+  double skip_get = bench_now() - start;
+
+  if (total != expected) {
+    printf("\tthe skip list gave the wrong total\n");
+    exit(1);
+  }
+
+  start = bench_now();
+  for (size_t i = 0; i < BENCH_OPERATIONS; i++) {
+    LinkedList_remove(linked, indices[i]);
+  }
+  double linked_remove = bench_now() - start;
+
+  start = bench_now();
+  for (size_t i = 0; i < BENCH_OPERATIONS; i++) {
+    SkipList_remove(skip, indices[i]);
+  }
+  double skip_remove = bench_now() - start;
+
+  char name[64];
+  snprintf(name, sizeof(name), "get() x%d, %zu elements", BENCH_OPERATIONS, size);
+  bench_report(name, linked_get, skip_get);
+  snprintf(name, sizeof(name), "remove() x%d, %zu elements", BENCH_OPERATIONS, size);
+  bench_report(name, linked_remove, skip_remove);
+
+  SkipList_free(skip);
+  LinkedList_free(linked);
+  free(indices);
+  free(data);
+}
+
+/**
+ * Main function used to run the benchmarks. The largest list can be given as
+ * the first argument.
+*/
+int main(int argc, char** argv) {
+  printf("Running benchmarks for SkipList.h...\n");
+
+  size_t max_size = argc > 1 ? strtoull(argv[1], NULL, 10) : 100000;
+  for (size_t size = 10000; size <= max_size; size *= 10) {
+    bench_SkipList_random(size);
+  }
+
+  printf("Benchmarks complete.\n");
+}
@@ -0,0 +1,113 @@
+/**
+ * @file unrolled_list_bench.c
+ * @brief Benchmark file for unrolled_list.c
+ * @author Jonathan E
+ * @date 17-10-2026
+ *
+ * This file contains the benchmarks for unrolled_list.c.
+ * By running this file, you can compare building and walking an unrolled list
+ * against a linked list, with the timings outputted to the console.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "../src/linked_list/linked_list.h"
+#include "../src/unrolled_list/unrolled_list.h"
+
+/**
+ * Gets the current time from a monotonic clock.
+ *
+ * @return The current time in seconds.
+*/
+double bench_now() {
+  struct timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return (double) time.tv_sec + (double) time.tv_nsec / 1e9;
+}
+
+/**
+ * Prints a single benchmark result, comparing the time taken by the unrolled
+ * list against the time taken by the linked list.
+ *
+ * @param const char* The name of the benchmark.
+ * @param double      The time taken by the linked list, in seconds.
+ * @param double      The time taken by the unrolled list, in seconds.
+*/
+void bench_report(const char* name, double baseline, double result) {
+  printf("\t%-44s LinkedList %10.3f ms   UnrolledList %10.3f ms   %6.2fx\n", name, baseline * 1e3, result * 1e3, baseline / result);
+}
+
+/**
+ * Benchmarks adding the given number of elements to a linked list and to an
+ * unrolled list, then searching each for an element it does not hold, which
+ * walks the whole list.
+ *
+ * @param size_t The number of elements to add.
+*/
+void bench_UnrolledList_walk(size_t size) {
+  int* data = malloc(sizeof(int) * size);
+  LinkedList* linked = new_LinkedList();
+  UnrolledList* unrolled = new_UnrolledList();
+  if (data == NULL || linked == NULL || unrolled == NULL) {
+    printf("\tallocation failed\n");
+    exit(1);
+  }
+
+  double start = bench_now();
+  for (size_t i = 0; i < size; i++) {
+    LinkedList_add(linked, &data[i]);
+  }
+  double linked_add = bench_now() - start;
+
+  start = bench_now();
+  for (size_t i = 0; i < size; i++) {
+    UnrolledList_add(unrolled, &data[i]);
+  }
+  double unrolled_add = bench_now() - start;
+
+  int missing = 0;
+  start = bench_now();
+  for (int i = 0; i < 10; i++) {
+    if (LinkedList_indexOf(linked, &missing) != LINKED_LIST_NPOS) {
+      exit(1);
+    }
+  }
+  double linked_walk = bench_now() - start;
+
+  start = bench_now();
+  for (int i = 0; i < 10; i++) {
+    if (UnrolledList_indexOf(unrolled, &missing) != UNROLLED_LIST_NPOS) {
+      exit(1);
+    }
+  }
+  double unrolled_walk = bench_now() - start;
+
+  char name[64];
+  snprintf(name, sizeof(name), "add(), %zu elements", size);
+  bench_report(name, linked_add, unrolled_add);
+  snprintf(name, sizeof(name), "indexOf() walk x10, %zu elements", size);
+  bench_report(name, linked_walk, unrolled_walk);
+  printf("\t%-44s LinkedList %10zu      UnrolledList %10zu\n", "node allocations", size, unrolled->node_count);
+
+  UnrolledList_free(unrolled);
+  LinkedList_free(linked);
+  free(data);
+}
+
+/**
+ * Main function used to run the benchmarks. The largest number of elements to
+ * add can be given as the first argument.
+*/
+int main(int argc, char** argv) {
+  printf("Running benchmarks for UnrolledList.h...\n");
+
+  size_t max_size = argc > 1 ? strtoull(argv[1], NULL, 10) : 1000000;
+  for (size_t size = 10000; size <= max_size; size *= 10) {
+    bench_UnrolledList_walk(size);
+  }
+
+  printf("Benchmarks complete.\n");
+}
@@ -12,84 +12,3409 @@
  * to the heap.
 */
 
+// mremap() is a GNU extension, so it has to be asked for before any header.
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
 #include "array_list.h"
 
+// Large collections are mapped with mmap() and grown with mremap() on Linux.
+#if defined(__linux__) && !defined(ARRAY_LIST_NO_MMAP)
+#define ARRAY_LIST_MMAP
+#endif
+
+// Array lists of values can be backed by a mapped file on Linux.
+#ifdef __linux__
+#define ARRAY_LIST_FILES
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// The magic number at the start of a file mapped by ArrayList_mapFile(), which
+// reads "CADTSAL1" on a little endian machine.
+#define ARRAY_LIST_FILE_MAGIC UINT64_C(0x314c415354444143)
+
+// The size of the header of a mapped file, which keeps the values after it
+// aligned to a cache line.
+#define ARRAY_LIST_FILE_HEADER_SIZE 64
+
+/**
+ * The header at the start of a file mapped by ArrayList_mapFile(). The size is
+ * only brought up to date by ArrayList_flush() and when the list is released.
+*/
+typedef struct ArrayList_FileHeader {
+  uint64_t magic;
+  uint64_t elem_size;
+  uint64_t size;
+} ArrayList_FileHeader;
+
+// The vectorised search kernels compare 64-bit pointers, so they are only built
+// for x86-64 compilers that can target individual functions at newer ISAs.
+#if !defined(ARRAY_LIST_NO_SIMD) && defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define ARRAY_LIST_X86_SIMD
+#include <immintrin.h>
+#endif
+
+// Collections shorter than this are searched one pointer at a time.
+#define ARRAY_LIST_SIMD_THRESHOLD 16
+
+// Ranges shorter than this are insertion sorted rather than partitioned.
+#define ARRAY_LIST_INSERTION_SORT_THRESHOLD 24
+
+// Ranges longer than this use the pseudo-median of nine as the pivot.
+#define ARRAY_LIST_NINTHER_THRESHOLD 128
+
+// The number of element moves allowed before a partial insertion sort gives up.
+#define ARRAY_LIST_PARTIAL_INSERTION_LIMIT 8
+
+// The number of elements examined per block when partitioning, which must fit
+// the offsets in an unsigned char.
+#define ARRAY_LIST_BLOCK_SIZE 64
+
+/**
+ * Gets the number of bytes each slot of the collection of the given array list
+ * takes up, which is the element size for an array list of values.
+ * 
+ * @param ArrayList* The array list to get the slot size of.
+ * @return The size in bytes of each slot.
+*/
+static inline size_t ArrayList_slotSize(ArrayList* list) {
+  return list->elem_size > 0 ? list->elem_size : sizeof(void*);
+}
+
+/**
+ * Gets the largest number of elements the collection of the given array list
+ * can hold before its size in bytes would overflow.
+ * 
+ * @param ArrayList* The array list to get the maximum capacity of.
+ * @return The maximum capacity of the array list.
+*/
+static inline size_t ArrayList_maxCapacity(ArrayList* list) {
+  return SIZE_MAX / ArrayList_slotSize(list);
+}
+
+/**
+ * Gets the number of elements that fit in the inline buffer of the given
+ * array list, which is 0 for values larger than the buffer.
+ * 
+ * @param ArrayList* The array list to get the inline capacity of.
+ * @return The inline capacity of the array list.
+*/
+static inline size_t ArrayList_inlineCapacity(ArrayList* list) {
+  return sizeof(list->inline_buffer) / ArrayList_slotSize(list);
+}
+
+/**
+ * Checks if the collection of the given array list is its inline buffer.
+ * 
+ * @param ArrayList* The array list to check.
+ * @return true if the collection is the inline buffer, false if it is on the
+ *         heap.
+*/
+static inline bool ArrayList_isInline(ArrayList* list) {
+  return list->collection == list->inline_buffer.pointers;
+}
+
+/**
+ * Sets up an empty array list with the given element size in the given
+ * storage, using the inline buffer as its collection.
+ * 
+ * @param ArrayList* The storage to set up the array list in.
+ * @param size_t     The size in bytes of each value, or 0 to store pointers.
+ * @param bool       true if the storage was allocated by the array list.
+*/
+static void ArrayList_setUp(ArrayList* list, size_t elem_size, bool allocated) {
+  list->collection = list->inline_buffer.pointers;
+  list->size = 0;
+  list->elem_size = elem_size;
+  list->capacity = ArrayList_inlineCapacity(list);
+  list->allocated = allocated;
+  list->incremental = false;
+  list->old_collection = NULL;
+  list->migrated = 0;
+  list->migrate_end = 0;
+  list->cursor = ARRAY_LIST_NPOS;
+  list->mapped = 0;
+  list->old_mapped = 0;
+  list->fd = -1;
+  list->read_only = false;
+  list->tombstones = NULL;
+  list->tombstone_words = 0;
+  list->removed = 0;
+  list->indexed = false;
+  list->index.slots = NULL;
+  list->index.mask = 0;
+  list->index.count = 0;
+}
+
+/**
+ * Gets the address of the slot at the given index of the collection.
+ * 
+ * @param ArrayList* The array list to get the slot of.
+ * @param size_t     The index of the slot, which may be equal to the capacity.
+ * @return The address of the slot.
+*/
+static inline void* ArrayList_slot(ArrayList* list, size_t index) {
+  return (unsigned char*) list->collection + index * ArrayList_slotSize(list);
+}
+
+/**
+ * Gets the element at the given index as comparators and key functions see
+ * it, which is the stored pointer, or the address of the stored value for an
+ * array list of values.
+ * 
+ * @param ArrayList* The array list to get the element of.
+ * @param size_t     The index of the element, which must be in bounds.
+ * @return The element at the given index.
+*/
+static inline void* ArrayList_element(ArrayList* list, size_t index) {
+  return list->elem_size > 0 ? ArrayList_slot(list, index) : list->collection[index];
+}
+
+/**
+ * Stores the given element at the given index. The pointer itself is stored,
+ * or for an array list of values the value it points to is copied.
+ * 
+ * @param ArrayList* The array list to store the element in.
+ * @param size_t     The index to store the element at, which must be within
+ *                   the capacity.
+ * @param void*      The pointer to the element.
+*/
+static inline void ArrayList_store(ArrayList* list, size_t index, void* data) {
+  if (list->elem_size > 0) {
+    memcpy(ArrayList_slot(list, index), data, list->elem_size);
+  } else {
+    list->collection[index] = data;
+  }
+}
+
+/**
+ * Gets the number of unused slots in the collection of the given array list,
+ * which form the gap while the gap buffer is open.
+ * 
+ * @param ArrayList* The array list to get the gap size of.
+ * @return The number of unused slots.
+*/
+static inline size_t ArrayList_gapSize(ArrayList* list) {
+  return list->capacity - list->size;
+}
+
+/**
+ * Moves the gap of the given array list to the given index, shifting the
+ * elements between the current cursor and the index across the gap. A closed
+ * gap is treated as a gap at the end of the collection.
+ * 
+ * @param ArrayList* The array list to move the gap of, which must not be in
+ *                   the middle of an incremental resize.
+ * @param size_t     The index to move the gap to, up to the size of the list.
+*/
+static void ArrayList_moveGap(ArrayList* list, size_t index) {
+  size_t cursor = list->cursor == ARRAY_LIST_NPOS ? list->size : list->cursor;
+  size_t gap = ArrayList_gapSize(list);
+  size_t slot_size = ArrayList_slotSize(list);
+
+  if (index < cursor) {
+    // Move the elements before the cursor to the far side of the gap.
+    memmove(ArrayList_slot(list, index + gap), ArrayList_slot(list, index), slot_size * (cursor - index));
+  } else if (index > cursor) {
+    // Move the elements after the gap to the near side of it.
+    memmove(ArrayList_slot(list, cursor), ArrayList_slot(list, cursor + gap), slot_size * (index - cursor));
+  }
+  list->cursor = index;
+}
+
+/**
+ * Closes the gap of the given array list if it is open, moving the elements
+ * after the gap back next to the ones before it.
+ * 
+ * @param ArrayList* The array list to close the gap of.
+*/
+static void ArrayList_closeGap(ArrayList* list) {
+  // If the gap is already closed, there is nothing to do.
+  if (list->cursor == ARRAY_LIST_NPOS) {
+    return;
+  }
+
+  ArrayList_moveGap(list, list->size);
+  list->cursor = ARRAY_LIST_NPOS;
+}
+
+/**
+ * Gets the index of the lowest bit set in the given word, which must not be 0.
+ * 
+ * @param uint64_t The word to search.
+ * @return The index of the lowest set bit.
+*/
+static inline size_t ArrayList_lowestBit(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+  return (size_t) __builtin_ctzll(word);
+#else
+  size_t index = 0;
+  while ((word & 1) == 0) {
+    word >>= 1;
+    index++;
+  }
+  return index;
+#endif
+}
+
+/**
+ * Counts the bits set in the given word.
+ * 
+ * @param uint64_t The word to count the bits of.
+ * @return The number of set bits.
+*/
+static inline size_t ArrayList_bitCount(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+  return (size_t) __builtin_popcountll(word);
+#else
+  size_t count = 0;
+  while (word != 0) {
+    word &= word - 1;
+    count++;
+  }
+  return count;
+#endif
+}
+
+/**
+ * Checks if the element at the given index is marked removed.
+ * 
+ * @param ArrayList* The array list to check.
+ * @param size_t     The index of the element.
+ * @return true if the element is marked removed, false otherwise.
+*/
+static inline bool ArrayList_isMarked(ArrayList* list, size_t index) {
+  return index / 64 < list->tombstone_words && (list->tombstones[index / 64] >> (index % 64) & 1) != 0;
+}
+
+/**
+ * Finds the first element marked removed at or after the given index, skipping
+ * a whole word of the bitmap at a time.
+ * 
+ * @param ArrayList* The array list to search.
+ * @param size_t     The index to start from.
+ * @return The index of the marked element, or the size of the list if there
+ *         is none.
+*/
+static size_t ArrayList_nextMarked(ArrayList* list, size_t index) {
+  size_t word = index / 64;
+  if (word >= list->tombstone_words) {
+    return list->size;
+  }
+
+  uint64_t bits = list->tombstones[word] & (~(uint64_t) 0 << (index % 64));
+  while (bits == 0) {
+    word++;
+    if (word >= list->tombstone_words) {
+      return list->size;
+    }
+    bits = list->tombstones[word];
+  }
+
+  index = word * 64 + ArrayList_lowestBit(bits);
+  return index < list->size ? index : list->size;
+}
+
+/**
+ * Gets the index that the given index will have once the elements marked
+ * removed are squeezed out, which is the index less the number of marked
+ * elements before it. Indices passed to the array list functions count the
+ * marked elements, as ArrayList_size() and ArrayList_get() do, so the functions
+ * that squeeze the list check their indices against the size first and then
+ * translate them with this.
+ * 
+ * @param ArrayList* The array list the index is in.
+ * @param size_t     The index, from 0 up to the size of the array list.
+ * @return The index once the marked elements are squeezed out.
+*/
+static size_t ArrayList_squeezedIndex(ArrayList* list, size_t index) {
+  // If no element is marked, the index does not move.
+  if (list->removed == 0) {
+    return index;
+  }
+
+  size_t word = index / 64;
+  size_t marked = 0;
+  for (size_t i = 0; i < word && i < list->tombstone_words; i++) {
+    marked += ArrayList_bitCount(list->tombstones[i]);
+  }
+  if (word < list->tombstone_words && index % 64 != 0) {
+    marked += ArrayList_bitCount(list->tombstones[word] & ~(~(uint64_t) 0 << (index % 64)));
+  }
+  return index - marked;
+}
+
+/**
+ * Squeezes the elements marked removed out of the given array list, moving
+ * each run of the other elements down once, and frees the bitmap. The list
+ * must not be in the middle of an incremental resize.
+ * 
+ * @param ArrayList* The array list to squeeze.
+*/
+static void ArrayList_squeeze(ArrayList* list) {
+  // If no element is marked, there is nothing to do.
+  if (list->removed == 0) {
+    return;
+  }
+
+  ArrayList_closeGap(list);
+  size_t slot_size = ArrayList_slotSize(list);
+  unsigned char* bytes = (unsigned char*) list->collection;
+  size_t kept = 0;
+  size_t index = 0;
+  while (index < list->size) {
+    size_t marked = ArrayList_nextMarked(list, index);
+    if (kept != index) {
+      memmove(bytes + kept * slot_size, bytes + index * slot_size, slot_size * (marked - index));
+    }
+    kept += marked - index;
+    index = marked + 1;
+  }
+
+  list->size = kept;
+  free(list->tombstones);
+  list->tombstones = NULL;
+  list->tombstone_words = 0;
+  list->removed = 0;
+
+  // The indices of the elements have moved, so the side index is stale.
+  free(list->index.slots);
+  list->index.slots = NULL;
+}
+
+#ifdef ARRAY_LIST_MMAP
+/**
+ * Rounds the given number of bytes up to a whole number of huge pages.
+ * 
+ * @param size_t The number of bytes to round up.
+ * @return The rounded number of bytes, or 0 if it would overflow.
+*/
+static inline size_t ArrayList_mappingSize(size_t bytes) {
+  // If rounding up would overflow, return 0.
+  if (bytes > SIZE_MAX - 2 * ARRAY_LIST_HUGE_PAGE_SIZE) {
+    return 0;
+  }
+
+  return (bytes + ARRAY_LIST_HUGE_PAGE_SIZE - 1) & ~(ARRAY_LIST_HUGE_PAGE_SIZE - 1);
+}
+
+/**
+ * Maps the given number of bytes of anonymous memory, rounded up to a whole
+ * number of huge pages and starting on a huge page boundary.
+ * 
+ * @param size_t The size of the mapping, as given by ArrayList_mappingSize().
+ * @return The start of the mapping, or NULL if the mapping failed.
+*/
+static void* ArrayList_mapPages(size_t length) {
+  // Map an extra huge page, so the start can be moved up to a boundary.
+  unsigned char* mapping = mmap(NULL, length + ARRAY_LIST_HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  // If the mapping failed, return NULL.
+  if (mapping == MAP_FAILED) {
+    return NULL;
+  }
+
+  // Unmap the unaligned memory either side of the collection.
+  size_t head = (ARRAY_LIST_HUGE_PAGE_SIZE - ((uintptr_t) mapping & (ARRAY_LIST_HUGE_PAGE_SIZE - 1))) & (ARRAY_LIST_HUGE_PAGE_SIZE - 1);
+  if (head > 0) {
+    munmap(mapping, head);
+  }
+  munmap(mapping + head + length, ARRAY_LIST_HUGE_PAGE_SIZE - head);
+  mapping += head;
+
+#ifdef ARRAY_LIST_HUGE_PAGES
+  madvise(mapping, length, MADV_HUGEPAGE);
+#endif
+  return mapping;
+}
+#endif
+
+/**
+ * Allocates memory for a collection of the given number of bytes, mapping it
+ * if it is at least ARRAY_LIST_MMAP_THRESHOLD bytes.
+ * 
+ * @param size_t  The number of bytes to allocate.
+ * @param size_t* Set to the number of bytes mapped, or 0 if malloc() was used.
+ * @return The new collection, or NULL if the allocation failed.
+*/
+static void* ArrayList_allocate(size_t bytes, size_t* mapped) {
+  *mapped = 0;
+#ifdef ARRAY_LIST_MMAP
+  if (bytes >= ARRAY_LIST_MMAP_THRESHOLD) {
+    size_t length = ArrayList_mappingSize(bytes);
+    void* collection = length > 0 ? ArrayList_mapPages(length) : NULL;
+    if (collection != NULL) {
+      *mapped = length;
+    }
+    return collection;
+  }
+#endif
+  return malloc(bytes);
+}
+
+/**
+ * Releases a collection allocated with ArrayList_allocate().
+ * 
+ * @param void*  The collection to release.
+ * @param size_t The number of bytes mapped for the collection, or 0 if it came
+ *               from malloc().
+*/
+static void ArrayList_release(void* collection, size_t mapped) {
+#ifdef ARRAY_LIST_MMAP
+  if (mapped > 0) {
+    munmap(collection, mapped);
+    return;
+  }
+#else
+  (void) mapped;
+#endif
+  free(collection);
+}
+
+/**
+ * Resizes a collection allocated with ArrayList_allocate() to the given
+ * number of bytes. A mapped collection that stays above the threshold is
+ * resized with mremap(), which moves its pages rather than copying them, and
+ * a collection crossing the threshold is copied into the other kind of memory.
+ * A mapping that cannot grow where it is is moved into a new region reserved
+ * with ArrayList_mapPages(), so it stays on a huge page boundary.
+ * 
+ * @param void*   The collection to resize.
+ * @param size_t* The number of bytes mapped for the collection, which is
+ *                updated for the new collection.
+ * @param size_t  The number of bytes of the collection in use.
+ * @param size_t  The new size of the collection in bytes.
+ * @return The resized collection, or NULL if the resize failed, in which case
+ *         the old collection is unchanged.
+*/
+static void* ArrayList_reallocate(void* collection, size_t* mapped, size_t used, size_t bytes) {
+#ifdef ARRAY_LIST_MMAP
+  // If the collection is mapped and stays large, move its pages.
+  if (*mapped > 0 && bytes >= ARRAY_LIST_MMAP_THRESHOLD) {
+    size_t length = ArrayList_mappingSize(bytes);
+    // If the collection could not be addressed, return NULL.
+    if (length == 0) {
+      return NULL;
+    }
+    // If the mapping is already the right size, there is nothing to do.
+    if (length == *mapped) {
+      return collection;
+    }
+
+    void* new_collection = mremap(collection, *mapped, length, 0);
+    // If the mapping cannot grow in place, move its pages into an aligned
+    // region, as mremap() on its own only keeps them page aligned.
+    if (new_collection == MAP_FAILED) {
+      void* target = ArrayList_mapPages(length);
+      // If the region could not be reserved, return NULL.
+      if (target == NULL) {
+        return NULL;
+      }
+
+      new_collection = mremap(collection, *mapped, length, MREMAP_MAYMOVE | MREMAP_FIXED, target);
+      // If the mapping could not be moved, release the region and return NULL.
+      if (new_collection == MAP_FAILED) {
+        munmap(target, length);
+        return NULL;
+      }
+    }
+#ifdef ARRAY_LIST_HUGE_PAGES
+    madvise(new_collection, length, MADV_HUGEPAGE);
+#endif
+    *mapped = length;
+    return new_collection;
+  }
+
+  // If the collection crosses the threshold, copy it across.
+  if (*mapped > 0 || bytes >= ARRAY_LIST_MMAP_THRESHOLD) {
+    size_t new_mapped;
+    void* new_collection = ArrayList_allocate(bytes, &new_mapped);
+    // If the memory allocation failed, return NULL.
+    if (new_collection == NULL) {
+      return NULL;
+    }
+    memcpy(new_collection, collection, used);
+    ArrayList_release(collection, *mapped);
+    *mapped = new_mapped;
+    return new_collection;
+  }
+#else
+  (void) mapped;
+  (void) used;
+#endif
+  return realloc(collection, bytes);
+}
+
+#ifdef ARRAY_LIST_FILES
+/**
+ * Gets the start of the file mapping of the given file backed array list,
+ * which is where its header is.
+ * 
+ * @param ArrayList* The file backed array list.
+ * @return The header at the start of the mapping.
+*/
+static inline ArrayList_FileHeader* ArrayList_fileHeader(ArrayList* list) {
+  return (ArrayList_FileHeader*) ((unsigned char*) list->collection - ARRAY_LIST_FILE_HEADER_SIZE);
+}
+
+/**
+ * Resizes the file behind the given file backed array list to hold the given
+ * number of values, and remaps it. A read only list cannot be resized.
+ * 
+ * @param ArrayList* The file backed array list to resize.
+ * @param size_t     The new capacity, which must not be less than the size.
+ * @return true if the file was resized successfully, false otherwise.
+*/
+static bool ArrayList_resizeFile(ArrayList* list, size_t capacity) {
+  // If the list is read only, or the file could not be addressed, return false.
+  if (list->read_only || capacity > (SIZE_MAX - ARRAY_LIST_FILE_HEADER_SIZE) / list->elem_size) {
+    return false;
+  }
+
+  size_t length = ARRAY_LIST_FILE_HEADER_SIZE + capacity * list->elem_size;
+  // The file has to be long enough for the mapping before the mapping grows,
+  // and the mapping has to shrink before the file does.
+  if (length > list->mapped && ftruncate(list->fd, (off_t) length) != 0) {
+    return false;
+  }
+
+  void* mapping = mremap(ArrayList_fileHeader(list), list->mapped, length, MREMAP_MAYMOVE);
+  // If the mapping could not be resized, return false.
+  if (mapping == MAP_FAILED) {
+    return false;
+  }
+
+  if (length < list->mapped && ftruncate(list->fd, (off_t) length) != 0) {
+    // A failed truncate only leaves the file longer than it needs to be, and
+    // the mapping is length bytes either way.
+  }
+
+  list->collection = (void**) ((unsigned char*) mapping + ARRAY_LIST_FILE_HEADER_SIZE);
+  list->mapped = length;
+  list->capacity = capacity;
+  return true;
+}
+
+/**
+ * Writes the size of the given file backed array list to its header, after
+ * closing the gap buffer and squeezing out the elements marked removed, so
+ * the values are in order in the file.
+ * 
+ * @param ArrayList* The file backed array list.
+*/
+static void ArrayList_writeFileHeader(ArrayList* list) {
+  ArrayList_closeGap(list);
+  ArrayList_squeeze(list);
+  ArrayList_fileHeader(list)->size = list->size;
+}
+
+/**
+ * Releases the file mapping of the given file backed array list. The size is
+ * written to the header, and the file is cut down to the values in use.
+ * 
+ * @param ArrayList* The file backed array list to unmap.
+*/
+static void ArrayList_unmapFile(ArrayList* list) {
+  size_t length = list->mapped;
+  if (!list->read_only) {
+    ArrayList_writeFileHeader(list);
+    length = ARRAY_LIST_FILE_HEADER_SIZE + list->size * list->elem_size;
+  }
+
+  munmap(ArrayList_fileHeader(list), list->mapped);
+  if (length < list->mapped && ftruncate(list->fd, (off_t) length) != 0) {
+    // A failed truncate only leaves the file longer than it needs to be.
+  }
+  close(list->fd);
+}
+#endif
+
+/**
+ * Creates a new array list with the given element size and capacity.
+ * 
+ * @param size_t The size in bytes of each value, or 0 to store pointers.
+ * @param size_t The initial capacity of the array list.
+ * @return The new array list, or NULL if the array list could not be created.
+*/
+static ArrayList* ArrayList_create(size_t elem_size, size_t capacity) {
+  size_t slot_size = elem_size > 0 ? elem_size : sizeof(void*);
+  // If the collection could not be addressed, return NULL.
+  if (capacity > SIZE_MAX / slot_size) {
+    return NULL;
+  }
+
+  ArrayList* list = malloc(sizeof(ArrayList));
+  // If the memory allocation failed, return NULL.
+  if (list == NULL) {
+    return NULL;
+  }
+
+  // Initialise the list, and move the collection to the heap if the inline
+  // buffer is too small.
+  ArrayList_setUp(list, elem_size, true);
+  if (capacity > list->capacity) {
+    void** new_collection = ArrayList_allocate(slot_size * capacity, &list->mapped);
+    // If the memory allocation failed, free the list and return NULL.
+    if (new_collection == NULL) {
+      free(list);
+      return NULL;
+    }
+    list->collection = new_collection;
+    list->capacity = capacity;
+  }
+  return list;
+}
+
+/**
+ * Creates a new list using a dynamic array as the underlying collection.
+ * The elements are kept in the inline buffer of the list until it grows past
+ * ARRAY_LIST_INLINE_CAPACITY, so the only allocation is the list itself.
+ * 
+ * @return The new array list, or NULL if the array list could not be created.
+*/
+ArrayList* new_ArrayList() {
+  return new_ArrayListWithCapacity(ARRAY_LIST_INLINE_CAPACITY);
+}
+
+/**
+ * Creates a new list using a dynamic array as the underlying collection, with
+ * room for the given number of elements before the collection has to grow.
+ * 
+ * @param size_t The initial capacity of the array list.
+ * @return The new array list, or NULL if the array list could not be created.
+*/
+ArrayList* new_ArrayListWithCapacity(size_t capacity) {
+  return ArrayList_create(0, capacity);
+}
+
+/**
+ * Creates a new list that stores values of the given size directly in its
+ * collection, rather than pointers to them. The values are contiguous, so
+ * scanning the list reads memory in order and adding an element needs no
+ * allocation of its own. Elements are copied in and out by their size.
+ * 
+ * @param size_t The size in bytes of each element, which must not be 0.
+ * @return The new array list, or NULL if the array list could not be created.
+*/
+ArrayList* new_ArrayListOf(size_t elem_size) {
+  return new_ArrayListOfWithCapacity(elem_size, ARRAY_LIST_DEFAULT_CAPACITY);
+}
+
+/**
+ * Creates a new list that stores values of the given size directly in its
+ * collection, with room for the given number of elements before the
+ * collection has to grow.
+ * 
+ * @param size_t The size in bytes of each element, which must not be 0.
+ * @param size_t The initial capacity of the array list.
+ * @return The new array list, or NULL if the array list could not be created.
+*/
+ArrayList* new_ArrayListOfWithCapacity(size_t elem_size, size_t capacity) {
+  // If the element size is 0, there is nothing to store, so return NULL.
+  if (elem_size == 0) {
+    return NULL;
+  }
+
+  return ArrayList_create(elem_size, capacity);
+}
+
+/**
+ * Creates an array list of values of the given size backed by the file at the
+ * given path, which is mapped into memory rather than read. Reading a value
+ * is a plain load from the mapping, and adding past the end of the file grows
+ * it with ftruncate() and remaps it, so reopening a large list is immediate.
+ * The file starts with a small header recording the element size and the
+ * number of values, which is only written by ArrayList_flush() and when the
+ * list is freed. A file that does not exist is created empty.
+ * With ARRAY_LIST_MAP_READ_ONLY, the file is opened read only and never
+ * changed: the list cannot grow, and changes made in memory are private to
+ * the process. With ARRAY_LIST_MAP_TRUNCATE, any values in the file are
+ * discarded. Only available on Linux.
+ * 
+ * @param const char* The path of the file.
+ * @param size_t      The size in bytes of each element, which must not be 0
+ *                    and must match the file if it already exists.
+ * @param int         ARRAY_LIST_MAP_READ_ONLY, ARRAY_LIST_MAP_TRUNCATE or 0.
+ * @return The new array list, or NULL if the file could not be opened or
+ *         mapped, or does not hold values of the given size.
+*/
+ArrayList* ArrayList_mapFile(const char* path, size_t elem_size, int flags) {
+#ifdef ARRAY_LIST_FILES
+  bool read_only = (flags & ARRAY_LIST_MAP_READ_ONLY) != 0;
+
+  // If there is no path, or nothing to store, or the flags contradict each
+  // other, return NULL.
+  if (path == NULL || elem_size == 0 || (read_only && (flags & ARRAY_LIST_MAP_TRUNCATE) != 0)) {
+    return NULL;
+  }
+
+  int fd = open(path, read_only ? O_RDONLY : O_RDWR | O_CREAT, 0644);
+  // If the file could not be opened, return NULL.
+  if (fd < 0) {
+    return NULL;
+  }
+
+  struct stat info;
+  // If the file could not be examined, close it and return NULL.
+  if (fstat(fd, &info) != 0) {
+    close(fd);
+    return NULL;
+  }
+
+  // Give a new file a header and room for the default number of values.
+  size_t length = (size_t) info.st_size;
+  bool created = length == 0 && !read_only;
+  if (created) {
+    length = ARRAY_LIST_FILE_HEADER_SIZE + elem_size * ARRAY_LIST_DEFAULT_CAPACITY;
+    if (ftruncate(fd, (off_t) length) != 0) {
+      close(fd);
+      return NULL;
+    }
+  }
+
+  // If the file is too short to have a header, close it and return NULL.
+  if (length < ARRAY_LIST_FILE_HEADER_SIZE) {
+    close(fd);
+    return NULL;
+  }
+
+  unsigned char* mapping = mmap(NULL, length, PROT_READ | PROT_WRITE, read_only ? MAP_PRIVATE : MAP_SHARED, fd, 0);
+  // If the file could not be mapped, close it and return NULL.
+  if (mapping == MAP_FAILED) {
+    close(fd);
+    return NULL;
+  }
+
+  ArrayList_FileHeader* header = (ArrayList_FileHeader*) mapping;
+  size_t capacity = (length - ARRAY_LIST_FILE_HEADER_SIZE) / elem_size;
+  if (created) {
+    header->magic = ARRAY_LIST_FILE_MAGIC;
+    header->elem_size = elem_size;
+    header->size = 0;
+  }
+
+  // If the file does not hold values of the given size, or claims to hold more
+  // than it does, unmap and close it and return NULL.
+  if (header->magic != ARRAY_LIST_FILE_MAGIC || header->elem_size != elem_size || header->size > capacity) {
+    munmap(mapping, length);
+    close(fd);
+    return NULL;
+  }
+
+  ArrayList* list = ArrayList_create(elem_size, 0);
+  // If the list could not be created, unmap and close the file and return NULL.
+  if (list == NULL) {
+    munmap(mapping, length);
+    close(fd);
+    return NULL;
+  }
+
+  list->collection = (void**) (mapping + ARRAY_LIST_FILE_HEADER_SIZE);
+  list->capacity = capacity;
+  list->size = (flags & ARRAY_LIST_MAP_TRUNCATE) != 0 ? 0 : (size_t) header->size;
+  list->mapped = length;
+  list->fd = fd;
+  list->read_only = read_only;
+  return list;
+#else
+  (void) path;
+  (void) elem_size;
+  (void) flags;
+  return NULL;
+#endif
+}
+
+/**
+ * Writes the values of the given file backed array list, and its size, back
+ * to the file with msync().
+ * 
+ * @param ArrayList* The file backed array list to flush.
+ * @param bool       true to wait for the data to reach the disk, false to
+ *                   only schedule the write.
+ * @return true if the flush succeeded, false if the list is NULL, read only or
+ *         not backed by a file, or the write failed.
+*/
+bool ArrayList_flush(ArrayList* list, bool wait) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  // If the list is not backed by a writable file, return false.
+  if (list->fd < 0 || list->read_only) {
+    return false;
+  }
+
+#ifdef ARRAY_LIST_FILES
+  ArrayList_writeFileHeader(list);
+  return msync(ArrayList_fileHeader(list), list->mapped, wait ? MS_SYNC : MS_ASYNC) == 0;
+#else
+  (void) wait;
+  return false;
+#endif
+}
+
+/**
+ * Initialises an array list in storage owned by the caller, such as a local
+ * variable or a field of another struct. Nothing is allocated until the list
+ * outgrows its inline buffer. The list must be released with
+ * ArrayList_deinit(), and must not be moved while it is in use.
+ * 
+ * @param ArrayList* The storage to initialise the array list in.
+ * @return true if the array list was initialised, false if it is NULL.
+*/
+bool ArrayList_init(ArrayList* list) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  ArrayList_setUp(list, 0, false);
+  return true;
+}
+
+/**
+ * Initialises an array list of values of the given size in storage owned by
+ * the caller, in the same way as ArrayList_init().
+ * 
+ * @param ArrayList* The storage to initialise the array list in.
+ * @param size_t     The size in bytes of each element, which must not be 0.
+ * @return true if the array list was initialised, false otherwise.
+*/
+bool ArrayList_initOf(ArrayList* list, size_t elem_size) {
+  // If the list is NULL, or the element size is 0, return false.
+  if (list == NULL || elem_size == 0) {
+    return false;
+  }
+
+  ArrayList_setUp(list, elem_size, false);
+  return true;
+}
+
+/**
+ * Releases the memory held by an array list initialised with ArrayList_init()
+ * or ArrayList_initOf(), without freeing the array list itself. The list is
+ * left empty and can be used again.
+ * 
+ * @param ArrayList* The array list to release.
+*/
+void ArrayList_deinit(ArrayList* list) {
+  // If the list is NULL, return.
+  if (list == NULL) {
+    return;
+  }
+
+  // If the collection is on the heap, free it, along with any old collection
+  // left over from an incremental resize.
+  if (list->fd >= 0) {
+#ifdef ARRAY_LIST_FILES
+    ArrayList_unmapFile(list);
+#endif
+  } else if (list->collection != NULL && !ArrayList_isInline(list)) {
+    ArrayList_release(list->collection, list->mapped);
+  }
+  if (list->old_collection != NULL) {
+    ArrayList_release(list->old_collection, list->old_mapped);
+  }
+  free(list->tombstones);
+  free(list->index.slots);
+
+  ArrayList_setUp(list, list->elem_size, list->allocated);
+}
+
+/**
+ * Resizes the collection of the given array list to hold exactly the given
+ * number of elements.
+ * 
+ * @param ArrayList* The array list to resize.
+ * @param size_t     The new capacity, which must not be less than the size.
+ * @return true if the collection was resized successfully, false otherwise.
+*/
+static bool ArrayList_setCapacity(ArrayList* list, size_t capacity) {
+  size_t slot_size = ArrayList_slotSize(list);
+
+  // If the collection is a mapped file, resize the file instead.
+  if (list->fd >= 0) {
+#ifdef ARRAY_LIST_FILES
+    return ArrayList_resizeFile(list, capacity);
+#else
+    return false;
+#endif
+  }
+
+  // If the elements fit in the inline buffer, move them back into it.
+  if (capacity <= ArrayList_inlineCapacity(list)) {
+    if (!ArrayList_isInline(list)) {
+      void** old_collection = list->collection;
+      list->collection = list->inline_buffer.pointers;
+      memcpy(list->collection, old_collection, slot_size * list->size);
+      ArrayList_release(old_collection, list->mapped);
+      list->mapped = 0;
+    }
+    list->capacity = ArrayList_inlineCapacity(list);
+    return true;
+  }
+
+  // Otherwise move the elements out of the inline buffer, or resize the
+  // collection already on the heap.
+  void** new_collection;
+  if (ArrayList_isInline(list)) {
+    new_collection = ArrayList_allocate(slot_size * capacity, &list->mapped);
+    if (new_collection != NULL) {
+      memcpy(new_collection, list->collection, slot_size * list->size);
+    }
+  } else {
+    new_collection = ArrayList_reallocate(list->collection, &list->mapped, slot_size * list->size, slot_size * capacity);
+  }
+  // If the memory allocation failed, return false.
+  if (new_collection == NULL) {
+    return false;
+  }
+
+  list->collection = new_collection;
+  list->capacity = capacity;
+  return true;
+}
+
+/**
+ * Gets the capacity the given array list grows to in order to hold at least
+ * the given number of elements. The capacity grows geometrically so that a
+ * series of appends only reallocates the collection a logarithmic number of
+ * times.
+ * 
+ * @param ArrayList* The array list to grow.
+ * @param size_t     The number of elements the array list must be able to hold.
+ * @return The new capacity, or 0 if the collection could not be addressed.
+*/
+static size_t ArrayList_grownCapacity(ArrayList* list, size_t required) {
+  // If the collection could not be addressed, return 0.
+  size_t max_capacity = ArrayList_maxCapacity(list);
+  if (required > max_capacity) {
+    return 0;
+  }
+
+  // Double the capacity, without overflowing, until it is large enough. An
+  // inline buffer too small for a single value starts the doubling from 1.
+  size_t new_capacity = list->capacity > 0 ? list->capacity : 1;
+  while (new_capacity < required) {
+    if (new_capacity > max_capacity / ARRAY_LIST_GROWTH_FACTOR) {
+      return max_capacity;
+    }
+    new_capacity *= ARRAY_LIST_GROWTH_FACTOR;
+  }
+  return new_capacity;
+}
+
+/**
+ * Makes sure the given array list has room for at least the given number of
+ * elements, growing the collection geometrically.
+ * 
+ * @param ArrayList* The array list to grow.
+ * @param size_t     The number of elements the array list must be able to hold.
+ * @return true if the array list has the required capacity, false otherwise.
+*/
+static bool ArrayList_ensureCapacity(ArrayList* list, size_t required) {
+  // If there is already enough room, there is nothing to do.
+  if (required <= list->capacity) {
+    return true;
+  }
+
+  size_t new_capacity = ArrayList_grownCapacity(list, required);
+  // If the collection could not be addressed, return false.
+  if (new_capacity == 0) {
+    return false;
+  }
+
+  return ArrayList_setCapacity(list, new_capacity);
+}
+
+/**
+ * Moves up to the given number of the elements still in the old collection of
+ * the given array list into the new one, in order, and frees the old
+ * collection once they have all been moved.
+ * 
+ * @param ArrayList* The array list to move the elements of.
+ * @param size_t     The most elements to move.
+*/
+static void ArrayList_migrate(ArrayList* list, size_t count) {
+  // If the list is not being resized, there is nothing to do.
+  if (list->old_collection == NULL) {
+    return;
+  }
+
+  size_t remaining = list->migrate_end - list->migrated;
+  if (count > remaining) {
+    count = remaining;
+  }
+
+  size_t slot_size = ArrayList_slotSize(list);
+  unsigned char* old_slot = (unsigned char*) list->old_collection + list->migrated * slot_size;
+  memcpy(ArrayList_slot(list, list->migrated), old_slot, slot_size * count);
+  list->migrated += count;
+
+  // If every element has been moved, free the old collection.
+  if (list->migrated == list->migrate_end) {
+    ArrayList_release(list->old_collection, list->old_mapped);
+    list->old_collection = NULL;
+    list->old_mapped = 0;
+  }
+}
+
+/**
+ * Finishes any incremental resize of the given array list, so that all of its
+ * elements are in its collection.
+ * 
+ * @param ArrayList* The array list to finish resizing.
+*/
+static inline void ArrayList_finishMigration(ArrayList* list) {
+  ArrayList_migrate(list, SIZE_MAX);
+}
+
+/**
+ * Starts growing the collection of the given array list incrementally. The new
+ * collection is allocated, but the elements are left in the old one to be
+ * moved across by later calls to ArrayList_migrate().
+ * 
+ * @param ArrayList* The array list to grow, whose collection is on the heap.
+ * @param size_t     The new capacity, which must be greater than the size.
+ * @return true if the new collection was allocated, false otherwise.
+*/
+static bool ArrayList_startMigration(ArrayList* list, size_t capacity) {
+  size_t mapped;
+  void** new_collection = ArrayList_allocate(ArrayList_slotSize(list) * capacity, &mapped);
+  // If the memory allocation failed, return false.
+  if (new_collection == NULL) {
+    return false;
+  }
+
+  list->old_collection = list->collection;
+  list->old_mapped = list->mapped;
+  list->collection = new_collection;
+  list->mapped = mapped;
+  list->capacity = capacity;
+  list->migrated = 0;
+  list->migrate_end = list->size;
+  return true;
+}
+
+/**
+ * Makes sure the elements of the given array list are all in its collection,
+ * in order, with no gap between them, by finishing any incremental resize,
+ * closing the gap buffer and squeezing out the elements marked removed. The
+ * functions that work on the collection as a whole call this first. The size
+ * of the list drops by the number of marked elements, so any index given to
+ * such a function must be checked against the size before this is called, and
+ * then moved with ArrayList_squeezedIndex().
+ * 
+ * @param ArrayList* The array list to make contiguous.
+*/
+static inline void ArrayList_makeContiguous(ArrayList* list) {
+  ArrayList_finishMigration(list);
+  ArrayList_closeGap(list);
+  ArrayList_squeeze(list);
+}
+
+/**
+ * Squeezes the elements marked removed out of the given array list, if there
+ * are any, before a function that works by position. The gap buffer is left
+ * alone when nothing is marked.
+ * 
+ * @param ArrayList* The array list to compact.
+*/
+static inline void ArrayList_compactMarked(ArrayList* list) {
+  if (list->removed > 0) {
+    ArrayList_makeContiguous(list);
+  }
+}
+
+/**
+ * Creates an empty hash table with room for the given number of elements,
+ * which keeps it at most half full.
+ * 
+ * @param ArrayList_HashTable* The hash table to set up.
+ * @param size_t               The number of elements it has to hold.
+ * @return true if the hash table was created, false if the memory allocation
+ *         failed.
+*/
+static bool ArrayList_hashCreate(ArrayList_HashTable* table, size_t count) {
+  size_t capacity = 16;
+  while (capacity / 2 < count) {
+    // If the table could not be addressed, return false.
+    if (capacity > SIZE_MAX / sizeof(size_t) / 2) {
+      return false;
+    }
+    capacity *= 2;
+  }
+
+  table->slots = malloc(sizeof(size_t) * capacity);
+  if (table->slots == NULL) {
+    return false;
+  }
+
+  // Every bit of ARRAY_LIST_NPOS is set, so the slots can be emptied bytewise.
+  memset(table->slots, 0xFF, sizeof(size_t) * capacity);
+  table->mask = capacity - 1;
+  table->count = 0;
+  return true;
+}
+
+/**
+ * Hashes an element of the given array list, mixing the pointer itself, or
+ * every byte of a value, so that nearby addresses and values spread across
+ * the whole table.
+ * 
+ * @param ArrayList* The array list the element belongs to.
+ * @param void*      The element, as ArrayList_element() gives it.
+ * @return The hash of the element.
+*/
+static uint64_t ArrayList_hashElement(ArrayList* list, const void* element) {
+  uint64_t hash = 0;
+  if (list->elem_size == 0) {
+    hash = (uint64_t) (uintptr_t) element;
+  } else {
+    const unsigned char* bytes = element;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= list->elem_size; i += sizeof(uint64_t)) {
+      uint64_t chunk;
+      memcpy(&chunk, bytes + i, sizeof(uint64_t));
+      hash = (hash ^ chunk) * UINT64_C(0x9e3779b97f4a7c15);
+      hash ^= hash >> 29;
+    }
+    for (; i < list->elem_size; i++) {
+      hash = (hash ^ bytes[i]) * UINT64_C(0x100000001b3);
+    }
+  }
+
+  // Finish with the MurmurHash3 mixer, so every input bit affects the slot.
+  hash ^= hash >> 33;
+  hash *= UINT64_C(0xff51afd7ed558ccd);
+  hash ^= hash >> 33;
+  hash *= UINT64_C(0xc4ceb9fe1a85ec53);
+  hash ^= hash >> 33;
+  return hash;
+}
+
+/**
+ * Finds the slot of the given hash table that holds an element equal to the
+ * given one, or the empty slot where it would go.
+ * 
+ * @param ArrayList_HashTable* The hash table to search.
+ * @param ArrayList*           The array list the table holds the indices of.
+ * @param void*                The element to look for, as ArrayList_element()
+ *                             gives it.
+ * @return The slot of the equal element, or an empty slot.
+*/
+static size_t* ArrayList_hashFind(ArrayList_HashTable* table, ArrayList* list, const void* element) {
+  size_t position = (size_t) ArrayList_hashElement(list, element) & table->mask;
+  while (table->slots[position] != ARRAY_LIST_NPOS) {
+    void* other = ArrayList_element(list, table->slots[position]);
+    if (list->elem_size > 0 ? memcmp(other, element, list->elem_size) == 0 : other == element) {
+      break;
+    }
+    position = (position + 1) & table->mask;
+  }
+  return &table->slots[position];
+}
+
+/**
+ * Builds a hash table of every element of the given array list, with room
+ * for at least the given number of elements.
+ * 
+ * @param ArrayList_HashTable* The hash table to create.
+ * @param ArrayList*           The array list to add the elements of, which
+ *                             must be contiguous.
+ * @param size_t               The number of elements the table has to hold,
+ *                             which must not be less than the size of the list.
+ * @return true if the hash table was built, false if the memory allocation
+ *         failed.
+*/
+static bool ArrayList_hashBuild(ArrayList_HashTable* table, ArrayList* list, size_t count) {
+  if (!ArrayList_hashCreate(table, count)) {
+    return false;
+  }
+
+  for (size_t i = 0; i < list->size; i++) {
+    size_t* slot = ArrayList_hashFind(table, list, ArrayList_element(list, i));
+    if (*slot == ARRAY_LIST_NPOS) {
+      *slot = i;
+      table->count++;
+    }
+  }
+  return true;
+}
+
+/**
+ * Removes the given slot from a hash table, shifting back the elements after
+ * it that probed past it, so that no tombstone is needed.
+ * 
+ * @param ArrayList_HashTable* The hash table to remove the slot from.
+ * @param ArrayList*           The array list the table holds the indices of.
+ * @param size_t*              The slot to empty.
+*/
+static void ArrayList_hashErase(ArrayList_HashTable* table, ArrayList* list, size_t* slot) {
+  size_t hole = (size_t) (slot - table->slots);
+  size_t next = (hole + 1) & table->mask;
+  while (table->slots[next] != ARRAY_LIST_NPOS) {
+    size_t home = (size_t) ArrayList_hashElement(list, ArrayList_element(list, table->slots[next])) & table->mask;
+    // Move the element into the hole if its home slot is not between them.
+    if (((next - home) & table->mask) >= ((next - hole) & table->mask)) {
+      table->slots[hole] = table->slots[next];
+      hole = next;
+    }
+    next = (next + 1) & table->mask;
+  }
+  table->slots[hole] = ARRAY_LIST_NPOS;
+  table->count--;
+}
+
+/**
+ * Frees the side index of the given array list, if it has been built. It is
+ * built again by the next lookup that needs it.
+ * 
+ * @param ArrayList* The array list to drop the index of.
+*/
+static inline void ArrayList_dropIndex(ArrayList* list) {
+  free(list->index.slots);
+  list->index.slots = NULL;
+}
+
+/**
+ * Adds the element just appended to the given array list to its side index,
+ * if the index has been built. An index that would become more than half full
+ * is rebuilt with twice the room instead, so appending stays amortised O(1).
+ * 
+ * @param ArrayList* The array list the element was appended to, which must be
+ *                   contiguous.
+*/
+static void ArrayList_indexAppended(ArrayList* list) {
+  if (list->index.slots == NULL) {
+    return;
+  }
+
+  // A failed rebuild leaves the index to be built by the next lookup.
+  if ((list->index.count + 1) * 2 > list->index.mask + 1) {
+    ArrayList_dropIndex(list);
+    ArrayList_hashBuild(&list->index, list, list->size * 2);
+    return;
+  }
+
+  size_t* slot = ArrayList_hashFind(&list->index, list, ArrayList_element(list, list->size - 1));
+  // An earlier equal element keeps its place in the index.
+  if (*slot == ARRAY_LIST_NPOS) {
+    *slot = list->size - 1;
+    list->index.count++;
+  }
+}
+
+/**
+ * Makes sure the given array list can hold at least the given number of
+ * elements without reallocating its collection.
+ * 
+ * @param ArrayList* The array list to reserve space in.
+ * @param size_t     The number of elements to reserve space for.
+ * @return true if the space was reserved successfully, false otherwise.
+*/
+bool ArrayList_reserve(ArrayList* list, size_t capacity) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  // If the collection is NULL, return false.
+  if (list->collection == NULL) {
+    return false;
+  }
+
+  ArrayList_makeContiguous(list);
+
+  // If there is already enough room, there is nothing to do.
+  if (capacity <= list->capacity) {
+    return true;
+  }
+
+  // If the collection could not be addressed, return false.
+  if (capacity > ArrayList_maxCapacity(list)) {
+    return false;
+  }
+
+  return ArrayList_setCapacity(list, capacity);
+}
+
+/**
+ * Reduces the capacity of the given array list to match its size, releasing
+ * any unused memory held by the collection.
+ * 
+ * @param ArrayList* The array list to shrink.
+ * @return true if the array list was shrunk successfully, false otherwise.
+*/
+bool ArrayList_shrinkToFit(ArrayList* list) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  // If the collection is NULL, return false.
+  if (list->collection == NULL) {
+    return false;
+  }
+
+  ArrayList_makeContiguous(list);
+
+  // If the collection already fits the elements exactly, there is nothing to do.
+  if (list->size == list->capacity) {
+    return true;
+  }
+
+  // Small lists move back into the inline buffer.
+  return ArrayList_setCapacity(list, list->size);
+}
+
+/**
+ * Gets the capacity of the given array list, which is the number of elements
+ * it can hold before the collection has to be reallocated.
+ * 
+ * @param ArrayList* The array list to get the capacity of.
+ * @return The capacity of the given array list, or ARRAY_LIST_NPOS if the array
+ *         list is NULL.
+*/
+size_t ArrayList_capacity(ArrayList* list) {
+  // If the list is NULL, return ARRAY_LIST_NPOS.
+  if (list == NULL) {
+    return ARRAY_LIST_NPOS;
+  }
+
+  return list->capacity;
+}
+
+/**
+ * Turns incremental resize mode on or off for the given array list. In this
+ * mode, growing a collection on the heap allocates the larger collection
+ * without copying into it, and each following ArrayList_add() and
+ * ArrayList_get() moves at most ARRAY_LIST_INCREMENTAL_STEP elements across.
+ * With the capacity doubling, the move is always finished before the new
+ * collection fills up, so no single add copies more than that many elements.
+ * Turning the mode off finishes any move in progress.
+ * 
+ * @param ArrayList* The array list to change the resize mode of.
+ * @param bool       true to resize incrementally, false to resize all at once.
+ * @return true if the resize mode was changed, false if the array list is NULL.
+*/
+bool ArrayList_setIncrementalResize(ArrayList* list, bool incremental) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  if (!incremental) {
+    ArrayList_finishMigration(list);
+  }
+  list->incremental = incremental;
+  return true;
+}
+
+/**
+ * Turns the side index of the given array list on or off. An indexed list
+ * keeps a hash table from each element to the index of its first occurrence,
+ * so ArrayList_indexOf() and ArrayList_contains() take O(1) expected time
+ * rather than scanning the list. The table is built by the first lookup once
+ * the list holds ARRAY_LIST_INDEX_THRESHOLD elements, and kept up to date by
+ * ArrayList_add() and by removing the last element. Any other edit that moves
+ * elements drops it, to be rebuilt by the next lookup, which costs no more
+ * than the edit did. The order of the list is never changed. The values of an
+ * indexed array list of values must not be changed in place through the
+ * address ArrayList_get() gives.
+ * 
+ * @param ArrayList* The array list to change.
+ * @param bool       true to keep a side index, false to free it.
+ * @return true if the mode was set, false if the array list is NULL.
+*/
+bool ArrayList_setIndexed(ArrayList* list, bool indexed) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  if (!indexed) {
+    ArrayList_dropIndex(list);
+  }
+  list->indexed = indexed;
+  return true;
+}
+
+/**
+ * Gets the size of the values stored in the given array list.
+ * 
+ * @param ArrayList* The array list to get the element size of.
+ * @return The size in bytes of each value, 0 if the array list stores
+ *         pointers, or ARRAY_LIST_NPOS if the array list is NULL.
+*/
+size_t ArrayList_elementSize(ArrayList* list) {
+  // If the list is NULL, return ARRAY_LIST_NPOS.
+  if (list == NULL) {
+    return ARRAY_LIST_NPOS;
+  }
+
+  return list->elem_size;
+}
+
+/**
+ * Adds a new element to the end of the given array list.
+ * The data is stored in the array list as a void pointer. Note that the data
+ * is not copied, but rather the pointer to the data is stored in the array list.
+ * For an array list of values, the value the pointer points to is copied into
+ * the collection instead.
+ * The capacity grows geometrically, so appending is amortised O(1), or O(1)
+ * in the worst case in incremental resize mode.
+ * 
+ * @param ArrayList* The array list to add the element to.
+ * @param void*      The pointer to the element to add to the array list.
+ * @return true if the element was added successfully, false otherwise.
+*/
+bool ArrayList_add(ArrayList* list, void* data) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  // If the collection is NULL, return false.
+  if (list->collection == NULL) {
+    return false;
+  }
+
+  // If the list stores values, and there is no value to copy, return false.
+  if (list->elem_size > 0 && data == NULL) {
+    return false;
+  }
+
+  // Appending needs the free space at the end, so close the gap buffer.
+  ArrayList_closeGap(list);
+
+  // If the list is full but enough of it is marked removed, compact it
+  // rather than growing it.
+  if (list->size == list->capacity && list->removed > 0 && list->removed >= list->size / ARRAY_LIST_COMPACT_THRESHOLD) {
+    ArrayList_makeContiguous(list);
+  }
+
+  // If the list is full, grow the collection. In incremental resize mode, a
+  // collection on the heap is grown without copying the elements across.
+  if (list->size == list->capacity) {
+    ArrayList_finishMigration(list);
+    if (list->incremental && !ArrayList_isInline(list) && list->fd < 0) {
+      size_t new_capacity = ArrayList_grownCapacity(list, list->size + 1);
+      // If the collection could not be addressed or allocated, return false.
+      if (new_capacity == 0 || !ArrayList_startMigration(list, new_capacity)) {
+        return false;
+      }
+    } else if (!ArrayList_ensureCapacity(list, list->size + 1)) {
+      return false;
+    }
+  }
+
+  // Move a few of the elements left in the old collection, if there is one.
+  ArrayList_migrate(list, ARRAY_LIST_INCREMENTAL_STEP);
+
+  // Add the data to the collection, and to the side index unless the list is
+  // still moving to a new collection.
+  ArrayList_store(list, list->size, data);
+  list->size++;
+  if (list->old_collection == NULL) {
+    ArrayList_indexAppended(list);
+  } else {
+    ArrayList_dropIndex(list);
+  }
+  return true;
+}
+
+/**
+ * Adds a series of elements to the end of the given array list.
+ * The collection is grown at most once and the elements are copied in a single
+ * pass. Note that the data is not copied, but rather the pointers to the data
+ * are stored in the array list. For an array list of values, the values the
+ * pointers point to are copied into the collection instead.
+ * 
+ * @param ArrayList* The array list to add the elements to.
+ * @param void**     The array of pointers to add, which must not point into the
+ *                   collection of the array list.
+ * @param size_t     The number of pointers to add.
+ * @return true if the elements were added successfully, false otherwise.
+*/
+bool ArrayList_addAll(ArrayList* list, void** items, size_t count) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  // The size counts any elements marked removed, and insertRange() moves it
+  // to the end of the squeezed list along with the other indices.
+  return ArrayList_insertRange(list, list->size, items, count);
+}
+
+/**
+ * Inserts a series of elements into the given array list, starting at the
+ * given index. The elements after the index are shifted along with a single
+ * memmove, and the collection is grown at most once.
+ * For an array list of values, the values the pointers point to are copied
+ * into the collection.
+ * Note that the data is not copied, but rather the pointers to the data are
+ * stored in the array list.
+ * 
+ * @param ArrayList* The array list to insert the elements into.
+ * @param size_t     The index to insert the first element at, which may be equal
+ *                   to the size of the array list to append the elements.
+ * @param void**     The array of pointers to insert, which must not point into
+ *                   the collection of the array list.
+ * @param size_t     The number of pointers to insert.
+ * @return true if the elements were inserted successfully, false otherwise.
+*/
+bool ArrayList_insertRange(ArrayList* list, size_t index, void** items, size_t count) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  // If the collection is NULL, return false.
+  if (list->collection == NULL) {
+    return false;
+  }
+
+  // If the index is out of bounds, return false.
+  if (index > list->size) {
+    return false;
+  }
+
+  // The index counts the marked elements, so move it along with them as they
+  // are squeezed out.
+  index = ArrayList_squeezedIndex(list, index);
+  ArrayList_makeContiguous(list);
+  ArrayList_dropIndex(list);
+
+  // If there are no items to insert, return false.
+  if (items == NULL && count > 0) {
+    return false;
+  }
+
+  // If there is nothing to insert, there is nothing to do.
+  if (count == 0) {
+    return true;
+  }
+
+  // If the list stores values, and one of them is missing, return false.
+  if (list->elem_size > 0) {
+    for (size_t i = 0; i < count; i++) {
+      if (items[i] == NULL) {
+        return false;
+      }
+    }
+  }
+
+  // If the list would overflow, or the collection cannot grow, return false.
+  if (count > ArrayList_maxCapacity(list) - list->size || !ArrayList_ensureCapacity(list, list->size + count)) {
+    return false;
+  }
+
+  // Open a gap for the new elements and copy them in.
+  memmove(ArrayList_slot(list, index + count), ArrayList_slot(list, index), ArrayList_slotSize(list) * (list->size - index));
+  if (list->elem_size > 0) {
+    for (size_t i = 0; i < count; i++) {
+      memcpy(ArrayList_slot(list, index + i), items[i], list->elem_size);
+    }
+  } else {
+    memcpy(&list->collection[index], items, sizeof(void*) * count);
+  }
+  list->size += count;
+  return true;
+}
+
+/**
+ * Inserts an element into the given array list at the given index, using the
+ * collection as a gap buffer. The unused capacity is kept as a gap at the
+ * cursor, so inserting at the cursor is O(1), and the gap only has to move
+ * when an edit is made somewhere else. The cursor ends up just after the new
+ * element, ready for the next insert.
+ * The gap stays open until a function that needs the whole collection in
+ * order, such as ArrayList_add() or ArrayList_sort(), closes it again.
+ * For an array list of values, the value the pointer points to is copied into
+ * the collection.
+ * 
+ * @param ArrayList* The array list to insert the element into.
+ * @param size_t     The index to insert the element at, which may be equal to
+ *                   the size of the array list.
+ * @param void*      The pointer to the element to insert.
+ * @return true if the element was inserted successfully, false otherwise.
+*/
+bool ArrayList_insert(ArrayList* list, size_t index, void* data) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  // If the collection is NULL, return false.
+  if (list->collection == NULL) {
+    return false;
+  }
+
+  // If the index is out of bounds, return false.
+  if (index > list->size) {
+    return false;
+  }
+
+  // The index counts the marked elements, so move it along with them as they
+  // are squeezed out.
+  index = ArrayList_squeezedIndex(list, index);
+  ArrayList_compactMarked(list);
+
+  // If the list stores values, and there is no value to copy, return false.
+  if (list->elem_size > 0 && data == NULL) {
+    return false;
+  }
+
+  ArrayList_finishMigration(list);
+  ArrayList_dropIndex(list);
+
+  // If the gap is used up, the elements are already contiguous, so the gap
+  // can be closed for free and the collection grown as usual.
+  if (list->size == list->capacity) {
+    list->cursor = ARRAY_LIST_NPOS;
+    if (!ArrayList_ensureCapacity(list, list->size + 1)) {
+      return false;
+    }
+  }
+
+  // Move the gap to the index, and fill its first slot.
+  ArrayList_moveGap(list, index);
+  ArrayList_store(list, list->cursor, data);
+  list->cursor++;
+  list->size++;
+  return true;
+}
+
+/**
+ * Moves the gap buffer cursor of the given array list to the given index,
+ * opening the gap if it is closed. Only the elements between the old and new
+ * cursor are moved, so edits that stay close to the cursor stay cheap.
+ * 
+ * @param ArrayList* The array list to move the cursor of.
+ * @param size_t     The new cursor, from 0 up to the size of the array list.
+ * @return true if the cursor was moved, false otherwise.
+*/
+bool ArrayList_moveCursor(ArrayList* list, size_t index) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  // If the collection is NULL, return false.
+  if (list->collection == NULL) {
+    return false;
+  }
+
+  // If the index is out of bounds, return false.
+  if (index > list->size) {
+    return false;
+  }
+
+  // The index counts the marked elements, so move it along with them as they
+  // are squeezed out.
+  index = ArrayList_squeezedIndex(list, index);
+  ArrayList_compactMarked(list);
+
+  ArrayList_finishMigration(list);
+  ArrayList_moveGap(list, index);
+  return true;
+}
+
+/**
+ * Releases memory from the given array list once it has become sparse.
+ * The collection is halved when the size falls to a quarter of the capacity,
+ * which keeps removal amortised O(1) and stops a list that repeatedly grows
+ * and shrinks around a boundary from reallocating on every call. The capacity
+ * never drops below the default capacity this way.
+ * 
+ * @param ArrayList* The array list to shrink.
+*/
+static void ArrayList_shrinkIfSparse(ArrayList* list) {
+  // If the list is still dense enough, or already small, there is nothing to do.
+  if (list->capacity <= ARRAY_LIST_DEFAULT_CAPACITY || list->size > list->capacity / ARRAY_LIST_SHRINK_THRESHOLD) {
+    return;
+  }
+
+  size_t new_capacity = list->capacity / ARRAY_LIST_GROWTH_FACTOR;
+  if (new_capacity < ARRAY_LIST_DEFAULT_CAPACITY) {
+    new_capacity = ARRAY_LIST_DEFAULT_CAPACITY;
+  }
+
+  // A failed shrink leaves the list valid, just larger than it needs to be.
+  ArrayList_setCapacity(list, new_capacity);
+}
+
+/**
+ * Removes the element at the given index from the given array list.
+ * The elements after the index are shifted down to keep the order, and the
+ * collection keeps its capacity until the list becomes sparse.
+ * The data is not freed, but rather the pointer to the data is removed 
+ * from the array list.
+ * 
+ * @param ArrayList* The array list to remove the element from.
+ * @param size_t     The index of the element to remove.
+ * @return true if the element was removed successfully, false if the index is
+ *         out of bounds or the element is already marked removed.
+*/
+bool ArrayList_remove(ArrayList* list, size_t index) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  // If the collection is NULL, return false.
+  if (list->collection == NULL) {
+    return false;
+  }
+
+  // If the index is out of bounds, or the element is already marked removed,
+  // return false.
+  if (index >= list->size || ArrayList_isMarked(list, index)) {
+    return false;
+  }
+
+  // The index counts the marked elements, so move it along with them as they
+  // are squeezed out.
+  index = ArrayList_squeezedIndex(list, index);
+  ArrayList_compactMarked(list);
+  ArrayList_finishMigration(list);
+
+  // Removing the last element of a contiguous list moves no other element, so
+  // the side index only has to forget it. Any other removal makes it stale.
+  if (list->index.slots != NULL && index == list->size - 1 && list->cursor == ARRAY_LIST_NPOS) {
+    size_t* slot = ArrayList_hashFind(&list->index, list, ArrayList_element(list, index));
+    if (*slot == index) {
+      ArrayList_hashErase(&list->index, list, slot);
+    }
+  } else {
+    ArrayList_dropIndex(list);
+  }
+
+  // If the gap buffer is open, move the gap to just after the element and
+  // grow it backwards over the element.
+  if (list->cursor != ARRAY_LIST_NPOS) {
+    ArrayList_moveGap(list, index + 1);
+    list->cursor--;
+    list->size--;
+    return true;
+  }
+
+  // Shift the elements after the index down by one.
+  memmove(ArrayList_slot(list, index), ArrayList_slot(list, index + 1), ArrayList_slotSize(list) * (list->size - index - 1));
+  list->size--;
+  ArrayList_shrinkIfSparse(list);
+  return true;
+}
+
+/**
+ * Removes the element at the given index from the given array list in O(1) by
+ * moving the last element into its place. The order of the remaining elements
+ * is not kept.
+ * The data is not freed, but rather the pointer to the data is removed 
+ * from the array list.
+ * 
+ * @param ArrayList* The array list to remove the element from.
+ * @param size_t     The index of the element to remove.
+ * @return true if the element was removed successfully, false if the index is
+ *         out of bounds or the element is already marked removed.
+*/
+bool ArrayList_swapRemove(ArrayList* list, size_t index) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  // If the collection is NULL, return false.
+  if (list->collection == NULL) {
+    return false;
+  }
+
+  // If the index is out of bounds, or the element is already marked removed,
+  // return false.
+  if (index >= list->size || ArrayList_isMarked(list, index)) {
+    return false;
+  }
+
+  // The index counts the marked elements, so move it along with them as they
+  // are squeezed out.
+  index = ArrayList_squeezedIndex(list, index);
+  ArrayList_makeContiguous(list);
+  ArrayList_dropIndex(list);
+
+  // Move the last element into the hole.
+  memmove(ArrayList_slot(list, index), ArrayList_slot(list, list->size - 1), ArrayList_slotSize(list));
+  list->size--;
+  ArrayList_shrinkIfSparse(list);
+  return true;
+}
+
+/**
+ * Removes the elements in the given range from the given array list.
+ * The elements after the range are shifted down with a single memmove, and the
+ * collection keeps its capacity until the list becomes sparse.
+ * The data is not freed, but rather the pointers to the data are removed from
+ * the array list.
+ * 
+ * @param ArrayList* The array list to remove the elements from.
+ * @param size_t     The index of the first element to remove.
+ * @param size_t     The index one past the last element to remove.
+ * @return true if the elements were removed successfully, false otherwise.
+*/
+bool ArrayList_removeRange(ArrayList* list, size_t from, size_t to) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  // If the collection is NULL, return false.
+  if (list->collection == NULL) {
+    return false;
+  }
+
+  // If the range is out of bounds, return false.
+  if (to > list->size || from > to) {
+    return false;
+  }
+
+  // The range counts the marked elements, so move it along with them as they
+  // are squeezed out.
+  from = ArrayList_squeezedIndex(list, from);
+  to = ArrayList_squeezedIndex(list, to);
+  ArrayList_makeContiguous(list);
+  ArrayList_dropIndex(list);
+
+  // Close the gap left by the removed elements.
+  memmove(ArrayList_slot(list, from), ArrayList_slot(list, to), ArrayList_slotSize(list) * (list->size - to));
+  list->size -= to - from;
+  ArrayList_shrinkIfSparse(list);
+  return true;
+}
+
+/**
+ * Marks the element at the given index of the given array list as removed,
+ * without moving any element, in O(1). The element stays in the list, and
+ * keeps counting towards its size, but ArrayList_get() skips it by returning
+ * NULL, so a batch of scattered indices can be removed without the indices
+ * shifting between calls. The marked elements are squeezed out in a single
+ * linear pass by ArrayList_compact(), or first thing by any function that
+ * moves elements by position or searches the list, and by ArrayList_add() when
+ * the list is full and at least 1 / ARRAY_LIST_COMPACT_THRESHOLD of it is
+ * marked.
+ * Until then, the indices given to the other functions count the marked
+ * elements, so an index means the same element before and after the squeeze,
+ * and the size of the list is still a valid index to append at. An index
+ * returned by a function that squeezed the list, such as ArrayList_indexOf()
+ * or ArrayList_lowerBound(), is an index into the squeezed list.
+ * 
+ * @param ArrayList* The array list to mark the element in.
+ * @param size_t     The index of the element to mark.
+ * @return true if the element was marked, false if it was already marked, or
+ *         the index is out of bounds, or the memory allocation failed.
+*/
+bool ArrayList_markRemoved(ArrayList* list, size_t index) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  // If the index is out of bounds, or the element is already marked, return
+  // false.
+  if (index >= list->size || ArrayList_isMarked(list, index)) {
+    return false;
+  }
+
+  // Grow the bitmap to cover the whole collection, so a batch of marks only
+  // allocates once.
+  if (index / 64 >= list->tombstone_words) {
+    size_t words = list->capacity / 64 + 1;
+    uint64_t* tombstones = realloc(list->tombstones, sizeof(uint64_t) * words);
+    // If the memory allocation failed, return false.
+    if (tombstones == NULL) {
+      return false;
+    }
+    memset(tombstones + list->tombstone_words, 0, sizeof(uint64_t) * (words - list->tombstone_words));
+    list->tombstones = tombstones;
+    list->tombstone_words = words;
+  }
+
+  list->tombstones[index / 64] |= (uint64_t) 1 << (index % 64);
+  list->removed++;
+  return true;
+}
+
+/**
+ * Checks if the element at the given index of the given array list is marked
+ * removed by ArrayList_markRemoved().
+ * 
+ * @param ArrayList* The array list to check.
+ * @param size_t     The index of the element to check.
+ * @return true if the element is marked removed, false otherwise.
+*/
+bool ArrayList_isRemoved(ArrayList* list, size_t index) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  return index < list->size && ArrayList_isMarked(list, index);
+}
+
+/**
+ * Removes every element marked by ArrayList_markRemoved() from the given
+ * array list in one linear pass, keeping the order of the other elements.
+ * The collection keeps its capacity until the list becomes sparse.
+ * 
+ * @param ArrayList* The array list to compact.
+ * @return true if the array list was compacted, false otherwise.
+*/
+bool ArrayList_compact(ArrayList* list) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  // If the collection is NULL, return false.
+  if (list->collection == NULL) {
+    return false;
+  }
+
+  ArrayList_makeContiguous(list);
+  ArrayList_shrinkIfSparse(list);
+  return true;
+}
+
+/**
+ * Calls the given function with each element from one index up to another,
+ * walking the collection directly.
+ * 
+ * @param ArrayList*        The array list to walk.
+ * @param size_t            The index of the first element.
+ * @param size_t            The index one past the last element.
+ * @param ArrayList_Visitor The function to call with each element.
+ * @param void*             The context pointer passed to the function.
+*/
+static void ArrayList_visitRange(ArrayList* list, size_t from, size_t to, ArrayList_Visitor visit, void* context) {
+  if (list->elem_size > 0) {
+    unsigned char* value = (unsigned char*) list->collection + from * list->elem_size;
+    for (size_t i = from; i < to; i++, value += list->elem_size) {
+      visit(value, context);
+    }
+  } else {
+    for (size_t i = from; i < to; i++) {
+      visit(list->collection[i], context);
+    }
+  }
+}
+
+/**
+ * Calls the given function with every element of the given array list, in
+ * order, skipping the elements marked removed. The collection is walked
+ * directly, so the list is only checked once rather than once per element as
+ * with a loop over ArrayList_get(). The function must not change the list.
+ * 
+ * @param ArrayList*        The array list to walk.
+ * @param ArrayList_Visitor The function to call with each element.
+ * @param void*             The context pointer passed to the function.
+ * @return true if the array list was walked, false otherwise.
+*/
+bool ArrayList_forEach(ArrayList* list, ArrayList_Visitor visit, void* context) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  // If the collection or the function is NULL, return false.
+  if (list->collection == NULL || visit == NULL) {
+    return false;
+  }
+
+  // Walk each run of elements between the marked ones.
+  ArrayList_finishMigration(list);
+  ArrayList_closeGap(list);
+  size_t index = 0;
+  while (index < list->size) {
+    size_t marked = ArrayList_nextMarked(list, index);
+    ArrayList_visitRange(list, index, marked, visit, context);
+    index = marked + 1;
+  }
+  return true;
+}
+
+/**
+ * Removes every element of the given array list that the given predicate
+ * rejects, keeping the order of the others, in a single pass that moves each
+ * kept element at most once. The elements marked removed are squeezed out in
+ * the same pass. The collection keeps its capacity until the list becomes
+ * sparse. The predicate must not change the list.
+ * 
+ * @param ArrayList*          The array list to filter.
+ * @param ArrayList_Predicate The function that returns true for the elements
+ *                            to keep.
+ * @param void*               The context pointer passed to the predicate.
+ * @return true if the array list was filtered, false otherwise.
+*/
+bool ArrayList_retainIf(ArrayList* list, ArrayList_Predicate keep, void* context) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  // If the collection or the predicate is NULL, return false.
+  if (list->collection == NULL || keep == NULL) {
+    return false;
+  }
+
+  ArrayList_finishMigration(list);
+  ArrayList_closeGap(list);
+  ArrayList_dropIndex(list);
+
+  // Copy each kept element down over the ones dropped before it.
+  size_t kept = 0;
+  if (list->elem_size > 0) {
+    unsigned char* bytes = (unsigned char*) list->collection;
+    size_t elem_size = list->elem_size;
+    for (size_t i = 0; i < list->size; i++) {
+      if (!ArrayList_isMarked(list, i) && keep(bytes + i * elem_size, context)) {
+        if (kept != i) {
+          memcpy(bytes + kept * elem_size, bytes + i * elem_size, elem_size);
+        }
+        kept++;
+      }
+    }
+  } else {
+    for (size_t i = 0; i < list->size; i++) {
+      if (!ArrayList_isMarked(list, i) && keep(list->collection[i], context)) {
+        list->collection[kept++] = list->collection[i];
+      }
+    }
+  }
+
+  // Every marked element has been dropped, so the bitmap is no longer needed.
+  list->size = kept;
+  free(list->tombstones);
+  list->tombstones = NULL;
+  list->tombstone_words = 0;
+  list->removed = 0;
+  ArrayList_shrinkIfSparse(list);
+  return true;
+}
+
+/**
+ * Replaces every element of the given array list with the result of the given
+ * function, in order, skipping the elements marked removed. For an array list
+ * of values, the value the result points to is copied over the element, and
+ * a NULL result leaves the element as it is. The function must not change the
+ * list.
+ * 
+ * @param ArrayList*       The array list to map.
+ * @param ArrayList_Mapper The function that gives each replacement.
+ * @param void*            The context pointer passed to the function.
+ * @return true if the array list was mapped, false otherwise.
+*/
+bool ArrayList_map(ArrayList* list, ArrayList_Mapper map, void* context) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  // If the collection or the function is NULL, return false.
+  if (list->collection == NULL || map == NULL) {
+    return false;
+  }
+
+  ArrayList_finishMigration(list);
+  ArrayList_closeGap(list);
+  ArrayList_dropIndex(list);
+  size_t index = 0;
+  while (index < list->size) {
+    size_t marked = ArrayList_nextMarked(list, index);
+    if (list->elem_size > 0) {
+      for (; index < marked; index++) {
+        void* value = ArrayList_slot(list, index);
+        void* result = map(value, context);
+        if (result != NULL && result != value) {
+          memcpy(value, result, list->elem_size);
+        }
+      }
+    } else {
+      for (; index < marked; index++) {
+        list->collection[index] = map(list->collection[index], context);
+      }
+    }
+    index = marked + 1;
+  }
+  return true;
+}
+
+/**
+ * Gets the element at the given index from the given array list.
+ * The data is not copied, but rather the pointer to the data is returned.
+ * For an array list of values, the address of the value in the collection is
+ * returned, which is only valid until the array list is next modified, or
+ * until the next get while an incremental resize is in progress.
+ * 
+ * @param ArrayList* The array list to get the element from.
+ * @param size_t     The index of the element to get.
+ * @return The element at the given index, or NULL if the index is out of bounds
+ *         or the element is marked removed.
+*/
+void* ArrayList_get(ArrayList* list, size_t index) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  // If the collection is NULL, return false.
+  if (list->collection == NULL) {
+    return false;
+  }
+
+  // If the index is out of bounds, or the element is marked removed, return
+  // NULL.
+  if (index >= list->size || ArrayList_isMarked(list, index)) {
+    return NULL;
+  }
+
+  // Move a few of the elements left in the old collection, then read the
+  // element from the old collection if it has not been moved yet.
+  ArrayList_migrate(list, ARRAY_LIST_INCREMENTAL_STEP);
+  if (list->old_collection != NULL && index >= list->migrated && index < list->migrate_end) {
+    if (list->elem_size > 0) {
+      return (unsigned char*) list->old_collection + index * list->elem_size;
+    }
+    return list->old_collection[index];
+  }
+
+  // Elements after the gap are stored past it.
+  if (list->cursor != ARRAY_LIST_NPOS && index >= list->cursor) {
+    return ArrayList_element(list, index + ArrayList_gapSize(list));
+  }
+
+  return ArrayList_element(list, index);
+}
+
+/**
+ * Gets the size of the given array list.
+ * 
+ * @param ArrayList* The array list to get the size of.
+ * @return The size of the given array list, or ARRAY_LIST_NPOS if the array
+ *         list is NULL.
+*/
+size_t ArrayList_size(ArrayList* list) {
+  // If the list is NULL, return ARRAY_LIST_NPOS.
+  if (list == NULL) {
+    return ARRAY_LIST_NPOS;
+  }
+
+  return list->size;
+}
+
+/**
+ * Checks if the array list is empty.
+ * 
+ * @param ArrayList* The array list to check.
+ * @return true if the array list is empty, false otherwise.
+*/
+bool ArrayList_isEmpty(ArrayList* list) {
+  // If the list is NULL, return true.
+  if (list == NULL) {
+    return true;
+  }
+
+  return list->size == 0;
+}
+
+/**
+ * The functions used to search the collection of an array list for a pointer.
+ * Each implementation returns the same results; they only differ in how many
+ * pointers are compared per instruction.
+*/
+typedef struct ArrayList_SearchKernels {
+  const char* name;
+  size_t (*find)(void**, size_t, void*);
+  size_t (*findLast)(void**, size_t, void*);
+  size_t (*count)(void**, size_t, void*);
+} ArrayList_SearchKernels;
+
+/**
+ * Finds the first slot of the given collection holding the given pointer,
+ * comparing one pointer at a time.
+ * 
+ * @param void** The collection to search.
+ * @param size_t The number of elements in the collection.
+ * @param void*  The pointer to search for.
+ * @return The index of the first match, or ARRAY_LIST_NPOS if there is no match.
+*/
+static size_t ArrayList_findScalar(void** items, size_t size, void* data) {
+  for (size_t i = 0; i < size; i++) {
+    if (items[i] == data) {
+      return i;
+    }
+  }
+  return ARRAY_LIST_NPOS;
+}
+
+/**
+ * Finds the last slot of the given collection holding the given pointer,
+ * comparing one pointer at a time.
+ * 
+ * @param void** The collection to search.
+ * @param size_t The number of elements in the collection.
+ * @param void*  The pointer to search for.
+ * @return The index of the last match, or ARRAY_LIST_NPOS if there is no match.
+*/
+static size_t ArrayList_findLastScalar(void** items, size_t size, void* data) {
+  for (size_t i = size; i-- > 0;) {
+    if (items[i] == data) {
+      return i;
+    }
+  }
+  return ARRAY_LIST_NPOS;
+}
+
+/**
+ * Counts the slots of the given collection holding the given pointer,
+ * comparing one pointer at a time.
+ * 
+ * @param void** The collection to search.
+ * @param size_t The number of elements in the collection.
+ * @param void*  The pointer to count.
+ * @return The number of matches.
+*/
+static size_t ArrayList_countScalar(void** items, size_t size, void* data) {
+  size_t count = 0;
+  for (size_t i = 0; i < size; i++) {
+    count += items[i] == data;
+  }
+  return count;
+}
+
+static const ArrayList_SearchKernels ArrayList_scalarKernels = {
+  "scalar", ArrayList_findScalar, ArrayList_findLastScalar, ArrayList_countScalar
+};
+
+#ifdef ARRAY_LIST_X86_SIMD
+
+/**
+ * Compares two pointers against the needle using SSE2. SSE2 has no 64-bit
+ * equality, so the 32-bit halves are compared and a pointer only matches when
+ * both of its halves do.
+ * 
+ * @return A mask with bit n set if pointer n of the block matches.
+*/
+__attribute__((target("sse2")))
+static inline int ArrayList_matchSse2(void** items, __m128i needle) {
+  __m128i equal = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*) items), needle);
+  equal = _mm_and_si128(equal, _mm_shuffle_epi32(equal, _MM_SHUFFLE(2, 3, 0, 1)));
+  return _mm_movemask_pd(_mm_castsi128_pd(equal));
+}
+
+__attribute__((target("sse2")))
+static size_t ArrayList_findSse2(void** items, size_t size, void* data) {
+  __m128i needle = _mm_set1_epi64x((long long) (intptr_t) data);
+  size_t i = 0;
+  for (; i + 2 <= size; i += 2) {
+    int mask = ArrayList_matchSse2(&items[i], needle);
+    if (mask != 0) {
+      return i + (size_t) __builtin_ctz(mask);
+    }
+  }
+  return i < size && items[i] == data ? i : ARRAY_LIST_NPOS;
+}
+
+__attribute__((target("sse2")))
+static size_t ArrayList_findLastSse2(void** items, size_t size, void* data) {
+  __m128i needle = _mm_set1_epi64x((long long) (intptr_t) data);
+  size_t i = size;
+  for (; i >= 2; i -= 2) {
+    int mask = ArrayList_matchSse2(&items[i - 2], needle);
+    if (mask != 0) {
+      return i - 2 + (size_t) (31 - __builtin_clz(mask));
+    }
+  }
+  return i == 1 && items[0] == data ? 0 : ARRAY_LIST_NPOS;
+}
+
+__attribute__((target("sse2")))
+static size_t ArrayList_countSse2(void** items, size_t size, void* data) {
+  __m128i needle = _mm_set1_epi64x((long long) (intptr_t) data);
+  size_t count = 0;
+  size_t i = 0;
+  for (; i + 2 <= size; i += 2) {
+    count += (size_t) __builtin_popcount(ArrayList_matchSse2(&items[i], needle));
+  }
+  return count + (i < size && items[i] == data);
+}
+
+static const ArrayList_SearchKernels ArrayList_sse2Kernels = {
+  "sse2", ArrayList_findSse2, ArrayList_findLastSse2, ArrayList_countSse2
+};
+
+/**
+ * Compares four pointers against the needle using AVX2.
+ * 
+ * @return A mask with bit n set if pointer n of the block matches.
+*/
+__attribute__((target("avx2")))
+static inline int ArrayList_matchAvx2(void** items, __m256i needle) {
+  __m256i equal = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i*) items), needle);
+  return _mm256_movemask_pd(_mm256_castsi256_pd(equal));
+}
+
+__attribute__((target("avx2")))
+static size_t ArrayList_findAvx2(void** items, size_t size, void* data) {
+  __m256i needle = _mm256_set1_epi64x((long long) (intptr_t) data);
+  size_t i = 0;
+  // Check sixteen pointers per iteration and only locate the match once found.
+  for (; i + 16 <= size; i += 16) {
+    __m256i a = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i*) &items[i]), needle);
+    __m256i b = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i*) &items[i + 4]), needle);
+    __m256i c = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i*) &items[i + 8]), needle);
+    __m256i d = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i*) &items[i + 12]), needle);
+    if (!_mm256_testz_si256(_mm256_or_si256(_mm256_or_si256(a, b), _mm256_or_si256(c, d)), _mm256_set1_epi8(-1))) {
+      break;
+    }
+  }
+  for (; i + 4 <= size; i += 4) {
+    int mask = ArrayList_matchAvx2(&items[i], needle);
+    if (mask != 0) {
+      return i + (size_t) __builtin_ctz(mask);
+    }
+  }
+  for (; i < size; i++) {
+    if (items[i] == data) {
+      return i;
+    }
+  }
+  return ARRAY_LIST_NPOS;
+}
+
+__attribute__((target("avx2")))
+static size_t ArrayList_findLastAvx2(void** items, size_t size, void* data) {
+  __m256i needle = _mm256_set1_epi64x((long long) (intptr_t) data);
+  size_t i = size;
+  for (; i >= 4; i -= 4) {
+    int mask = ArrayList_matchAvx2(&items[i - 4], needle);
+    if (mask != 0) {
+      return i - 4 + (size_t) (31 - __builtin_clz(mask));
+    }
+  }
+  return ArrayList_findLastScalar(items, i, data);
+}
+
+__attribute__((target("avx2")))
+static size_t ArrayList_countAvx2(void** items, size_t size, void* data) {
+  __m256i needle = _mm256_set1_epi64x((long long) (intptr_t) data);
+  // Matching lanes are all ones, so subtracting them counts matches per lane.
+  __m256i counts = _mm256_setzero_si256();
+  size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    counts = _mm256_sub_epi64(counts, _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i*) &items[i]), needle));
+  }
+  long long lanes[4];
+  _mm256_storeu_si256((__m256i*) lanes, counts);
+  size_t count = (size_t) (lanes[0] + lanes[1] + lanes[2] + lanes[3]);
+  return count + ArrayList_countScalar(&items[i], size - i, data);
+}
+
+static const ArrayList_SearchKernels ArrayList_avx2Kernels = {
+  "avx2", ArrayList_findAvx2, ArrayList_findLastAvx2, ArrayList_countAvx2
+};
+
+__attribute__((target("avx512f")))
+static size_t ArrayList_findAvx512(void** items, size_t size, void* data) {
+  __m512i needle = _mm512_set1_epi64((long long) (intptr_t) data);
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    __mmask8 mask = _mm512_cmpeq_epi64_mask(_mm512_loadu_si512(&items[i]), needle);
+    if (mask != 0) {
+      return i + (size_t) __builtin_ctz(mask);
+    }
+  }
+  // The tail is compared with a masked load so nothing past the end is read.
+  __mmask8 tail = (__mmask8) ((1u << (size - i)) - 1);
+  __mmask8 mask = _mm512_mask_cmpeq_epi64_mask(tail, _mm512_maskz_loadu_epi64(tail, &items[i]), needle);
+  return mask != 0 ? i + (size_t) __builtin_ctz(mask) : ARRAY_LIST_NPOS;
+}
+
+__attribute__((target("avx512f")))
+static size_t ArrayList_findLastAvx512(void** items, size_t size, void* data) {
+  __m512i needle = _mm512_set1_epi64((long long) (intptr_t) data);
+  size_t i = size;
+  for (; i >= 8; i -= 8) {
+    __mmask8 mask = _mm512_cmpeq_epi64_mask(_mm512_loadu_si512(&items[i - 8]), needle);
+    if (mask != 0) {
+      return i - 8 + (size_t) (31 - __builtin_clz(mask));
+    }
+  }
+  __mmask8 tail = (__mmask8) ((1u << i) - 1);
+  __mmask8 mask = _mm512_mask_cmpeq_epi64_mask(tail, _mm512_maskz_loadu_epi64(tail, items), needle);
+  return mask != 0 ? (size_t) (31 - __builtin_clz(mask)) : ARRAY_LIST_NPOS;
+}
+
+__attribute__((target("avx512f")))
+static size_t ArrayList_countAvx512(void** items, size_t size, void* data) {
+  __m512i needle = _mm512_set1_epi64((long long) (intptr_t) data);
+  size_t count = 0;
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    count += (size_t) __builtin_popcount(_mm512_cmpeq_epi64_mask(_mm512_loadu_si512(&items[i]), needle));
+  }
+  __mmask8 tail = (__mmask8) ((1u << (size - i)) - 1);
+  return count + (size_t) __builtin_popcount(_mm512_mask_cmpeq_epi64_mask(tail, _mm512_maskz_loadu_epi64(tail, &items[i]), needle));
+}
+
+static const ArrayList_SearchKernels ArrayList_avx512Kernels = {
+  "avx512", ArrayList_findAvx512, ArrayList_findLastAvx512, ArrayList_countAvx512
+};
+
+#endif /* ARRAY_LIST_X86_SIMD */
+
+/**
+ * Picks the widest search implementation the running CPU supports. Short
+ * collections are searched with the scalar loop, as they are not worth the
+ * set up cost of the vector kernels.
+ * 
+ * @param size_t The number of elements that will be searched.
+ * @return The search kernels to use.
+*/
+static const ArrayList_SearchKernels* ArrayList_searchKernels(size_t size) {
+  if (size < ARRAY_LIST_SIMD_THRESHOLD) {
+    return &ArrayList_scalarKernels;
+  }
+#ifdef ARRAY_LIST_X86_SIMD
+  if (__builtin_cpu_supports("avx512f")) {
+    return &ArrayList_avx512Kernels;
+  }
+  if (__builtin_cpu_supports("avx2")) {
+    return &ArrayList_avx2Kernels;
+  }
+  return &ArrayList_sse2Kernels;
+#else
+  return &ArrayList_scalarKernels;
+#endif
+}
+
+/**
+ * Gets the name of the search implementation used by ArrayList_contains(),
+ * ArrayList_indexOf(), ArrayList_lastIndexOf() and ArrayList_count() on this
+ * CPU, such as "avx2" or "scalar".
+ * 
+ * @return The name of the search implementation.
+*/
+const char* ArrayList_searchImplementation() {
+  return ArrayList_searchKernels(SIZE_MAX)->name;
+}
+
+/**
+ * Finds the first or last value of the given array list of values that is
+ * byte for byte equal to the given value.
+ * 
+ * @param ArrayList* The array list of values to search.
+ * @param void*      The pointer to the value to search for.
+ * @param bool       true to find the last match rather than the first.
+ * @return The index of the match, or ARRAY_LIST_NPOS if there is none.
+*/
+static size_t ArrayList_findValue(ArrayList* list, void* data, bool last) {
+  size_t elem_size = list->elem_size;
+  unsigned char* values = (unsigned char*) list->collection;
+  for (size_t i = 0; i < list->size; i++) {
+    size_t index = last ? list->size - 1 - i : i;
+    if (memcmp(values + index * elem_size, data, elem_size) == 0) {
+      return index;
+    }
+  }
+  return ARRAY_LIST_NPOS;
+}
+
+/**
+ * Counts the values of the given array list of values that are byte for byte
+ * equal to the given value.
+ * 
+ * @param ArrayList* The array list of values to search.
+ * @param void*      The pointer to the value to count.
+ * @return The number of matches.
+*/
+static size_t ArrayList_countValues(ArrayList* list, void* data) {
+  size_t elem_size = list->elem_size;
+  unsigned char* values = (unsigned char*) list->collection;
+  size_t count = 0;
+  for (size_t i = 0; i < list->size; i++) {
+    count += memcmp(values + i * elem_size, data, elem_size) == 0;
+  }
+  return count;
+}
+
+/**
+ * Checks if the array list contains the given element.
+ * The data stored is a void pointer, so the data is not compared directly
+ * but rather the pointers to the data are compared. For an array list of
+ * values, the value the data points to is compared byte for byte instead.
+ * 
+ * @param ArrayList* The array list to check.
+ * @param void*      The data to check for.
+ * @return true if the array list contains the given element, false otherwise.
+*/
+bool ArrayList_contains(ArrayList* list, void* data) {
+  return ArrayList_indexOf(list, data) != ARRAY_LIST_NPOS;
+}
+
+/**
+ * Gets the index of the given element in the given array list.
+ * The data stored is a void pointer, so the data is not compared directly
+ * but rather the pointers to the data are compared. For an array list of
+ * values, the value the data points to is compared byte for byte instead.
+ * 
+ * @param ArrayList* The array list to search.
+ * @param void*      The data to search for.
+ * @return The index of the given element in the given array list, or
+ *         ARRAY_LIST_NPOS if the element is not found.
+*/
+size_t ArrayList_indexOf(ArrayList* list, void* data) {
+  // If the list is NULL, return ARRAY_LIST_NPOS.
+  if (list == NULL) {
+    return ARRAY_LIST_NPOS;
+  }
+
+  // If the collection is NULL, return ARRAY_LIST_NPOS.
+  if (list->collection == NULL) {
+    return ARRAY_LIST_NPOS;
+  }
+
+  ArrayList_makeContiguous(list);
+
+  // If the list stores values, and there is no value to look for, return
+  // ARRAY_LIST_NPOS.
+  if (list->elem_size > 0 && data == NULL) {
+    return ARRAY_LIST_NPOS;
+  }
+
+  // Look the element up in the side index, building it if it is needed.
+  if (list->indexed && list->size >= ARRAY_LIST_INDEX_THRESHOLD) {
+    if (list->index.slots != NULL || ArrayList_hashBuild(&list->index, list, list->size)) {
+      return *ArrayList_hashFind(&list->index, list, data);
+    }
+  }
+
+  // If the list stores values, compare them with the value the data points to.
+  if (list->elem_size > 0) {
+    return ArrayList_findValue(list, data, false);
+  }
+
+  return ArrayList_searchKernels(list->size)->find(list->collection, list->size, data);
+}
+
+/**
+ * Gets the index of the last occurrence of the given element in the given
+ * array list. The pointers to the data are compared, not the data itself,
+ * except in an array list of values where the values are compared byte for
+ * byte.
+ * 
+ * @param ArrayList* The array list to search.
+ * @param void*      The data to search for.
+ * @return The index of the last occurrence of the given element, or
+ *         ARRAY_LIST_NPOS if the element is not found.
+*/
+size_t ArrayList_lastIndexOf(ArrayList* list, void* data) {
+  // If the list is NULL, return ARRAY_LIST_NPOS.
+  if (list == NULL) {
+    return ARRAY_LIST_NPOS;
+  }
+
+  // If the collection is NULL, return ARRAY_LIST_NPOS.
+  if (list->collection == NULL) {
+    return ARRAY_LIST_NPOS;
+  }
+
+  ArrayList_makeContiguous(list);
+
+  // If the list stores values, compare them with the value the data points to.
+  if (list->elem_size > 0) {
+    return data == NULL ? ARRAY_LIST_NPOS : ArrayList_findValue(list, data, true);
+  }
+
+  return ArrayList_searchKernels(list->size)->findLast(list->collection, list->size, data);
+}
+
+/**
+ * Counts the occurrences of the given element in the given array list.
+ * The pointers to the data are compared, not the data itself, except in an
+ * array list of values where the values are compared byte for byte.
+ * 
+ * @param ArrayList* The array list to search.
+ * @param void*      The data to count.
+ * @return The number of occurrences of the given element, or ARRAY_LIST_NPOS
+ *         if the array list is NULL.
+*/
+size_t ArrayList_count(ArrayList* list, void* data) {
+  // If the list is NULL, return ARRAY_LIST_NPOS.
+  if (list == NULL) {
+    return ARRAY_LIST_NPOS;
+  }
+
+  // If the collection is NULL, return 0.
+  if (list->collection == NULL) {
+    return 0;
+  }
+
+  ArrayList_makeContiguous(list);
+
+  // If the list stores values, compare them with the value the data points to.
+  if (list->elem_size > 0) {
+    return data == NULL ? 0 : ArrayList_countValues(list, data);
+  }
+
+  return ArrayList_searchKernels(list->size)->count(list->collection, list->size, data);
+}
+
+/**
+ * Keeps the elements of the first array list that are, or are not, in the
+ * second, in order, in a single pass over a hash table of the second.
+ * 
+ * @param ArrayList* The array list to filter, which must be contiguous.
+ * @param ArrayList* The array list to look the elements up in, which must be
+ *                   contiguous.
+ * @param bool       true to keep the elements found in the second list, false
+ *                   to keep the others.
+ * @return true if the array list was filtered, false if the memory
+ *         allocation failed.
+*/
+static bool ArrayList_retainFound(ArrayList* list, ArrayList* other, bool found) {
+  ArrayList_dropIndex(list);
+  ArrayList_HashTable table;
+  if (!ArrayList_hashBuild(&table, other, other->size)) {
+    return false;
+  }
+
+  size_t slot_size = ArrayList_slotSize(list);
+  size_t kept = 0;
+  for (size_t i = 0; i < list->size; i++) {
+    if ((*ArrayList_hashFind(&table, other, ArrayList_element(list, i)) != ARRAY_LIST_NPOS) == found) {
+      if (kept != i) {
+        memcpy(ArrayList_slot(list, kept), ArrayList_slot(list, i), slot_size);
+      }
+      kept++;
+    }
+  }
+
+  free(table.slots);
+  list->size = kept;
+  ArrayList_shrinkIfSparse(list);
+  return true;
+}
+
+/**
+ * Checks that the two given array lists can be combined by a set operation,
+ * and makes them both contiguous.
+ * 
+ * @param ArrayList* The first array list.
+ * @param ArrayList* The second array list.
+ * @return true if both lists store pointers, or values of the same size.
+*/
+static bool ArrayList_prepareSetOperation(ArrayList* list, ArrayList* other) {
+  // If either list is NULL, or they store different elements, return false.
+  if (list == NULL || other == NULL || list->collection == NULL || other->collection == NULL || list->elem_size != other->elem_size) {
+    return false;
+  }
+
+  ArrayList_makeContiguous(list);
+  ArrayList_makeContiguous(other);
+  return true;
+}
+
+/**
+ * Removes every element of the given array list that is equal to one before
+ * it, keeping the first occurrence of each in order. A temporary hash table
+ * of the elements kept so far makes this O(n) expected time, rather than the
+ * O(n^2) of calling ArrayList_contains() before every add.
+ * The pointers to the data are compared, not the data itself, except in an
+ * array list of values where the values are compared byte for byte.
+ * 
+ * @param ArrayList* The array list to remove the duplicates from.
+ * @return true if the duplicates were removed, false otherwise.
+*/
+bool ArrayList_unique(ArrayList* list) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  // If the collection is NULL, return false.
+  if (list->collection == NULL) {
+    return false;
+  }
+
+  ArrayList_makeContiguous(list);
+  ArrayList_dropIndex(list);
+
+  ArrayList_HashTable table;
+  // If the memory allocation failed, return false.
+  if (!ArrayList_hashCreate(&table, list->size)) {
+    return false;
+  }
+
+  // The table holds the indices of the kept elements, which are all before
+  // the element being looked up, so moving it down never disturbs them.
+  size_t slot_size = ArrayList_slotSize(list);
+  size_t kept = 0;
+  for (size_t i = 0; i < list->size; i++) {
+    size_t* slot = ArrayList_hashFind(&table, list, ArrayList_element(list, i));
+    if (*slot == ARRAY_LIST_NPOS) {
+      if (kept != i) {
+        memcpy(ArrayList_slot(list, kept), ArrayList_slot(list, i), slot_size);
+      }
+      *slot = kept;
+      kept++;
+    }
+  }
+
+  free(table.slots);
+  list->size = kept;
+  ArrayList_shrinkIfSparse(list);
+  return true;
+}
+
+/**
+ * Removes every element of the first array list that is not in the second, in
+ * O(n + m) expected time using a temporary hash table of the second list. The
+ * order of the kept elements, and any duplicates among them, are kept as well.
+ * Elements are compared as in ArrayList_unique(), so both lists must store
+ * pointers, or values of the same size.
+ * 
+ * @param ArrayList* The array list to keep the common elements of.
+ * @param ArrayList* The array list to look the elements up in.
+ * @return true if the array list was intersected, false otherwise.
+*/
+bool ArrayList_intersect(ArrayList* list, ArrayList* other) {
+  // If the lists cannot be combined, return false.
+  if (!ArrayList_prepareSetOperation(list, other)) {
+    return false;
+  }
+
+  // Every element of a list is in the list itself.
+  if (list == other) {
+    return true;
+  }
+
+  return ArrayList_retainFound(list, other, true);
+}
+
+/**
+ * Removes every element of the first array list that is in the second, in
+ * O(n + m) expected time using a temporary hash table of the second list. The
+ * order of the kept elements is kept.
+ * Elements are compared as in ArrayList_unique(), so both lists must store
+ * pointers, or values of the same size.
+ * 
+ * @param ArrayList* The array list to remove the elements from.
+ * @param ArrayList* The array list of the elements to remove.
+ * @return true if the elements were removed, false otherwise.
+*/
+bool ArrayList_difference(ArrayList* list, ArrayList* other) {
+  // If the lists cannot be combined, return false.
+  if (!ArrayList_prepareSetOperation(list, other)) {
+    return false;
+  }
+
+  // Every element of a list is in the list itself, so none are left.
+  if (list == other) {
+    ArrayList_dropIndex(list);
+    list->size = 0;
+    ArrayList_shrinkIfSparse(list);
+    return true;
+  }
+
+  return ArrayList_retainFound(list, other, false);
+}
+
+/**
+ * Adds each element of the second array list that is not already in the
+ * first to the end of the first, once, in O(n + m) expected time using a
+ * temporary hash table of the first list. Room for the whole of the second
+ * list is reserved up front.
+ * Elements are compared as in ArrayList_unique(), so both lists must store
+ * pointers, or values of the same size.
+ * 
+ * @param ArrayList* The array list to add the elements to.
+ * @param ArrayList* The array list of the elements to add.
+ * @return true if the elements were added, false otherwise.
+*/
+bool ArrayList_union(ArrayList* list, ArrayList* other) {
+  // If the lists cannot be combined, return false.
+  if (!ArrayList_prepareSetOperation(list, other)) {
+    return false;
+  }
+
+  // Every element of a list is already in the list itself.
+  if (list == other) {
+    return true;
+  }
+
+  // If the collection could not grow to hold both lists, return false.
+  if (other->size > SIZE_MAX - list->size || !ArrayList_ensureCapacity(list, list->size + other->size)) {
+    return false;
+  }
+
+  ArrayList_HashTable table;
+  if (!ArrayList_hashBuild(&table, list, list->size + other->size)) {
+    return false;
+  }
+
+  // Add each new element of the other list, and hash it so that it is not
+  // added twice. The side index is simpler to rebuild than to update.
+  ArrayList_dropIndex(list);
+  for (size_t i = 0; i < other->size; i++) {
+    void* element = ArrayList_element(other, i);
+    size_t* slot = ArrayList_hashFind(&table, list, element);
+    if (*slot == ARRAY_LIST_NPOS) {
+      *slot = list->size;
+      memcpy(ArrayList_slot(list, list->size), ArrayList_slot(other, i), ArrayList_slotSize(list));
+      list->size++;
+    }
+  }
+
+  free(table.slots);
+  return true;
+}
+
+/**
+ * Swaps the two given slots of a collection.
+ * 
+ * @param void** The first slot.
+ * @param void** The second slot.
+*/
+static inline void ArrayList_swap(void** a, void** b) {
+  void* temp = *a;
+  *a = *b;
+  *b = temp;
+}
+
+/**
+ * Sorts the given range with an insertion sort, which is the fastest way to
+ * sort the short ranges the quicksort recursion bottoms out in.
+ * 
+ * @param void**               The first slot of the range.
+ * @param void**               The slot one past the end of the range.
+ * @param ArrayList_Comparator The comparator to order the elements with.
+*/
+static void ArrayList_insertionSort(void** begin, void** end, ArrayList_Comparator compare) {
+  if (begin == end) {
+    return;
+  }
+
+  for (void** current = begin + 1; current != end; current++) {
+    void** sift = current;
+    void** sift_1 = current - 1;
+
+    // Shift larger elements right until the current element is in place.
+    if (compare(*sift, *sift_1) < 0) {
+      void* temp = *sift;
+      do {
+        *sift-- = *sift_1;
+      } while (sift != begin && compare(temp, *--sift_1) < 0);
+      *sift = temp;
+    }
+  }
+}
+
+/**
+ * Sorts the given range with an insertion sort that does not check the start
+ * of the range. This relies on the slot before the range holding an element
+ * no greater than any element in the range, which acts as a sentinel.
+ * 
+ * @param void**               The first slot of the range.
+ * @param void**               The slot one past the end of the range.
+ * @param ArrayList_Comparator The comparator to order the elements with.
+*/
+static void ArrayList_unguardedInsertionSort(void** begin, void** end, ArrayList_Comparator compare) {
+  if (begin == end) {
+    return;
+  }
+
+  for (void** current = begin + 1; current != end; current++) {
+    void** sift = current;
+    void** sift_1 = current - 1;
+
+    if (compare(*sift, *sift_1) < 0) {
+      void* temp = *sift;
+      do {
+        *sift-- = *sift_1;
+      } while (compare(temp, *--sift_1) < 0);
+      *sift = temp;
+    }
+  }
+}
+
+/**
+ * Attempts to sort the given range with an insertion sort, giving up once more
+ * than a handful of elements have had to be moved. This finishes nearly sorted
+ * ranges in linear time without risking quadratic behaviour on other ranges.
+ * 
+ * @param void**               The first slot of the range.
+ * @param void**               The slot one past the end of the range.
+ * @param ArrayList_Comparator The comparator to order the elements with.
+ * @return true if the range was sorted, false if the attempt was abandoned.
+*/
+static bool ArrayList_partialInsertionSort(void** begin, void** end, ArrayList_Comparator compare) {
+  if (begin == end) {
+    return true;
+  }
+
+  size_t moves = 0;
+  for (void** current = begin + 1; current != end; current++) {
+    void** sift = current;
+    void** sift_1 = current - 1;
+
+    if (compare(*sift, *sift_1) < 0) {
+      void* temp = *sift;
+      do {
+        *sift-- = *sift_1;
+      } while (sift != begin && compare(temp, *--sift_1) < 0);
+      *sift = temp;
+      moves += (size_t) (current - sift);
+    }
+
+    if (moves > ARRAY_LIST_PARTIAL_INSERTION_LIMIT) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 /**
- * Creates a new list using a dynamic array as the underlying collection.
+ * Restores the heap property below the given root of a max-heap.
  * 
- * @return The new array list, or NULL if the array list could not be created.
+ * @param void**               The first slot of the heap.
+ * @param size_t               The index of the root to sift down.
+ * @param size_t               The number of elements in the heap.
+ * @param ArrayList_Comparator The comparator to order the elements with.
 */
-ArrayList* new_ArrayList() {
-  ArrayList* list = malloc(sizeof(ArrayList));
-  // If the memory allocation failed, return NULL.
-  if (list == NULL) {
-    return NULL;
+static void ArrayList_siftDown(void** heap, size_t root, size_t size, ArrayList_Comparator compare) {
+  void* value = heap[root];
+  size_t child;
+  while ((child = 2 * root + 1) < size) {
+    if (child + 1 < size && compare(heap[child], heap[child + 1]) < 0) {
+      child++;
+    }
+    if (compare(value, heap[child]) >= 0) {
+      break;
+    }
+    heap[root] = heap[child];
+    root = child;
   }
+  heap[root] = value;
+}
 
-  // Initialise the collection.
-  void** new_collection = malloc(sizeof(void*));
-  // If the memory allocation failed, return NULL.
-  if (new_collection == NULL) {
-    return NULL;
+/**
+ * Sorts the given range with a heap sort. This is the fallback used once the
+ * quicksort has seen too many bad partitions, and guarantees O(n log n).
+ * 
+ * @param void**               The first slot of the range.
+ * @param void**               The slot one past the end of the range.
+ * @param ArrayList_Comparator The comparator to order the elements with.
+*/
+static void ArrayList_heapSort(void** begin, void** end, ArrayList_Comparator compare) {
+  size_t size = (size_t) (end - begin);
+  for (size_t i = size / 2; i-- > 0;) {
+    ArrayList_siftDown(begin, i, size, compare);
   }
+  for (size_t i = size; i-- > 1;) {
+    ArrayList_swap(&begin[0], &begin[i]);
+    ArrayList_siftDown(begin, 0, i, compare);
+  }
+}
 
-  // Initialise the list.
-  list->collection = new_collection;
-  list->size = 0;
-  return list;
+/**
+ * Sorts the three given slots.
+ * 
+ * @param void**               The first slot.
+ * @param void**               The second slot.
+ * @param void**               The third slot.
+ * @param ArrayList_Comparator The comparator to order the elements with.
+*/
+static inline void ArrayList_sort3(void** a, void** b, void** c, ArrayList_Comparator compare) {
+  if (compare(*b, *a) < 0) {
+    ArrayList_swap(a, b);
+  }
+  if (compare(*c, *b) < 0) {
+    ArrayList_swap(b, c);
+  }
+  if (compare(*b, *a) < 0) {
+    ArrayList_swap(a, b);
+  }
 }
 
 /**
- * Adds a new element to the end of the given array list.
- * The data is stored in the array list as a void pointer. Note that the data
- * is not copied, but rather the pointer to the data is stored in the array list.
+ * Moves the elements of the right hand side of a block partition to their
+ * matching slots on the left hand side, given the offsets of the elements on
+ * the wrong side of each.
  * 
- * @param ArrayList* The array list to add the element to.
- * @param void*      The pointer to the element to add to the array list.
- * @return true if the element was added successfully, false otherwise.
+ * @param void**          The base slot the left offsets count forwards from.
+ * @param void**          The base slot the right offsets count backwards from.
+ * @param unsigned char*  The offsets of the misplaced elements on the left.
+ * @param unsigned char*  The offsets of the misplaced elements on the right.
+ * @param size_t          The number of elements to exchange.
+ * @param bool            true to use plain swaps, which are needed to keep
+ *                        descending ranges from degrading the sort.
 */
-bool ArrayList_add(ArrayList* list, void* data) {
-  // If the list is NULL, return false.
-  if (list == NULL) {
-    return false;
+static inline void ArrayList_swapOffsets(void** first, void** last, unsigned char* offsets_l, unsigned char* offsets_r, size_t count, bool use_swaps) {
+  if (use_swaps) {
+    for (size_t i = 0; i < count; i++) {
+      ArrayList_swap(first + offsets_l[i], last - offsets_r[i]);
+    }
+  } else if (count > 0) {
+    // Rotate the misplaced elements through one temporary instead of swapping
+    // each pair, which halves the number of stores.
+    void** left = first + offsets_l[0];
+    void** right = last - offsets_r[0];
+    void* temp = *left;
+    *left = *right;
+    for (size_t i = 1; i < count; i++) {
+      left = first + offsets_l[i];
+      *right = *left;
+      right = last - offsets_r[i];
+      *left = *right;
+    }
+    *right = temp;
   }
+}
 
-  // If the collection is NULL, return false.
-  if (list->collection == NULL) {
-    return false;
+/**
+ * Partitions the given range around the pivot stored in its first slot, with
+ * elements equal to the pivot going to the right. The elements on the wrong
+ * side are found a block at a time and their offsets recorded without
+ * branching on the comparison, so the partition does not pay for branch
+ * mispredictions on random data (the BlockQuicksort scheme).
+ * 
+ * @param void**               The first slot of the range, holding the pivot.
+ * @param void**               The slot one past the end of the range.
+ * @param ArrayList_Comparator The comparator to order the elements with.
+ * @param bool*                Set to true if the range was already partitioned.
+ * @return The slot the pivot ended up in.
+*/
+static void** ArrayList_partitionRight(void** begin, void** end, ArrayList_Comparator compare, bool* already_partitioned) {
+  void* pivot = *begin;
+  void** first = begin;
+  void** last = end;
+
+  // Find the first element not less than the pivot, which the median of three
+  // guarantees exists.
+  while (compare(*++first, pivot) < 0);
+
+  // Find the last element less than the pivot. This search has to be guarded
+  // if no element before first was less than the pivot.
+  if (first - 1 == begin) {
+    while (first < last && compare(*--last, pivot) >= 0);
+  } else {
+    while (compare(*--last, pivot) >= 0);
   }
 
-  // If the size is 0, initialise the collection.
-  if (list->size == 0) {
-    list->collection[0] = data;
-    list->size++;
-    return true;
+  *already_partitioned = first >= last;
+  if (!*already_partitioned) {
+    ArrayList_swap(first, last);
+    first++;
+
+    unsigned char offsets_l[ARRAY_LIST_BLOCK_SIZE];
+    unsigned char offsets_r[ARRAY_LIST_BLOCK_SIZE];
+    void** offsets_l_base = first;
+    void** offsets_r_base = last;
+    size_t num_l = 0;
+    size_t num_r = 0;
+    size_t start_l = 0;
+    size_t start_r = 0;
+
+    while (first < last) {
+      // Decide how many unknown elements each side's block will examine.
+      size_t num_unknown = (size_t) (last - first);
+      size_t left_split = num_l == 0 ? (num_r == 0 ? num_unknown / 2 : num_unknown) : 0;
+      size_t right_split = num_r == 0 ? (num_unknown - left_split) : 0;
+      if (left_split > ARRAY_LIST_BLOCK_SIZE) {
+        left_split = ARRAY_LIST_BLOCK_SIZE;
+      }
+      if (right_split > ARRAY_LIST_BLOCK_SIZE) {
+        right_split = ARRAY_LIST_BLOCK_SIZE;
+      }
+
+      // Record the offsets of elements on the wrong side. The offset is always
+      // written, and only kept by advancing the count when it is needed.
+      for (size_t i = 0; i < left_split; i++) {
+        offsets_l[num_l] = (unsigned char) i;
+        num_l += compare(*first, pivot) >= 0;
+        first++;
+      }
+      for (size_t i = 0; i < right_split;) {
+        offsets_r[num_r] = (unsigned char) ++i;
+        num_r += compare(*--last, pivot) < 0;
+      }
+
+      // Exchange as many misplaced pairs as both blocks have.
+      size_t count = num_l < num_r ? num_l : num_r;
+      ArrayList_swapOffsets(offsets_l_base, offsets_r_base, offsets_l + start_l, offsets_r + start_r, count, num_l == num_r);
+      num_l -= count;
+      num_r -= count;
+      start_l += count;
+      start_r += count;
+
+      if (num_l == 0) {
+        start_l = 0;
+        offsets_l_base = first;
+      }
+      if (num_r == 0) {
+        start_r = 0;
+        offsets_r_base = last;
+      }
+    }
+
+    // Move any misplaced elements left over in one block across the boundary.
+    if (num_l > 0) {
+      while (num_l-- > 0) {
+        ArrayList_swap(offsets_l_base + offsets_l[start_l + num_l], --last);
+      }
+      first = last;
+    }
+    if (num_r > 0) {
+      while (num_r-- > 0) {
+        ArrayList_swap(offsets_r_base - offsets_r[start_r + num_r], first);
+        first++;
+      }
+      last = first;
+    }
+  }
+
+  // Put the pivot in its final place.
+  void** pivot_position = first - 1;
+  *begin = *pivot_position;
+  *pivot_position = pivot;
+  return pivot_position;
+}
+
+/**
+ * Partitions the given range around the pivot stored in its first slot, with
+ * elements equal to the pivot going to the left. This is used when the pivot
+ * equals the element before the range, so every element equal to the pivot
+ * is put in place at once and runs of equal elements are handled in linear
+ * time.
+ * 
+ * @param void**               The first slot of the range, holding the pivot.
+ * @param void**               The slot one past the end of the range.
+ * @param ArrayList_Comparator The comparator to order the elements with.
+ * @return The slot the pivot ended up in.
+*/
+static void** ArrayList_partitionLeft(void** begin, void** end, ArrayList_Comparator compare) {
+  void* pivot = *begin;
+  void** first = begin;
+  void** last = end;
+
+  while (compare(pivot, *--last) < 0);
+
+  if (last + 1 == end) {
+    while (first < last && compare(pivot, *++first) >= 0);
+  } else {
+    while (compare(pivot, *++first) >= 0);
+  }
+
+  while (first < last) {
+    ArrayList_swap(first, last);
+    while (compare(pivot, *--last) < 0);
+    while (compare(pivot, *++first) >= 0);
+  }
+
+  void** pivot_position = last;
+  *begin = *pivot_position;
+  *pivot_position = pivot;
+  return pivot_position;
+}
+
+/**
+ * Sorts the given range with a pattern-defeating quicksort. Short ranges are
+ * insertion sorted, already partitioned ranges are finished with a bounded
+ * insertion sort, runs of equal elements are split off in one pass, and
+ * unbalanced partitions break up the pattern that caused them. If that keeps
+ * happening, the range is heap sorted instead.
+ * 
+ * @param void**               The first slot of the range.
+ * @param void**               The slot one past the end of the range.
+ * @param ArrayList_Comparator The comparator to order the elements with.
+ * @param int                  The number of unbalanced partitions still allowed.
+ * @param bool                 true if the range is the leftmost one, which has
+ *                             no element before it to act as a sentinel.
+*/
+static void ArrayList_quickSort(void** begin, void** end, ArrayList_Comparator compare, int bad_allowed, bool leftmost) {
+  while (true) {
+    size_t size = (size_t) (end - begin);
+
+    // Insertion sort is faster for short ranges.
+    if (size < ARRAY_LIST_INSERTION_SORT_THRESHOLD) {
+      if (leftmost) {
+        ArrayList_insertionSort(begin, end, compare);
+      } else {
+        ArrayList_unguardedInsertionSort(begin, end, compare);
+      }
+      return;
+    }
+
+    // Choose the pivot as the median of three, or the pseudo-median of nine for
+    // long ranges, and move it to the start of the range.
+    size_t half = size / 2;
+    if (size > ARRAY_LIST_NINTHER_THRESHOLD) {
+      ArrayList_sort3(begin, begin + half, end - 1, compare);
+      ArrayList_sort3(begin + 1, begin + (half - 1), end - 2, compare);
+      ArrayList_sort3(begin + 2, begin + (half + 1), end - 3, compare);
+      ArrayList_sort3(begin + (half - 1), begin + half, begin + (half + 1), compare);
+      ArrayList_swap(begin, begin + half);
+    } else {
+      ArrayList_sort3(begin + half, begin, end - 1, compare);
+    }
+
+    // If the pivot equals the element before the range, every element equal to
+    // the pivot can be put in place at once and only the right needs sorting.
+    if (!leftmost && compare(*(begin - 1), *begin) >= 0) {
+      begin = ArrayList_partitionLeft(begin, end, compare) + 1;
+      continue;
+    }
+
+    bool already_partitioned;
+    void** pivot_position = ArrayList_partitionRight(begin, end, compare, &already_partitioned);
+
+    size_t left_size = (size_t) (pivot_position - begin);
+    size_t right_size = (size_t) (end - (pivot_position + 1));
+    bool unbalanced = left_size < size / 8 || right_size < size / 8;
+
+    if (unbalanced) {
+      // Too many bad partitions, fall back to a guaranteed O(n log n) sort.
+      if (--bad_allowed == 0) {
+        ArrayList_heapSort(begin, end, compare);
+        return;
+      }
+
+      // Swap a few elements around to break up the pattern behind the
+      // unbalanced partition.
+      if (left_size >= ARRAY_LIST_INSERTION_SORT_THRESHOLD) {
+        ArrayList_swap(begin, begin + left_size / 4);
+        ArrayList_swap(pivot_position - 1, pivot_position - left_size / 4);
+        if (left_size > ARRAY_LIST_NINTHER_THRESHOLD) {
+          ArrayList_swap(begin + 1, begin + (left_size / 4 + 1));
+          ArrayList_swap(begin + 2, begin + (left_size / 4 + 2));
+          ArrayList_swap(pivot_position - 2, pivot_position - (left_size / 4 + 1));
+          ArrayList_swap(pivot_position - 3, pivot_position - (left_size / 4 + 2));
+        }
+      }
+      if (right_size >= ARRAY_LIST_INSERTION_SORT_THRESHOLD) {
+        ArrayList_swap(pivot_position + 1, pivot_position + (1 + right_size / 4));
+        ArrayList_swap(end - 1, end - right_size / 4);
+        if (right_size > ARRAY_LIST_NINTHER_THRESHOLD) {
+          ArrayList_swap(pivot_position + 2, pivot_position + (2 + right_size / 4));
+          ArrayList_swap(pivot_position + 3, pivot_position + (3 + right_size / 4));
+          ArrayList_swap(end - 2, end - (1 + right_size / 4));
+          ArrayList_swap(end - 3, end - (2 + right_size / 4));
+        }
+      }
+    } else if (already_partitioned
+        && ArrayList_partialInsertionSort(begin, pivot_position, compare)
+        && ArrayList_partialInsertionSort(pivot_position + 1, end, compare)) {
+      // The range was already partitioned and both sides were nearly sorted.
+      return;
+    }
+
+    // Recurse into the left side and loop on the right side.
+    ArrayList_quickSort(begin, pivot_position, compare, bad_allowed, leftmost);
+    begin = pivot_position + 1;
+    leftmost = false;
+  }
+}
+
+/**
+ * Builds an array of the addresses of the values in the given range of an
+ * array list of values, so they can be ordered without moving the values.
+ * 
+ * @param ArrayList* The array list of values.
+ * @param size_t     The index of the first value.
+ * @param size_t     The index one past the last value.
+ * @return The array of addresses, which must be freed, or NULL if the memory
+ *         allocation failed.
+*/
+static void** ArrayList_valueAddresses(ArrayList* list, size_t from, size_t to) {
+  void** addresses = malloc(sizeof(void*) * (to - from));
+  // If the memory allocation failed, return NULL.
+  if (addresses == NULL) {
+    return NULL;
   }
 
-  // If the size is not 0, reallocate the collection.
-  void** new_collection = realloc(list->collection, sizeof(void*) * (list->size + 1));
+  for (size_t i = from; i < to; i++) {
+    addresses[i - from] = ArrayList_slot(list, i);
+  }
+  return addresses;
+}
+
+/**
+ * Rearranges the values in a range of an array list of values into the order
+ * given by an array of their addresses. Each value is copied once into a
+ * scratch buffer, which is then copied back over the range.
+ * 
+ * @param ArrayList* The array list of values.
+ * @param size_t     The index of the first value of the range.
+ * @param void**     The addresses of the values of the range, in their new order.
+ * @param size_t     The number of values in the range.
+ * @return true if the values were rearranged, false if the memory allocation
+ *         failed, in which case the range is unchanged.
+*/
+static bool ArrayList_gatherValues(ArrayList* list, size_t from, void** addresses, size_t count) {
+  size_t elem_size = list->elem_size;
+  unsigned char* values = malloc(elem_size * count);
   // If the memory allocation failed, return false.
-  if (new_collection == NULL) {
+  if (values == NULL) {
     return false;
   }
 
-  // Add the data to the collection.
-  new_collection[list->size] = data;
-  list->collection = new_collection;
-  list->size++;
+  for (size_t i = 0; i < count; i++) {
+    memcpy(values + i * elem_size, addresses[i], elem_size);
+  }
+  memcpy(ArrayList_slot(list, from), values, elem_size * count);
+  free(values);
   return true;
 }
 
 /**
- * Removes the element at the given index from the given array list.
- * The data is not freed, but rather the pointer to the data is removed 
- * from the array list.
+ * Sorts the given array list in place using the given comparator.
+ * The comparator is given the stored pointers, not pointers to the slots, or
+ * the addresses of the values for an array list of values. An array list of
+ * values is sorted through an array of those addresses, so each value is only
+ * moved once.
+ * The sort is a pattern-defeating quicksort: it runs in O(n log n) in the
+ * worst case, in linear time on sorted, reversed and equal inputs, and is not
+ * stable.
  * 
- * @param ArrayList* The array list to remove the element from.
- * @param int        The index of the element to remove.
- * @return true if the element was removed successfully, false otherwise.
+ * @param ArrayList*           The array list to sort.
+ * @param ArrayList_Comparator The comparator to order the elements with.
+ * @return true if the array list was sorted successfully, false otherwise.
+*/
+bool ArrayList_sort(ArrayList* list, ArrayList_Comparator compare) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  return ArrayList_sortRange(list, 0, list->size, compare);
+}
+
+/**
+ * Sorts the elements in the given range of the given array list in place
+ * using the given comparator. The elements outside the range are not moved.
+ * 
+ * @param ArrayList*           The array list to sort.
+ * @param size_t               The index of the first element to sort.
+ * @param size_t               The index one past the last element to sort.
+ * @param ArrayList_Comparator The comparator to order the elements with.
+ * @return true if the range was sorted successfully, false otherwise.
 */
-bool ArrayList_remove(ArrayList* list, int index) {
+bool ArrayList_sortRange(ArrayList* list, size_t from, size_t to, ArrayList_Comparator compare) {
   // If the list is NULL, return false.
   if (list == NULL) {
     return false;
@@ -100,46 +3425,68 @@ bool ArrayList_remove(ArrayList* list, int index) {
     return false;
   }
 
-  // If the index is out of bounds, return false.
-  if (index < 0 || index >= list->size) {
+  // If the comparator is NULL, return false.
+  if (compare == NULL) {
     return false;
   }
 
-  if (list->size == 1) {
-    list->collection = NULL;
-    list->size--;
+  // If the range is out of bounds, return false.
+  if (to > list->size || from > to) {
+    return false;
+  }
+
+  // The range counts the marked elements, so move it along with them as they
+  // are squeezed out.
+  from = ArrayList_squeezedIndex(list, from);
+  to = ArrayList_squeezedIndex(list, to);
+  ArrayList_makeContiguous(list);
+  ArrayList_dropIndex(list);
+
+  // Allow a number of bad partitions logarithmic in the size of the range.
+  int bad_allowed = 1;
+  for (size_t size = to - from; size > 1; size >>= 1) {
+    bad_allowed++;
+  }
+
+  // If the list stores pointers, sort them in place.
+  if (list->elem_size == 0) {
+    ArrayList_quickSort(&list->collection[from], &list->collection[to], compare, bad_allowed, true);
     return true;
   }
 
-  if (index == 0) {
-    memmove(&list->collection[0], &list->collection[1], sizeof(void*) * (list->size - 1));
-  } else if (index == list->size - 1) {
-    memmove(&list->collection[0], &list->collection[0], sizeof(void*) * (list->size - 1));
-  } else {
-    memmove(&list->collection[index], &list->collection[index + 1], sizeof(void*) * (list->size - index - 1));
+  // Otherwise sort the addresses of the values, then move each value once.
+  if (to - from < 2) {
+    return true;
   }
 
-  // If the size is not 1, reallocate the collection.
-  void** new_collection = realloc(list->collection, sizeof(void*) * (list->size - 1));
+  void** addresses = ArrayList_valueAddresses(list, from, to);
   // If the memory allocation failed, return false.
-  if (new_collection == NULL) {
+  if (addresses == NULL) {
     return false;
   }
 
-  list->collection = new_collection;
-  list->size--;
-  return true;
+  ArrayList_quickSort(addresses, addresses + (to - from), compare, bad_allowed, true);
+  bool sorted = ArrayList_gatherValues(list, from, addresses, to - from);
+  free(addresses);
+  return sorted;
 }
 
 /**
- * Gets the element at the given index from the given array list.
- * The data is not copied, but rather the pointer to the data is returned.
+ * Sorts the given array list in place by the unsigned integer key of each
+ * element, using a stable least significant digit radix sort. The keys are
+ * extracted once into a scratch array and the elements are then distributed
+ * a byte at a time, so the sort runs in linear time and never calls a
+ * comparator. Bytes that are the same for every key are skipped.
+ * An array list of values is sorted through an array of the addresses of the
+ * values, which are then moved into place once.
  * 
- * @param ArrayList* The array list to get the element from.
- * @param int        The index of the element to get.
- * @return The element at the given index, or NULL if the index is out of bounds.
+ * @param ArrayList*            The array list to sort.
+ * @param ArrayList_KeyFunction The function giving the key of an element.
+ * @param int                   The number of low bits of the key to sort by,
+ *                              from 1 to 64. Any higher bits are ignored.
+ * @return true if the array list was sorted successfully, false otherwise.
 */
-void* ArrayList_get(ArrayList* list, int index) {
+bool ArrayList_radixSortByKey(ArrayList* list, ArrayList_KeyFunction key_function, int key_bits) {
   // If the list is NULL, return false.
   if (list == NULL) {
     return false;
@@ -150,107 +3497,317 @@ void* ArrayList_get(ArrayList* list, int index) {
     return false;
   }
 
-  // If the index is out of bounds, return false.
-  if (index < 0 || index >= list->size) {
+  ArrayList_makeContiguous(list);
+  ArrayList_dropIndex(list);
+
+  // If the key function is NULL, or the number of key bits is invalid, return false.
+  if (key_function == NULL || key_bits < 1 || key_bits > 64) {
+    return false;
+  }
+
+  size_t size = list->size;
+  if (size < 2) {
+    return true;
+  }
+
+  // An array list of values is sorted through the addresses of its values.
+  void** elements = list->collection;
+  if (list->elem_size > 0) {
+    elements = ArrayList_valueAddresses(list, 0, size);
+    // If the memory allocation failed, return false.
+    if (elements == NULL) {
+      return false;
+    }
+  }
+
+  // Allocate the scratch keys, and a second copy of the keys and elements to
+  // distribute into on alternate passes.
+  uint64_t* keys = malloc(sizeof(uint64_t) * size * 2);
+  void** items = malloc(sizeof(void*) * size);
+  // If the memory allocation failed, return false.
+  if (keys == NULL || items == NULL) {
+    free(keys);
+    free(items);
+    if (elements != list->collection) {
+      free(elements);
+    }
+    return false;
+  }
+
+  // Extract the keys and count the bytes for every pass in a single scan.
+  int passes = (key_bits + 7) / 8;
+  uint64_t mask = key_bits == 64 ? UINT64_MAX : (UINT64_C(1) << key_bits) - 1;
+  size_t (*counts)[256] = calloc((size_t) passes, sizeof(*counts));
+  // If the memory allocation failed, return false.
+  if (counts == NULL) {
+    free(keys);
+    free(items);
+    if (elements != list->collection) {
+      free(elements);
+    }
     return false;
   }
 
-  return list->collection[index];
+  for (size_t i = 0; i < size; i++) {
+    uint64_t key = key_function(elements[i]) & mask;
+    keys[i] = key;
+    for (int pass = 0; pass < passes; pass++) {
+      counts[pass][(key >> (pass * 8)) & 0xFF]++;
+    }
+  }
+
+  uint64_t* source_keys = keys;
+  uint64_t* target_keys = keys + size;
+  void** source_items = elements;
+  void** target_items = items;
+
+  for (int pass = 0; pass < passes; pass++) {
+    int shift = pass * 8;
+    size_t* count = counts[pass];
+
+    // If every key has the same byte here, the pass would not move anything.
+    if (count[(source_keys[0] >> shift) & 0xFF] == size) {
+      continue;
+    }
+
+    // Turn the counts into the starting offset of each bucket.
+    size_t offset = 0;
+    for (int bucket = 0; bucket < 256; bucket++) {
+      size_t bucket_size = count[bucket];
+      count[bucket] = offset;
+      offset += bucket_size;
+    }
+
+    // Distribute the elements in order, which keeps the sort stable.
+    for (size_t i = 0; i < size; i++) {
+      size_t position = count[(source_keys[i] >> shift) & 0xFF]++;
+      target_keys[position] = source_keys[i];
+      target_items[position] = source_items[i];
+    }
+
+    uint64_t* temp_keys = source_keys;
+    source_keys = target_keys;
+    target_keys = temp_keys;
+    void** temp_items = source_items;
+    source_items = target_items;
+    target_items = temp_items;
+  }
+
+  // If the last pass left the elements in the scratch array, copy them back.
+  if (source_items != elements) {
+    memcpy(elements, source_items, sizeof(void*) * size);
+  }
+
+  free(counts);
+  free(keys);
+  free(items);
+
+  // If the list stores values, move each value into its sorted place.
+  bool sorted = true;
+  if (elements != list->collection) {
+    sorted = ArrayList_gatherValues(list, 0, elements, size);
+    free(elements);
+  }
+  return sorted;
 }
 
 /**
- * Gets the size of the given array list.
+ * Gets the index of the first element of the given sorted array list that
+ * does not come before the given data, using a binary search.
  * 
- * @param ArrayList* The array list to get the size of.
- * @return The size of the given array list, or -1 if the array list is NULL.
+ * @param ArrayList*           The array list to search, sorted by the comparator.
+ * @param void*                The data to search for.
+ * @param ArrayList_Comparator The comparator the array list is sorted by.
+ * @return The index of the first element not less than the data, which is the
+ *         size of the array list if there is none, or ARRAY_LIST_NPOS if the
+ *         array list or comparator is NULL.
 */
-int ArrayList_size(ArrayList* list) {
-  // If the list is NULL, return 0.
+size_t ArrayList_lowerBound(ArrayList* list, void* data, ArrayList_Comparator compare) {
+  // If the list is NULL, return ARRAY_LIST_NPOS.
   if (list == NULL) {
-    return -1;
+    return ARRAY_LIST_NPOS;
   }
 
-  return list->size;
+  // If the collection or comparator is NULL, return ARRAY_LIST_NPOS.
+  if (list->collection == NULL || compare == NULL) {
+    return ARRAY_LIST_NPOS;
+  }
+
+  ArrayList_makeContiguous(list);
+
+  size_t low = 0;
+  size_t count = list->size;
+  while (count > 0) {
+    size_t half = count / 2;
+    if (compare(ArrayList_element(list, low + half), data) < 0) {
+      low += half + 1;
+      count -= half + 1;
+    } else {
+      count = half;
+    }
+  }
+
+  return low;
 }
 
 /**
- * Checks if the array list is empty.
+ * Gets the index of the first element of the given sorted array list that
+ * comes after the given data, using a binary search.
  * 
- * @param ArrayList* The array list to check.
- * @return true if the array list is empty, false otherwise.
+ * @param ArrayList*           The array list to search, sorted by the comparator.
+ * @param void*                The data to search for.
+ * @param ArrayList_Comparator The comparator the array list is sorted by.
+ * @return The index of the first element greater than the data, which is the
+ *         size of the array list if there is none, or ARRAY_LIST_NPOS if the
+ *         array list or comparator is NULL.
 */
-bool ArrayList_isEmpty(ArrayList* list) {
-  // If the list is NULL, return true.
+size_t ArrayList_upperBound(ArrayList* list, void* data, ArrayList_Comparator compare) {
+  // If the list is NULL, return ARRAY_LIST_NPOS.
   if (list == NULL) {
-    return true;
+    return ARRAY_LIST_NPOS;
   }
 
-  return list->size == 0;
+  // If the collection or comparator is NULL, return ARRAY_LIST_NPOS.
+  if (list->collection == NULL || compare == NULL) {
+    return ARRAY_LIST_NPOS;
+  }
+
+  ArrayList_makeContiguous(list);
+
+  size_t low = 0;
+  size_t count = list->size;
+  while (count > 0) {
+    size_t half = count / 2;
+    if (compare(data, ArrayList_element(list, low + half)) >= 0) {
+      low += half + 1;
+      count -= half + 1;
+    } else {
+      count = half;
+    }
+  }
+
+  return low;
 }
 
 /**
- * Checks if the array list contains the given element.
- * The data stored is a void pointer, so the data is not compared directly
- * but rather the pointers to the data are compared.
+ * Finds an element of the given sorted array list equal to the given data,
+ * according to the comparator, in O(log n).
  * 
- * @param ArrayList* The array list to check.
- * @param void*      The data to check for.
- * @return true if the array list contains the given element, false otherwise.
+ * @param ArrayList*           The array list to search, sorted by the comparator.
+ * @param void*                The data to search for.
+ * @param ArrayList_Comparator The comparator the array list is sorted by.
+ * @return The index of the first element equal to the data, or ARRAY_LIST_NPOS
+ *         if there is none.
 */
-bool ArrayList_contains(ArrayList* list, void* data) {
-  // If the list is NULL, return false.
-  if (list == NULL) {
-    return false;
+size_t ArrayList_binarySearch(ArrayList* list, void* data, ArrayList_Comparator compare) {
+  size_t index = ArrayList_lowerBound(list, data, compare);
+  // If the search failed, or ran off the end of the list, return ARRAY_LIST_NPOS.
+  if (index == ARRAY_LIST_NPOS || index == list->size) {
+    return ARRAY_LIST_NPOS;
   }
 
-  // If the collection is NULL, return false.
-  if (list->collection == NULL) {
-    return false;
-  }
+  return compare(ArrayList_element(list, index), data) == 0 ? index : ARRAY_LIST_NPOS;
+}
 
-  // Iterate through the collection.
-  for (int i = 0; i < list->size; i++) {
-    // If the data is found, return true.
-    if (list->collection[i] == data) {
-      return true;
-    }
+/**
+ * Inserts an element into the given sorted array list, keeping it sorted.
+ * The element goes after any elements equal to it, so the insertion order of
+ * equal elements is kept. Note that the data is not copied, but rather the
+ * pointer to the data is stored in the array list. For an array list of
+ * values, the value the pointer points to is copied into the collection.
+ * 
+ * @param ArrayList*           The array list to insert into, sorted by the
+ *                             comparator.
+ * @param void*                The pointer to the element to insert.
+ * @param ArrayList_Comparator The comparator the array list is sorted by.
+ * @return true if the element was inserted successfully, false otherwise.
+*/
+bool ArrayList_insertSorted(ArrayList* list, void* data, ArrayList_Comparator compare) {
+  size_t index = ArrayList_upperBound(list, data, compare);
+  // If the search failed, return false.
+  if (index == ARRAY_LIST_NPOS) {
+    return false;
   }
 
-  // If the data is not found, return false.
-  return false;
+  return ArrayList_insertRange(list, index, &data, 1);
 }
 
 /**
- * Gets the index of the given element in the given array list.
- * The data stored is a void pointer, so the data is not compared directly
- * but rather the pointers to the data are compared.
+ * Merges a sorted series of elements into the given sorted array list in a
+ * single linear pass, keeping it sorted. The merge runs from the back of the
+ * collection, so no scratch memory is needed beyond growing the collection
+ * once. Elements already in the array list come before equal elements from
+ * the series. Note that the data is not copied, but rather the pointers to
+ * the data are stored in the array list. For an array list of values, the
+ * values the pointers point to are copied into the collection.
  * 
- * @param ArrayList* The array list to search.
- * @param void*      The data to search for.
- * @return The index of the given element in the given array list, or -1 if 
- *         the element is not found.
+ * @param ArrayList*           The array list to merge into, sorted by the
+ *                             comparator.
+ * @param void**               The array of pointers to merge, sorted by the
+ *                             comparator, which must not point into the
+ *                             collection of the array list.
+ * @param size_t               The number of pointers to merge.
+ * @param ArrayList_Comparator The comparator the array list is sorted by.
+ * @return true if the elements were merged successfully, false otherwise.
 */
-int ArrayList_indexOf(ArrayList* list, void* data) {
-  // If the list is NULL, return -1.
+bool ArrayList_mergeSorted(ArrayList* list, void** items, size_t count, ArrayList_Comparator compare) {
+  // If the list is NULL, return false.
   if (list == NULL) {
-    return -1;
+    return false;
   }
 
-  // If the collection is NULL, return -1.
-  if (list->collection == NULL) {
-    return -1;
+  // If the collection or comparator is NULL, return false.
+  if (list->collection == NULL || compare == NULL) {
+    return false;
   }
 
-  // Iterate through the collection.
-  for (int i = 0; i < list->size; i++) {
-    // If the data is found, return the index.
-    if (list->collection[i] == data) {
-      return i;
+  ArrayList_makeContiguous(list);
+  ArrayList_dropIndex(list);
+
+  // If there are no items to merge, return false.
+  if (items == NULL && count > 0) {
+    return false;
+  }
+
+  // If the list stores values, and one of them is missing, return false.
+  if (list->elem_size > 0) {
+    for (size_t i = 0; i < count; i++) {
+      if (items[i] == NULL) {
+        return false;
+      }
+    }
+  }
+
+  // If the list would overflow, or the collection cannot grow, return false.
+  if (count > ArrayList_maxCapacity(list) - list->size || !ArrayList_ensureCapacity(list, list->size + count)) {
+    return false;
+  }
+
+  // Fill the collection from the back with the larger of the two heads. The
+  // indices count down from one past the element they refer to.
+  size_t i = list->size;
+  size_t j = count;
+  size_t k = list->size + count;
+  if (list->elem_size == 0) {
+    while (j > 0) {
+      if (i > 0 && compare(list->collection[i - 1], items[j - 1]) > 0) {
+        list->collection[--k] = list->collection[--i];
+      } else {
+        list->collection[--k] = items[--j];
+      }
+    }
+  } else {
+    while (j > 0) {
+      if (i > 0 && compare(ArrayList_slot(list, i - 1), items[j - 1]) > 0) {
+        memcpy(ArrayList_slot(list, --k), ArrayList_slot(list, --i), list->elem_size);
+      } else {
+        memcpy(ArrayList_slot(list, --k), items[--j], list->elem_size);
+      }
     }
   }
 
-  // If the data is not found, return -1.
-  return -1;
+  list->size += count;
+  return true;
 }
 
 /**
@@ -265,9 +3822,11 @@ void ArrayList_print(ArrayList* list) {
     return;
   }
 
+  ArrayList_makeContiguous(list);
+
   printf("[ ");
-  for (int i = 0; i < list->size; i++) {
-    printf("%p ", list->collection[i]);
+  for (size_t i = 0; i < list->size; i++) {
+    printf("%p ", ArrayList_element(list, i));
   }
   printf("]\n");
 }
@@ -284,15 +3843,18 @@ void ArrayList_printInt(ArrayList* list) {
     return;
   }
 
+  ArrayList_makeContiguous(list);
+
   printf("[ ");
-  for (int i = 0; i < list->size; i++) {
-    printf("%d ", *(int*) list->collection[i]);
+  for (size_t i = 0; i < list->size; i++) {
+    printf("%d ", *(int*) ArrayList_element(list, i));
   }
   printf("]\n");
 }
 
 /**
- * Clears the given array list.
+ * Clears the given array list. The collection moves back into the inline
+ * buffer, releasing any memory it held on the heap.
  * 
  * @param ArrayList* The array list to clear.
  * @return true if the array list was cleared successfully, false otherwise.
@@ -308,20 +3870,42 @@ bool ArrayList_clear(ArrayList* list) {
     return false;
   }
 
-  // Reduce the collection.
-  void** new_collection = realloc(list->collection, sizeof(void*));
-  // If the memory allocation failed, return false.
-  if (new_collection == NULL) {
-    return false;
+  // Forget the elements marked removed, and the side index, along with the
+  // rest.
+  free(list->tombstones);
+  list->tombstones = NULL;
+  list->tombstone_words = 0;
+  list->removed = 0;
+  ArrayList_dropIndex(list);
+
+  // A mapped file keeps its collection, and only forgets its values.
+  if (list->fd >= 0) {
+    list->cursor = ARRAY_LIST_NPOS;
+    list->size = 0;
+    return true;
   }
-  list->collection = new_collection;
-  list->collection[0] = NULL;
+
+  // Move the collection back into the inline buffer, freeing it if it is on
+  // the heap, along with any old collection left from an incremental resize.
+  if (!ArrayList_isInline(list)) {
+    ArrayList_release(list->collection, list->mapped);
+    list->collection = list->inline_buffer.pointers;
+    list->mapped = 0;
+  }
+  if (list->old_collection != NULL) {
+    ArrayList_release(list->old_collection, list->old_mapped);
+    list->old_collection = NULL;
+    list->old_mapped = 0;
+  }
+  list->cursor = ARRAY_LIST_NPOS;
+  list->capacity = ArrayList_inlineCapacity(list);
   list->size = 0;
   return true;
 }
 
 /**
- * Frees the given array list.
+ * Frees the given array list. An array list initialised with ArrayList_init()
+ * only has its collection released, as with ArrayList_deinit().
  * 
  * @param ArrayList* The array list to free.
 */
@@ -331,13 +3915,13 @@ void ArrayList_free(ArrayList* list) {
     return;
   }
 
-  // If the collection is NULL, free the list and return.
-  if (list->collection == NULL) {
-    free(list);
+  // If the list was initialised in place, only release its collection.
+  if (!list->allocated) {
+    ArrayList_deinit(list);
     return;
   }
 
-  // Free the collection and the list.
-  free(list->collection);
+  // Release the collection, then free the list.
+  ArrayList_deinit(list);
   free(list);
 }
\ No newline at end of file
@@ -10,6 +10,8 @@
  * as the underlying collection.
  * The data stored in the list are void pointers which are dynamically allocated
  * to the heap.
+ * A list created with new_ArrayListOf() instead stores fixed size values
+ * directly in the collection, so the elements are contiguous in memory.
 */
 
 #ifndef ARRAY_LIST_H
@@ -19,23 +21,378 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include <string.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stddef.h>
 
+/**
+ * The number of elements a new array list of values can hold before it has to
+ * grow, and the capacity a collection on the heap does not shrink below.
+*/
+#define ARRAY_LIST_DEFAULT_CAPACITY 8
+
+/**
+ * The number of pointers held in the small buffer inside the array list
+ * itself. A list starts out using this buffer as its collection, and only
+ * moves to the heap when it grows past it, so small lists need no allocation
+ * for their elements. An array list of values fits as many values in the same
+ * number of bytes as it can.
+*/
+#define ARRAY_LIST_INLINE_CAPACITY 4
+
+/**
+ * The factor the capacity of an array list is multiplied by when it is full.
+*/
+#define ARRAY_LIST_GROWTH_FACTOR 2
+
+/**
+ * Removing elements shrinks the collection once the size of an array list falls
+ * to this fraction of its capacity.
+*/
+#define ARRAY_LIST_SHRINK_THRESHOLD 4
+
+/**
+ * The most slots an add or get moves from the old collection to the new one
+ * while an array list in incremental resize mode is growing.
+*/
+#define ARRAY_LIST_INCREMENTAL_STEP 16
+
+/**
+ * An array list with its side index turned on by ArrayList_setIndexed() only
+ * builds the index once it holds at least this many elements, as scanning a
+ * smaller list is as fast as hashing.
+*/
+#define ARRAY_LIST_INDEX_THRESHOLD 64
+
+/**
+ * When an array list is full and at least 1 / ARRAY_LIST_COMPACT_THRESHOLD of
+ * its elements are marked removed, adding an element compacts the list instead
+ * of growing it.
+*/
+#define ARRAY_LIST_COMPACT_THRESHOLD 2
+
+/**
+ * On Linux, a collection of at least this many bytes is mapped directly from
+ * the kernel with mmap() rather than taken from malloc(), and grows with
+ * mremap(), which moves the pages instead of copying them. Building with
+ * ARRAY_LIST_NO_MMAP defined turns this off.
+*/
+#define ARRAY_LIST_MMAP_THRESHOLD ((size_t) 4 << 20)
+
+/**
+ * Mapped collections are rounded up to, and kept on, a multiple of this size,
+ * so that they can be backed by transparent huge pages. Building
+ * with ARRAY_LIST_HUGE_PAGES defined also asks the kernel for huge pages with
+ * madvise(MADV_HUGEPAGE).
+*/
+#define ARRAY_LIST_HUGE_PAGE_SIZE ((size_t) 2 << 20)
+
+/**
+ * A flag for ArrayList_mapFile() that opens the file read only. The list can
+ * be read and changed in memory, but never grows and never writes to the file.
+*/
+#define ARRAY_LIST_MAP_READ_ONLY 1
+
+/**
+ * A flag for ArrayList_mapFile() that discards the values already in the file.
+*/
+#define ARRAY_LIST_MAP_TRUNCATE 2
+
+/**
+ * The largest number of elements an array list of pointers can hold. An array
+ * list of values can hold SIZE_MAX divided by its element size.
+*/
+#define ARRAY_LIST_MAX_CAPACITY (SIZE_MAX / sizeof(void*))
+
+/**
+ * The value returned in place of an index or size when there is none, such as
+ * when an element is not found or the array list is NULL. It is (size_t) -1,
+ * so it still compares equal to -1 after conversion to int.
+*/
+#define ARRAY_LIST_NPOS ((size_t) -1)
+
+/**
+ * An open addressing hash table of elements of an array list, used by the set
+ * operations and the side index. Each of the mask + 1 slots holds the index of
+ * an element, or ARRAY_LIST_NPOS if it is empty, and count slots are in use.
+*/
+typedef struct ArrayList_HashTable {
+  size_t* slots;
+  size_t mask;
+  size_t count;
+} ArrayList_HashTable;
+
+/**
+ * A function that orders two elements of an array list, given the stored
+ * pointers, or the addresses of the stored values for an array list of values.
+ * It returns a negative number if the first element comes before the second,
+ * zero if they are equal and a positive number otherwise.
+*/
+typedef int (*ArrayList_Comparator)(const void*, const void*);
+
+/**
+ * A function that gives the unsigned integer key of an element of an array
+ * list, given the stored pointer, or the address of the stored value for an
+ * array list of values.
+*/
+typedef uint64_t (*ArrayList_KeyFunction)(const void*);
+
+/**
+ * A function called with each element of an array list, given the stored
+ * pointer, or the address of the stored value for an array list of values,
+ * and the context pointer passed along with it.
+*/
+typedef void (*ArrayList_Visitor)(void*, void*);
+
+/**
+ * A function that decides whether to keep an element of an array list, given
+ * the element as a visitor sees it and the context pointer passed along with
+ * it. It returns true to keep the element.
+*/
+typedef bool (*ArrayList_Predicate)(const void*, void*);
+
+/**
+ * A function that gives the replacement for an element of an array list,
+ * given the element as a visitor sees it and the context pointer passed along
+ * with it. It returns the new pointer to store, or for an array list of values
+ * the address of the new value, which may be the element itself after
+ * changing it in place.
+*/
+typedef void* (*ArrayList_Mapper)(void*, void*);
+
+/**
+ * The collection holds pointers when elem_size is 0. Otherwise it holds values
+ * of elem_size bytes each, and is addressed in bytes rather than as pointers.
+ * The collection points at inline_buffer until the list outgrows it, so an
+ * array list must not be copied or moved in memory while it is in use.
+ * allocated is true if the array list itself was allocated by one of the
+ * new_ArrayList functions, rather than set up in place with ArrayList_init().
+ * While an array list in incremental resize mode is growing, the elements from
+ * index migrated up to migrate_end are still in old_collection, and every
+ * other element is in collection. old_collection is NULL the rest of the time.
+ * mapped and old_mapped are the number of bytes mapped for collection and
+ * old_collection, or 0 if they came from malloc() or are the inline buffer.
+ * When cursor is not ARRAY_LIST_NPOS, the list is being edited as a gap
+ * buffer: the elements from index cursor onwards are kept at the end of the
+ * collection, and the unused capacity forms a gap at the cursor.
+ * fd is the descriptor of the file the collection is mapped from by
+ * ArrayList_mapFile(), or -1 if the list is not backed by a file.
+ * tombstones is a bitmap of tombstone_words words with a bit set for each of
+ * the removed elements marked by ArrayList_markRemoved(), and removed is the
+ * number of bits set. It is NULL when no element is marked.
+ * index is the side index of an array list with indexed set, and its slots
+ * are NULL until it is built.
+*/
 typedef struct ArrayList {
   void** collection;
-  int size;
+  size_t size;
+  size_t capacity;
+  size_t elem_size;
+  bool allocated;
+  bool incremental;
+  void** old_collection;
+  size_t migrated;
+  size_t migrate_end;
+  size_t cursor;
+  size_t mapped;
+  size_t old_mapped;
+  int fd;
+  bool read_only;
+  uint64_t* tombstones;
+  size_t tombstone_words;
+  size_t removed;
+  bool indexed;
+  ArrayList_HashTable index;
+  union {
+    void* pointers[ARRAY_LIST_INLINE_CAPACITY];
+    max_align_t align;
+  } inline_buffer;
 } ArrayList;
 
 /**
  * Creates a new list using a dynamic array as the underlying collection.
+ * The elements are kept in the inline buffer of the list until it grows past
+ * ARRAY_LIST_INLINE_CAPACITY, so the only allocation is the list itself.
  * 
  * @return The new array list, or NULL if the array list could not be created.
 */
 ArrayList* new_ArrayList();
 
+/**
+ * Creates a new list using a dynamic array as the underlying collection, with
+ * room for the given number of elements before the collection has to grow.
+ * 
+ * @param size_t The initial capacity of the array list.
+ * @return The new array list, or NULL if the array list could not be created.
+*/
+ArrayList* new_ArrayListWithCapacity(size_t);
+
+/**
+ * Initialises an array list in storage owned by the caller, such as a local
+ * variable or a field of another struct. Nothing is allocated until the list
+ * outgrows its inline buffer. The list must be released with
+ * ArrayList_deinit(), and must not be moved while it is in use.
+ * 
+ * @param ArrayList* The storage to initialise the array list in.
+ * @return true if the array list was initialised, false if it is NULL.
+*/
+bool ArrayList_init(ArrayList*);
+
+/**
+ * Initialises an array list of values of the given size in storage owned by
+ * the caller, in the same way as ArrayList_init().
+ * 
+ * @param ArrayList* The storage to initialise the array list in.
+ * @param size_t     The size in bytes of each element, which must not be 0.
+ * @return true if the array list was initialised, false otherwise.
+*/
+bool ArrayList_initOf(ArrayList*, size_t);
+
+/**
+ * Releases the memory held by an array list initialised with ArrayList_init()
+ * or ArrayList_initOf(), without freeing the array list itself. The list is
+ * left empty and can be used again.
+ * 
+ * @param ArrayList* The array list to release.
+*/
+void ArrayList_deinit(ArrayList*);
+
+/**
+ * Creates a new list that stores values of the given size directly in its
+ * collection, rather than pointers to them. The values are contiguous, so
+ * scanning the list reads memory in order and adding an element needs no
+ * allocation of its own. Elements are copied in and out by their size.
+ * 
+ * @param size_t The size in bytes of each element, which must not be 0.
+ * @return The new array list, or NULL if the array list could not be created.
+*/
+ArrayList* new_ArrayListOf(size_t);
+
+/**
+ * Creates a new list that stores values of the given size directly in its
+ * collection, with room for the given number of elements before the
+ * collection has to grow.
+ * 
+ * @param size_t The size in bytes of each element, which must not be 0.
+ * @param size_t The initial capacity of the array list.
+ * @return The new array list, or NULL if the array list could not be created.
+*/
+ArrayList* new_ArrayListOfWithCapacity(size_t, size_t);
+
+/**
+ * Creates an array list of values of the given size backed by the file at the
+ * given path, which is mapped into memory rather than read. Reading a value
+ * is a plain load from the mapping, and adding past the end of the file grows
+ * it with ftruncate() and remaps it, so reopening a large list is immediate.
+ * The file starts with a small header recording the element size and the
+ * number of values, which is only written by ArrayList_flush() and when the
+ * list is freed. A file that does not exist is created empty.
+ * With ARRAY_LIST_MAP_READ_ONLY, the file is opened read only and never
+ * changed: the list cannot grow, and changes made in memory are private to
+ * the process. With ARRAY_LIST_MAP_TRUNCATE, any values in the file are
+ * discarded. Only available on Linux.
+ * 
+ * @param const char* The path of the file.
+ * @param size_t      The size in bytes of each element, which must not be 0
+ *                    and must match the file if it already exists.
+ * @param int         ARRAY_LIST_MAP_READ_ONLY, ARRAY_LIST_MAP_TRUNCATE or 0.
+ * @return The new array list, or NULL if the file could not be opened or
+ *         mapped, or does not hold values of the given size.
+*/
+ArrayList* ArrayList_mapFile(const char*, size_t, int);
+
+/**
+ * Writes the values of the given file backed array list, and its size, back
+ * to the file with msync().
+ * 
+ * @param ArrayList* The file backed array list to flush.
+ * @param bool       true to wait for the data to reach the disk, false to
+ *                   only schedule the write.
+ * @return true if the flush succeeded, false if the list is NULL, read only or
+ *         not backed by a file, or the write failed.
+*/
+bool ArrayList_flush(ArrayList*, bool);
+
+/**
+ * Gets the size of the values stored in the given array list.
+ * 
+ * @param ArrayList* The array list to get the element size of.
+ * @return The size in bytes of each value, 0 if the array list stores
+ *         pointers, or ARRAY_LIST_NPOS if the array list is NULL.
+*/
+size_t ArrayList_elementSize(ArrayList*);
+
+/**
+ * Makes sure the given array list can hold at least the given number of
+ * elements without reallocating its collection.
+ * 
+ * @param ArrayList* The array list to reserve space in.
+ * @param size_t     The number of elements to reserve space for.
+ * @return true if the space was reserved successfully, false otherwise.
+*/
+bool ArrayList_reserve(ArrayList*, size_t);
+
+/**
+ * Reduces the capacity of the given array list to match its size, releasing
+ * any unused memory held by the collection.
+ * 
+ * @param ArrayList* The array list to shrink.
+ * @return true if the array list was shrunk successfully, false otherwise.
+*/
+bool ArrayList_shrinkToFit(ArrayList*);
+
+/**
+ * Gets the capacity of the given array list, which is the number of elements
+ * it can hold before the collection has to be reallocated.
+ * 
+ * @param ArrayList* The array list to get the capacity of.
+ * @return The capacity of the given array list, or ARRAY_LIST_NPOS if the array
+ *         list is NULL.
+*/
+size_t ArrayList_capacity(ArrayList*);
+
+/**
+ * Turns incremental resize mode on or off for the given array list. In this
+ * mode, growing a collection on the heap allocates the larger collection
+ * without copying into it, and each following ArrayList_add() and
+ * ArrayList_get() moves at most ARRAY_LIST_INCREMENTAL_STEP elements across,
+ * so no single add copies the whole list. The move is finished before the new
+ * collection fills up. Any other function that reads or changes the elements
+ * finishes the move first, as does turning the mode off.
+ * While the move is in progress, the address ArrayList_get() returns for an
+ * array list of values is only valid until the next add or get.
+ * 
+ * @param ArrayList* The array list to change the resize mode of.
+ * @param bool       true to resize incrementally, false to resize all at once.
+ * @return true if the resize mode was changed, false if the array list is NULL.
+*/
+bool ArrayList_setIncrementalResize(ArrayList*, bool);
+
+/**
+ * Turns the side index of the given array list on or off. An indexed list
+ * keeps a hash table from each element to the index of its first occurrence,
+ * so ArrayList_indexOf() and ArrayList_contains() take O(1) expected time
+ * rather than scanning the list. The table is built by the first lookup once
+ * the list holds ARRAY_LIST_INDEX_THRESHOLD elements, and kept up to date by
+ * ArrayList_add() and by removing the last element. Any other edit that moves
+ * elements drops it, to be rebuilt by the next lookup, which costs no more
+ * than the edit did. The order of the list is never changed. The values of an
+ * indexed array list of values must not be changed in place through the
+ * address ArrayList_get() gives.
+ * 
+ * @param ArrayList* The array list to change.
+ * @param bool       true to keep a side index, false to free it.
+ * @return true if the mode was set, false if the array list is NULL.
+*/
+bool ArrayList_setIndexed(ArrayList*, bool);
+
 /**
  * Adds a new element to the end of the given array list.
  * The data is stored in the array list as a void pointer. Note that the data
  * is not copied, but rather the pointer to the data is stored in the array list.
+ * For an array list of values, the value the pointer points to is copied into
+ * the collection instead.
+ * The capacity grows geometrically, so appending is amortised O(1).
  * 
  * @param ArrayList* The array list to add the element to.
  * @param void*      The pointer to the element to add to the array list.
@@ -43,34 +400,218 @@ ArrayList* new_ArrayList();
 */
 bool ArrayList_add(ArrayList*, void*);
 
+/**
+ * Adds a series of elements to the end of the given array list.
+ * The collection is grown at most once and the elements are copied in a single
+ * pass. Note that the data is not copied, but rather the pointers to the data
+ * are stored in the array list. For an array list of values, the values the
+ * pointers point to are copied into the collection instead.
+ * 
+ * @param ArrayList* The array list to add the elements to.
+ * @param void**     The array of pointers to add, which must not point into the
+ *                   collection of the array list.
+ * @param size_t     The number of pointers to add.
+ * @return true if the elements were added successfully, false otherwise.
+*/
+bool ArrayList_addAll(ArrayList*, void**, size_t);
+
+/**
+ * Inserts a series of elements into the given array list, starting at the
+ * given index. The elements after the index are shifted along with a single
+ * memmove, and the collection is grown at most once.
+ * For an array list of values, the values the pointers point to are copied
+ * into the collection.
+ * 
+ * @param ArrayList* The array list to insert the elements into.
+ * @param size_t     The index to insert the first element at, which may be equal
+ *                   to the size of the array list to append the elements.
+ * @param void**     The array of pointers to insert, which must not point into
+ *                   the collection of the array list.
+ * @param size_t     The number of pointers to insert.
+ * @return true if the elements were inserted successfully, false otherwise.
+*/
+bool ArrayList_insertRange(ArrayList*, size_t, void**, size_t);
+
+/**
+ * Inserts an element into the given array list at the given index, using the
+ * collection as a gap buffer. The unused capacity is kept as a gap at the
+ * cursor, so inserting at the cursor is O(1), and the gap only has to move
+ * when an edit is made somewhere else. The cursor ends up just after the new
+ * element, ready for the next insert.
+ * The gap stays open until a function that needs the whole collection in
+ * order, such as ArrayList_add() or ArrayList_sort(), closes it again.
+ * For an array list of values, the value the pointer points to is copied into
+ * the collection.
+ * 
+ * @param ArrayList* The array list to insert the element into.
+ * @param size_t     The index to insert the element at, which may be equal to
+ *                   the size of the array list.
+ * @param void*      The pointer to the element to insert.
+ * @return true if the element was inserted successfully, false otherwise.
+*/
+bool ArrayList_insert(ArrayList*, size_t, void*);
+
+/**
+ * Moves the gap buffer cursor of the given array list to the given index,
+ * opening the gap if it is closed. Only the elements between the old and new
+ * cursor are moved, so edits that stay close to the cursor stay cheap.
+ * 
+ * @param ArrayList* The array list to move the cursor of.
+ * @param size_t     The new cursor, from 0 up to the size of the array list.
+ * @return true if the cursor was moved, false otherwise.
+*/
+bool ArrayList_moveCursor(ArrayList*, size_t);
+
 /**
  * Removes the element at the given index from the given array list.
+ * The elements after the index are shifted down to keep the order, and the
+ * collection keeps its capacity until the list becomes sparse.
+ * While the gap buffer is open, the gap is moved to the element instead and
+ * grown over it, so removing next to the cursor is O(1).
+ * The data is not freed, but rather the pointer to the data is removed 
+ * from the array list.
+ * 
+ * @param ArrayList* The array list to remove the element from.
+ * @param size_t     The index of the element to remove.
+ * @return true if the element was removed successfully, false if the index is
+ *         out of bounds or the element is already marked removed.
+*/
+bool ArrayList_remove(ArrayList*, size_t);
+
+/**
+ * Removes the element at the given index from the given array list in O(1) by
+ * moving the last element into its place. The order of the remaining elements
+ * is not kept.
  * The data is not freed, but rather the pointer to the data is removed 
  * from the array list.
  * 
  * @param ArrayList* The array list to remove the element from.
- * @param int        The index of the element to remove.
- * @return true if the element was removed successfully, false otherwise.
+ * @param size_t     The index of the element to remove.
+ * @return true if the element was removed successfully, false if the index is
+ *         out of bounds or the element is already marked removed.
+*/
+bool ArrayList_swapRemove(ArrayList*, size_t);
+
+/**
+ * Removes the elements in the given range from the given array list.
+ * The elements after the range are shifted down with a single memmove, and the
+ * collection keeps its capacity until the list becomes sparse.
+ * The data is not freed, but rather the pointers to the data are removed from
+ * the array list.
+ * 
+ * @param ArrayList* The array list to remove the elements from.
+ * @param size_t     The index of the first element to remove.
+ * @param size_t     The index one past the last element to remove.
+ * @return true if the elements were removed successfully, false otherwise.
+*/
+bool ArrayList_removeRange(ArrayList*, size_t, size_t);
+
+/**
+ * Marks the element at the given index of the given array list as removed,
+ * without moving any element, in O(1). The element stays in the list, and
+ * keeps counting towards its size, but ArrayList_get() skips it by returning
+ * NULL, so a batch of scattered indices can be removed without the indices
+ * shifting between calls. The marked elements are squeezed out in a single
+ * linear pass by ArrayList_compact(), or first thing by any function that
+ * moves elements by position or searches the list, and by ArrayList_add() when
+ * the list is full and at least 1 / ARRAY_LIST_COMPACT_THRESHOLD of it is
+ * marked.
+ * Until then, the indices given to the other functions count the marked
+ * elements, so an index means the same element before and after the squeeze,
+ * and the size of the list is still a valid index to append at. An index
+ * returned by a function that squeezed the list, such as ArrayList_indexOf()
+ * or ArrayList_lowerBound(), is an index into the squeezed list.
+ * 
+ * @param ArrayList* The array list to mark the element in.
+ * @param size_t     The index of the element to mark.
+ * @return true if the element was marked, false if it was already marked, or
+ *         the index is out of bounds, or the memory allocation failed.
+*/
+bool ArrayList_markRemoved(ArrayList*, size_t);
+
+/**
+ * Checks if the element at the given index of the given array list is marked
+ * removed by ArrayList_markRemoved().
+ * 
+ * @param ArrayList* The array list to check.
+ * @param size_t     The index of the element to check.
+ * @return true if the element is marked removed, false otherwise.
 */
-bool ArrayList_remove(ArrayList*, int);
+bool ArrayList_isRemoved(ArrayList*, size_t);
+
+/**
+ * Removes every element marked by ArrayList_markRemoved() from the given
+ * array list in one linear pass, keeping the order of the other elements.
+ * The collection keeps its capacity until the list becomes sparse.
+ * 
+ * @param ArrayList* The array list to compact.
+ * @return true if the array list was compacted, false otherwise.
+*/
+bool ArrayList_compact(ArrayList*);
+
+/**
+ * Calls the given function with every element of the given array list, in
+ * order, skipping the elements marked removed. The collection is walked
+ * directly, so the list is only checked once rather than once per element as
+ * with a loop over ArrayList_get(). The function must not change the list.
+ * 
+ * @param ArrayList*        The array list to walk.
+ * @param ArrayList_Visitor The function to call with each element.
+ * @param void*             The context pointer passed to the function.
+ * @return true if the array list was walked, false otherwise.
+*/
+bool ArrayList_forEach(ArrayList*, ArrayList_Visitor, void*);
+
+/**
+ * Removes every element of the given array list that the given predicate
+ * rejects, keeping the order of the others, in a single pass that moves each
+ * kept element at most once. The elements marked removed are squeezed out in
+ * the same pass. The collection keeps its capacity until the list becomes
+ * sparse. The predicate must not change the list.
+ * 
+ * @param ArrayList*          The array list to filter.
+ * @param ArrayList_Predicate The function that returns true for the elements
+ *                            to keep.
+ * @param void*               The context pointer passed to the predicate.
+ * @return true if the array list was filtered, false otherwise.
+*/
+bool ArrayList_retainIf(ArrayList*, ArrayList_Predicate, void*);
+
+/**
+ * Replaces every element of the given array list with the result of the given
+ * function, in order, skipping the elements marked removed. For an array list
+ * of values, the value the result points to is copied over the element, and
+ * a NULL result leaves the element as it is. The function must not change the
+ * list.
+ * 
+ * @param ArrayList*       The array list to map.
+ * @param ArrayList_Mapper The function that gives each replacement.
+ * @param void*            The context pointer passed to the function.
+ * @return true if the array list was mapped, false otherwise.
+*/
+bool ArrayList_map(ArrayList*, ArrayList_Mapper, void*);
 
 /**
  * Gets the element at the given index from the given array list.
  * The data is not copied, but rather the pointer to the data is returned.
+ * For an array list of values, the address of the value in the collection is
+ * returned, which is only valid until the array list is next modified.
  * 
  * @param ArrayList* The array list to get the element from.
- * @param int        The index of the element to get.
- * @return The element at the given index, or NULL if the index is out of bounds.
+ * @param size_t     The index of the element to get.
+ * @return The element at the given index, or NULL if the index is out of bounds
+ *         or the element is marked removed.
 */
-void* ArrayList_get(ArrayList*, int);
+void* ArrayList_get(ArrayList*, size_t);
 
 /**
  * Gets the size of the given array list.
  * 
  * @param ArrayList* The array list to get the size of.
- * @return The size of the given array list, or -1 if the array list is NULL.
+ * @return The size of the given array list, or ARRAY_LIST_NPOS if the array
+ *         list is NULL.
 */
-int ArrayList_size(ArrayList*);
+size_t ArrayList_size(ArrayList*);
 
 /**
  * Checks if the array list is empty.
@@ -83,7 +624,8 @@ bool ArrayList_isEmpty(ArrayList*);
 /**
  * Checks if the array list contains the given element.
  * The data stored is a void pointer, so the data is not compared directly
- * but rather the pointers to the data are compared.
+ * but rather the pointers to the data are compared. For an array list of
+ * values, the value the data points to is compared byte for byte instead.
  * 
  * @param ArrayList* The array list to check.
  * @param void*      The data to check for.
@@ -94,14 +636,217 @@ bool ArrayList_contains(ArrayList*, void*);
 /**
  * Gets the index of the given element in the given array list.
  * The data stored is a void pointer, so the data is not compared directly
- * but rather the pointers to the data are compared.
+ * but rather the pointers to the data are compared. For an array list of
+ * values, the value the data points to is compared byte for byte instead.
+ * 
+ * @param ArrayList* The array list to search.
+ * @param void*      The data to search for.
+ * @return The index of the given element in the given array list, or
+ *         ARRAY_LIST_NPOS if the element is not found.
+*/
+size_t ArrayList_indexOf(ArrayList*, void*);
+
+/**
+ * Gets the index of the last occurrence of the given element in the given
+ * array list. The pointers to the data are compared, not the data itself,
+ * except in an array list of values where the values are compared byte for
+ * byte.
  * 
  * @param ArrayList* The array list to search.
  * @param void*      The data to search for.
- * @return The index of the given element in the given array list, or -1 if 
- *         the element is not found.
+ * @return The index of the last occurrence of the given element, or
+ *         ARRAY_LIST_NPOS if the element is not found.
+*/
+size_t ArrayList_lastIndexOf(ArrayList*, void*);
+
+/**
+ * Counts the occurrences of the given element in the given array list.
+ * The pointers to the data are compared, not the data itself, except in an
+ * array list of values where the values are compared byte for byte.
+ * 
+ * @param ArrayList* The array list to search.
+ * @param void*      The data to count.
+ * @return The number of occurrences of the given element, or ARRAY_LIST_NPOS
+ *         if the array list is NULL.
+*/
+size_t ArrayList_count(ArrayList*, void*);
+
+/**
+ * Removes every element of the given array list that is equal to one before
+ * it, keeping the first occurrence of each in order. A temporary hash table
+ * of the elements kept so far makes this O(n) expected time, rather than the
+ * O(n^2) of calling ArrayList_contains() before every add.
+ * The pointers to the data are compared, not the data itself, except in an
+ * array list of values where the values are compared byte for byte.
+ * 
+ * @param ArrayList* The array list to remove the duplicates from.
+ * @return true if the duplicates were removed, false otherwise.
+*/
+bool ArrayList_unique(ArrayList*);
+
+/**
+ * Removes every element of the first array list that is not in the second, in
+ * O(n + m) expected time using a temporary hash table of the second list. The
+ * order of the kept elements, and any duplicates among them, are kept as well.
+ * Elements are compared as in ArrayList_unique(), so both lists must store
+ * pointers, or values of the same size.
+ * 
+ * @param ArrayList* The array list to keep the common elements of.
+ * @param ArrayList* The array list to look the elements up in.
+ * @return true if the array list was intersected, false otherwise.
+*/
+bool ArrayList_intersect(ArrayList*, ArrayList*);
+
+/**
+ * Removes every element of the first array list that is in the second, in
+ * O(n + m) expected time using a temporary hash table of the second list. The
+ * order of the kept elements is kept.
+ * Elements are compared as in ArrayList_unique(), so both lists must store
+ * pointers, or values of the same size.
+ * 
+ * @param ArrayList* The array list to remove the elements from.
+ * @param ArrayList* The array list of the elements to remove.
+ * @return true if the elements were removed, false otherwise.
+*/
+bool ArrayList_difference(ArrayList*, ArrayList*);
+
+/**
+ * Adds each element of the second array list that is not already in the
+ * first to the end of the first, once, in O(n + m) expected time using a
+ * temporary hash table of the first list. Room for the whole of the second
+ * list is reserved up front.
+ * Elements are compared as in ArrayList_unique(), so both lists must store
+ * pointers, or values of the same size.
+ * 
+ * @param ArrayList* The array list to add the elements to.
+ * @param ArrayList* The array list of the elements to add.
+ * @return true if the elements were added, false otherwise.
+*/
+bool ArrayList_union(ArrayList*, ArrayList*);
+
+/**
+ * Gets the name of the search implementation used by ArrayList_contains(),
+ * ArrayList_indexOf(), ArrayList_lastIndexOf() and ArrayList_count() on this
+ * CPU, such as "avx2" or "scalar". The implementation is picked at run time,
+ * and compiling with ARRAY_LIST_NO_SIMD defined forces the scalar one.
+ * 
+ * @return The name of the search implementation.
+*/
+const char* ArrayList_searchImplementation();
+
+/**
+ * Sorts the given array list in place using the given comparator.
+ * The comparator is given the stored pointers, not pointers to the slots, or
+ * the addresses of the values for an array list of values. An array list of
+ * values is sorted through an array of those addresses, so each value is only
+ * moved once.
+ * The sort is a pattern-defeating quicksort: it runs in O(n log n) in the
+ * worst case, in linear time on sorted, reversed and equal inputs, and is not
+ * stable.
+ * 
+ * @param ArrayList*           The array list to sort.
+ * @param ArrayList_Comparator The comparator to order the elements with.
+ * @return true if the array list was sorted successfully, false otherwise.
+*/
+bool ArrayList_sort(ArrayList*, ArrayList_Comparator);
+
+/**
+ * Sorts the elements in the given range of the given array list in place
+ * using the given comparator. The elements outside the range are not moved.
+ * 
+ * @param ArrayList*           The array list to sort.
+ * @param size_t               The index of the first element to sort.
+ * @param size_t               The index one past the last element to sort.
+ * @param ArrayList_Comparator The comparator to order the elements with.
+ * @return true if the range was sorted successfully, false otherwise.
+*/
+bool ArrayList_sortRange(ArrayList*, size_t, size_t, ArrayList_Comparator);
+
+/**
+ * Sorts the given array list in place by the unsigned integer key of each
+ * element, using a stable least significant digit radix sort. The keys are
+ * extracted once into a scratch array and the elements are then distributed
+ * a byte at a time, so the sort runs in linear time and never calls a
+ * comparator. Signed keys can be sorted by flipping their sign bit.
+ * An array list of values is sorted through an array of the addresses of the
+ * values, which are then moved into place once.
+ * 
+ * @param ArrayList*            The array list to sort.
+ * @param ArrayList_KeyFunction The function giving the key of an element.
+ * @param int                   The number of low bits of the key to sort by,
+ *                              from 1 to 64. Any higher bits are ignored.
+ * @return true if the array list was sorted successfully, false otherwise.
+*/
+bool ArrayList_radixSortByKey(ArrayList*, ArrayList_KeyFunction, int);
+
+/**
+ * Gets the index of the first element of the given sorted array list that
+ * does not come before the given data, using a binary search.
+ * 
+ * @param ArrayList*           The array list to search, sorted by the comparator.
+ * @param void*                The data to search for.
+ * @param ArrayList_Comparator The comparator the array list is sorted by.
+ * @return The index of the first element not less than the data, which is the
+ *         size of the array list if there is none, or ARRAY_LIST_NPOS if the
+ *         array list or comparator is NULL.
+*/
+size_t ArrayList_lowerBound(ArrayList*, void*, ArrayList_Comparator);
+
+/**
+ * Gets the index of the first element of the given sorted array list that
+ * comes after the given data, using a binary search.
+ * 
+ * @param ArrayList*           The array list to search, sorted by the comparator.
+ * @param void*                The data to search for.
+ * @param ArrayList_Comparator The comparator the array list is sorted by.
+ * @return The index of the first element greater than the data, which is the
+ *         size of the array list if there is none, or ARRAY_LIST_NPOS if the
+ *         array list or comparator is NULL.
+*/
+size_t ArrayList_upperBound(ArrayList*, void*, ArrayList_Comparator);
+
+/**
+ * Finds an element of the given sorted array list equal to the given data,
+ * according to the comparator, in O(log n).
+ * 
+ * @param ArrayList*           The array list to search, sorted by the comparator.
+ * @param void*                The data to search for.
+ * @param ArrayList_Comparator The comparator the array list is sorted by.
+ * @return The index of the first element equal to the data, or ARRAY_LIST_NPOS
+ *         if there is none.
+*/
+size_t ArrayList_binarySearch(ArrayList*, void*, ArrayList_Comparator);
+
+/**
+ * Inserts an element into the given sorted array list, keeping it sorted.
+ * The element goes after any elements equal to it, so the insertion order of
+ * equal elements is kept. For an array list of values, the value the pointer
+ * points to is copied into the collection.
+ * 
+ * @param ArrayList*           The array list to insert into, sorted by the
+ *                             comparator.
+ * @param void*                The pointer to the element to insert.
+ * @param ArrayList_Comparator The comparator the array list is sorted by.
+ * @return true if the element was inserted successfully, false otherwise.
+*/
+bool ArrayList_insertSorted(ArrayList*, void*, ArrayList_Comparator);
+
+/**
+ * Merges a sorted series of elements into the given sorted array list in a
+ * single linear pass, keeping it sorted. Elements already in the array list
+ * come before equal elements from the series. For an array list of values, the
+ * values the pointers point to are copied into the collection.
+ * 
+ * @param ArrayList*           The array list to merge into, sorted by the
+ *                             comparator.
+ * @param void**               The array of pointers to merge, sorted by the
+ *                             comparator, which must not point into the
+ *                             collection of the array list.
+ * @param size_t               The number of pointers to merge.
+ * @param ArrayList_Comparator The comparator the array list is sorted by.
+ * @return true if the elements were merged successfully, false otherwise.
 */
-int ArrayList_indexOf(ArrayList*, void*);
+bool ArrayList_mergeSorted(ArrayList*, void**, size_t, ArrayList_Comparator);
 
 /**
  * Prints the given array list as a list of pointers.
@@ -118,7 +863,8 @@ void ArrayList_print(ArrayList*);
 void ArrayList_printInt(ArrayList*);
 
 /**
- * Clears the given array list.
+ * Clears the given array list. The collection moves back into the inline
+ * buffer, releasing any memory it held on the heap.
  * 
  * @param ArrayList* The array list to clear.
  * @return true if the array list was cleared successfully, false otherwise.
@@ -126,7 +872,8 @@ void ArrayList_printInt(ArrayList*);
 bool ArrayList_clear(ArrayList*);
 
 /**
- * Frees the given array list.
+ * Frees the given array list. An array list initialised with ArrayList_init()
+ * only has its collection released, as with ArrayList_deinit().
  * 
  * @param ArrayList* The array list to free.
 */
@@ -14,6 +14,124 @@
 
 #include "array_queue.h"
 
+/**
+ * Gets the position in the collection of the element at the given index from
+ * the front of the queue.
+ * 
+ * @param ArrayQueue* the pointer to the array queue.
+ * @param size_t      the index from the front, which must be within the
+ *                    capacity.
+ * @return the position of the element in the collection.
+*/
+static inline size_t ArrayQueue_position(ArrayQueue* queue, size_t index) {
+  size_t position = queue->head + index;
+  return position >= queue->capacity ? position - queue->capacity : position;
+}
+
+/**
+ * Gets the slot holding the element at the given position of the collection,
+ * which is in the old collection if it has not been moved across yet.
+ * 
+ * @param ArrayQueue* the pointer to the array queue.
+ * @param size_t      the position of the element in the collection.
+ * @return the address of the slot holding the element.
+*/
+static inline void** ArrayQueue_slot(ArrayQueue* queue, size_t position) {
+  // If the element is still in the old collection, find it there.
+  if (queue->old_collection != NULL && position >= queue->migrated && position < queue->migrate_end) {
+    size_t old_position = queue->old_head + position;
+    if (old_position >= queue->old_capacity) {
+      old_position -= queue->old_capacity;
+    }
+    return &queue->old_collection[old_position];
+  }
+
+  return &queue->collection[position];
+}
+
+/**
+ * Moves up to the given number of the elements still in the old collection
+ * into the new one, and frees the old collection once they have all been
+ * moved.
+ * 
+ * @param ArrayQueue* the pointer to the array queue.
+ * @param size_t      the most elements to move.
+*/
+static void ArrayQueue_migrate(ArrayQueue* queue, size_t count) {
+  // If the queue is not being resized, there is nothing to do.
+  if (queue->old_collection == NULL) {
+    return;
+  }
+
+  while (count > 0 && queue->migrated < queue->migrate_end) {
+    queue->collection[queue->migrated] = *ArrayQueue_slot(queue, queue->migrated);
+    queue->migrated++;
+    count--;
+  }
+
+  // If every element has been moved, free the old collection.
+  if (queue->migrated == queue->migrate_end) {
+    free(queue->old_collection);
+    queue->old_collection = NULL;
+  }
+}
+
+/**
+ * Doubles the capacity of the collection. The elements are unwrapped to the
+ * start of the new collection, either straight away or, in incremental resize
+ * mode, a few at a time by later enqueues and dequeues.
+ * 
+ * @param ArrayQueue* the pointer to the array queue.
+ * @return true if the collection was grown successfully, false otherwise.
+*/
+static bool ArrayQueue_grow(ArrayQueue* queue) {
+  // Finish any resize still in progress, so there is only one old collection.
+  ArrayQueue_migrate(queue, SIZE_MAX);
+
+  // If the collection cannot grow without overflowing, return false.
+  if (queue->size >= ARRAY_QUEUE_MAX_SIZE) {
+    return false;
+  }
+
+  size_t capacity = ARRAY_QUEUE_DEFAULT_CAPACITY;
+  if (queue->capacity > ARRAY_QUEUE_MAX_SIZE / 2) {
+    capacity = ARRAY_QUEUE_MAX_SIZE;
+  } else if (queue->capacity > 0) {
+    capacity = queue->capacity * 2;
+  }
+
+  void** new_collection = malloc(sizeof(void*) * capacity);
+  // If the memory allocation failed, return false.
+  if (new_collection == NULL) {
+    return false;
+  }
+
+  if (queue->incremental && queue->size > 0) {
+    // Leave the elements where they are, to be moved across later.
+    queue->old_collection = queue->collection;
+    queue->old_head = queue->head;
+    queue->old_capacity = queue->capacity;
+    queue->migrated = 0;
+    queue->migrate_end = queue->size;
+  } else {
+    // Unwrap the elements to the start of the new collection.
+    size_t first = queue->capacity - queue->head;
+    if (first > queue->size) {
+      first = queue->size;
+    }
+    if (queue->size > 0) {
+      memcpy(new_collection, &queue->collection[queue->head], sizeof(void*) * first);
+      memcpy(&new_collection[first], queue->collection, sizeof(void*) * (queue->size - first));
+    }
+    free(queue->collection);
+  }
+
+  queue->collection = new_collection;
+  queue->head = 0;
+  queue->capacity = capacity;
+  return true;
+}
+
 /**
  * Creates a new queue using a dynamic array as the underlying collection.
  * This function uses malloc to allocate memory for the queue.
@@ -30,7 +148,15 @@ ArrayQueue* new_ArrayQueue() {
   
   // Initialise the queue.
   queue->collection = NULL;
+  queue->head = 0;
   queue->size = 0;
+  queue->capacity = 0;
+  queue->incremental = false;
+  queue->old_collection = NULL;
+  queue->old_head = 0;
+  queue->old_capacity = 0;
+  queue->migrated = 0;
+  queue->migrate_end = 0;
   return queue;
 }
 
@@ -38,6 +164,8 @@ ArrayQueue* new_ArrayQueue() {
  * Adds a new element to the queue.
  * The data is stored in a dynamic array. Note that the data is not
  * copied, but rather the pointer to the data is stored in the array.
+ * The capacity doubles when the queue is full, so enqueueing is amortised
+ * O(1), or O(1) in the worst case in incremental resize mode.
  * 
  * @param Queue* the pointer to the array queue.
  * @param void*  the data to be stored in the node.
@@ -49,44 +177,25 @@ bool ArrayQueue_enqueue(ArrayQueue* queue, void* data) {
     return false;
   }
 
-  // If the size is 0, then the collection is empty.
-  if (queue->size == 0) {
-    void** new_collection = malloc(sizeof(void*));
-    // If the memory allocation failed, return false.
-    if (new_collection == NULL) {
-      return false;
-    }
-    new_collection[0] = data;
-    queue->collection = new_collection;
-    queue->size++;
-    return true;
+  // If the collection is full, grow it.
+  if (queue->size == queue->capacity && !ArrayQueue_grow(queue)) {
+    return false;
   }
 
-  // If the size is greater than 0, then the collection is not empty.
-  if (queue->size > 0) {
-    void** new_collection = realloc(queue->collection, sizeof(void*) * (queue->size + 1));
-    // If the memory allocation failed, return false.
-    if (new_collection == NULL) {
-      return false;
-    }
-
-    // Add the data to the new collection.
-    new_collection[queue->size] = data;
-    // Increment the size.
-    queue->size++;
-    queue->collection = new_collection;
+  // Move a few of the elements left in the old collection, if there is one.
+  ArrayQueue_migrate(queue, ARRAY_QUEUE_INCREMENTAL_STEP);
 
-    return true;
-  }
-
-  // If the code reaches this point, then the code is invalid.
-  return false;
+  // Add the data after the last element, wrapping around the collection.
+  queue->collection[ArrayQueue_position(queue, queue->size)] = data;
+  queue->size++;
+  return true;
 }
 
 /**
  * Removes the element at the front of the queue and returns the data stored.
  * The data is stored in a dynamic array. This function returns the pointer stored
  * in the array, not a copy of the data.
+ * No elements are moved, so dequeueing is O(1).
  * 
  * @param ArrayQueue* the pointer to the array queue.
  * @return the data stored in the first node, or NULL if the queue is empty.
@@ -107,43 +216,22 @@ void* ArrayQueue_dequeue(ArrayQueue* queue) {
     return NULL;
   }
 
-  void* data = queue->collection[0];
+  void* data = *ArrayQueue_slot(queue, queue->head);
 
-  if (queue->size == 1) {
-    
-    free(queue->collection);
-    queue->collection = NULL;
-    queue->size--;
-    return data;
+  // Move the head on. Elements dequeued before they were moved across never
+  // need to be moved.
+  queue->head++;
+  if (queue->old_collection != NULL && queue->migrated < queue->head) {
+    queue->migrated = queue->head < queue->migrate_end ? queue->head : queue->migrate_end;
   }
-
-  // If the size is greater than 0, then the collection is not empty.
-  if (queue->size > 0) {
-    void** new_collection = malloc(sizeof(void*) * (queue->size - 1));
-    // If the memory allocation failed, return NULL.
-    if (new_collection == NULL) {
-      return NULL;
-    }
-
-    // Copy the data from the old collection to the new collection.
-    memcpy(new_collection, &queue->collection[1], sizeof(void*) * (queue->size - 1));
-
-    free(queue->collection);
-
-    // Set the collection to the new collection.
-    queue->collection = new_collection;
-    // Decrement the size.
-    queue->size--;
-    return data;
-  }
-
-  // If the size is less than 0, then the size is invalid.
-  if (queue->size < 0) {
-    return NULL;
+  if (queue->head == queue->capacity) {
+    queue->head = 0;
   }
+  queue->size--;
 
-  // If the code reaches this point, then the code is invalid.
-  return NULL;
+  // Move a few of the elements left in the old collection, if there is one.
+  ArrayQueue_migrate(queue, ARRAY_QUEUE_INCREMENTAL_STEP);
+  return data;
 }
 
 /**
@@ -170,30 +258,45 @@ void* ArrayQueue_peek(ArrayQueue* queue) {
     return NULL;
   }
 
-  // If the size is greater than 0, then the collection is not empty.
-  if (queue->size > 0) {
-    return queue->collection[0];
-  }
+  return *ArrayQueue_slot(queue, queue->head);
+}
 
-  // If the size is less than 0, then the size is invalid.
-  if (queue->size < 0) {
-    return NULL;
+/**
+ * Turns incremental resize mode on or off for the queue. In this mode,
+ * growing the collection allocates the larger collection without copying into
+ * it, and each following enqueue and dequeue moves at most
+ * ARRAY_QUEUE_INCREMENTAL_STEP elements across. As the capacity doubles, the
+ * move is always finished before the new collection fills up.
+ * Turning the mode off finishes any move in progress.
+ * 
+ * @param ArrayQueue* the pointer to the array queue.
+ * @param bool        true to resize incrementally, false to resize all at once.
+ * @return true if the resize mode was changed, false if the queue is NULL.
+*/
+bool ArrayQueue_setIncrementalResize(ArrayQueue* queue, bool incremental) {
+  // If the queue is NULL, return false.
+  if (queue == NULL) {
+    return false;
   }
 
-  // If the code reaches this point, then the code is invalid.
-  return NULL;
+  if (!incremental) {
+    ArrayQueue_migrate(queue, SIZE_MAX);
+  }
+  queue->incremental = incremental;
+  return true;
 }
 
 /**
  * Returns the size of the queue.
  * 
  * @param ArrayQueue* the pointer to the array queue.
- * @return the size of the array queue, or -1 if the queue is NULL.
+ * @return the size of the array queue, or ARRAY_QUEUE_NPOS if the queue is
+ *         NULL.
 */
-int ArrayQueue_size(ArrayQueue* queue) {
-  // If the queue is NULL, return -1.
+size_t ArrayQueue_size(ArrayQueue* queue) {
+  // If the queue is NULL, return ARRAY_QUEUE_NPOS.
   if (queue == NULL) {
-    return -1;
+    return ARRAY_QUEUE_NPOS;
   }
 
   return queue->size;
@@ -221,11 +324,6 @@ bool ArrayQueue_isEmpty(ArrayQueue* queue) {
     return false;
   }
 
-  // If the size is less than 0, then the size is invalid.
-  if (queue->size < 0) {
-    return true;
-  }
-
   // If the code reaches this point, then the code is invalid.
   return true;
 }
@@ -256,8 +354,8 @@ void ArrayQueue_print(ArrayQueue* queue) {
   // If the size is greater than 0, then the collection is not empty.
   if (queue->size > 0) {
     printf("[");
-    for (int i = 0; i < queue->size; i++) {
-      printf("%p ", queue->collection[i]);
+    for (size_t i = 0; i < queue->size; i++) {
+      printf("%p ", *ArrayQueue_slot(queue, ArrayQueue_position(queue, i)));
       if (i < queue->size - 1) {
         printf(", ");
       }
@@ -266,11 +364,6 @@ void ArrayQueue_print(ArrayQueue* queue) {
     return;
   }
 
-  // If the size is less than 0, then the size is invalid.
-  if (queue->size < 0) {
-    return;
-  }
-
   // If the code reaches this point, then the code is invalid.
   return;
 }
@@ -301,8 +394,8 @@ void ArrayQueue_printInt(ArrayQueue* queue) {
   // If the size is greater than 0, then the collection is not empty.
   if (queue->size > 0) {
     printf("[");
-    for (int i = 0; i < queue->size; i++) {
-      printf("%d ", *(int*)queue->collection[i]);
+    for (size_t i = 0; i < queue->size; i++) {
+      printf("%d ", *(int*) *ArrayQueue_slot(queue, ArrayQueue_position(queue, i)));
       if (i < queue->size - 1) {
         printf(", ");
       }
@@ -311,11 +404,6 @@ void ArrayQueue_printInt(ArrayQueue* queue) {
     return;
   }
 
-  // If the size is less than 0, then the size is invalid.
-  if (queue->size < 0) {
-    return;
-  }
-
   // If the code reaches this point, then the code is invalid.
   return;
 }
@@ -344,20 +432,19 @@ bool ArrayQueue_clear(ArrayQueue* queue) {
 
   // If the size is greater than 0, then the collection is not empty.
   if (queue->size > 0) {
-    // Free the collection.
+    // Free the collection, and any old collection left from a resize.
     free(queue->collection);
-    // Set the collection to NULL.
+    free(queue->old_collection);
+    // Set the collections to NULL.
     queue->collection = NULL;
-    // Set the size to 0.
+    queue->old_collection = NULL;
+    // Set the size and capacity to 0.
+    queue->head = 0;
     queue->size = 0;
+    queue->capacity = 0;
     return true;
   }
 
-  // If the size is less than 0, then the size is invalid.
-  if (queue->size < 0) {
-    return false;
-  }
-
   // If the code reaches this point, then the code is invalid.
   return false;
 }
@@ -374,15 +461,9 @@ void ArrayQueue_free(ArrayQueue* queue) {
     return;
   }
 
-  // If the collection is empty, free the queue and return.
-  if (queue->size == 0) {
-    free(queue);
-    return;
-  }
-
-
-  // Free the collection.
+  // Free the collection, and any old collection left from a resize.
   free(queue->collection);
+  free(queue->old_collection);
   // Set the collection to NULL.
   queue->collection = NULL;
   // Free the queue.
@@ -7,7 +7,8 @@
  * This is a queue data type that can be used to store data in a FIFO data
  * structure.
  * This implementation is a queue that makes use of a dynamic array as 
- * the underlying collection.
+ * the underlying collection, used as a ring buffer so that neither enqueueing
+ * nor dequeueing has to move the other elements.
  * The data stored in the array is a void pointers which is dynamically allocated
  * to the heap.
 */
@@ -19,10 +20,50 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include <string.h>
+#include <stdint.h>
 
+/**
+ * The value returned in place of a size when there is none, such as when the
+ * queue is NULL.
+*/
+#define ARRAY_QUEUE_NPOS ((size_t) -1)
+
+/**
+ * The largest number of elements the queue can hold before the byte size of
+ * its collection would overflow a size_t.
+*/
+#define ARRAY_QUEUE_MAX_SIZE (SIZE_MAX / sizeof(void*))
+
+/**
+ * The number of elements the collection of a queue holds when it is first
+ * allocated. The capacity doubles each time the queue is full.
+*/
+#define ARRAY_QUEUE_DEFAULT_CAPACITY 8
+
+/**
+ * The most slots an enqueue or dequeue moves from the old collection to the
+ * new one while a queue in incremental resize mode is growing.
+*/
+#define ARRAY_QUEUE_INCREMENTAL_STEP 16
+
+/**
+ * The elements are stored from head onwards, wrapping around to the start of
+ * the collection. While a queue in incremental resize mode is growing, the
+ * slots of the collection from migrated up to migrate_end have not been filled
+ * yet, and their elements are still in old_collection, starting at old_head.
+ * old_collection is NULL the rest of the time.
+*/
 typedef struct ArrayQueue {
   void** collection;
-  int size;
+  size_t head;
+  size_t size;
+  size_t capacity;
+  bool incremental;
+  void** old_collection;
+  size_t old_head;
+  size_t old_capacity;
+  size_t migrated;
+  size_t migrate_end;
 } ArrayQueue;
 
 /**
@@ -63,13 +104,26 @@ void* ArrayQueue_dequeue(ArrayQueue*);
 */
 void* ArrayQueue_peek(ArrayQueue*);
 
+/**
+ * Turns incremental resize mode on or off for the queue. In this mode,
+ * growing the collection allocates the larger collection without copying into
+ * it, and each following enqueue and dequeue moves at most
+ * ARRAY_QUEUE_INCREMENTAL_STEP elements across, so no single enqueue copies
+ * the whole queue. Turning the mode off finishes any move in progress.
+ * 
+ * @param ArrayQueue* The queue to change the resize mode of.
+ * @param bool        true to resize incrementally, false to resize all at once.
+ * @return true if the resize mode was changed, false if the queue is NULL.
+*/
+bool ArrayQueue_setIncrementalResize(ArrayQueue*, bool);
+
 /**
  * Gets the size of the queue.
  * 
  * @param ArrayQueue* The queue to get the size of.
- * @return The size of the queue.
+ * @return The size of the queue, or ARRAY_QUEUE_NPOS if the queue is NULL.
 */
-int ArrayQueue_size(ArrayQueue*);
+size_t ArrayQueue_size(ArrayQueue*);
 
 /**
  * Checks if the queue is empty.
@@ -60,6 +60,11 @@ bool ArrayStack_push(ArrayStack* stack, void* data) {
     return true;
   }
 
+  // If the collection cannot grow without overflowing, return false.
+  if (stack->size >= ARRAY_STACK_MAX_SIZE) {
+    return false;
+  }
+
   if (stack->size > 0) {
     void** new_collection = realloc(stack->collection, sizeof(void*) * (stack->size + 1));
     // If the memory allocation failed, return false.
@@ -159,12 +164,12 @@ void* ArrayStack_peek(ArrayStack* stack) {
  * Gets the size of the stack.
  * 
  * @param ArrayStack* The stack to get the size of.
- * @return The size of the stack.
+ * @return The size of the stack, or ARRAY_STACK_NPOS if the stack is NULL.
 */
-int ArrayStack_size(ArrayStack* stack) {
-  // If the stack is NULL, return 0.
+size_t ArrayStack_size(ArrayStack* stack) {
+  // If the stack is NULL, return ARRAY_STACK_NPOS.
   if (stack == NULL) {
-    return -1;
+    return ARRAY_STACK_NPOS;
   }
 
   // Return the size of the stack.
@@ -205,7 +210,7 @@ void ArrayStack_print(ArrayStack* stack) {
 
   // Print the stack.
   printf("[ ");
-  for (int i = 0; i < stack->size; i++) {
+  for (size_t i = 0; i < stack->size; i++) {
     printf("%p ", stack->collection[i]);
   }
   printf("]\n");
@@ -229,7 +234,7 @@ void ArrayStack_printInt(ArrayStack* stack) {
 
   // Print the stack.
   printf("[ ");
-  for (int i = 0; i < stack->size; i++) {
+  for (size_t i = 0; i < stack->size; i++) {
     printf("%d ", *(int*)stack->collection[i]);
   }
   printf("]\n");
@@ -19,10 +19,23 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include <string.h>
+#include <stdint.h>
+
+/**
+ * The value returned in place of a size when there is none, such as when the
+ * stack is NULL.
+*/
+#define ARRAY_STACK_NPOS ((size_t) -1)
+
+/**
+ * The largest number of elements the stack can hold before the byte size of
+ * its collection would overflow a size_t.
+*/
+#define ARRAY_STACK_MAX_SIZE (SIZE_MAX / sizeof(void*))
 
 typedef struct ArrayStack {
   void** collection;
-  int size;
+  size_t size;
 } ArrayStack;
 
 /**
@@ -67,9 +80,9 @@ void* ArrayStack_peek(ArrayStack*);
  * Gets the size of the stack.
  * 
  * @param ArrayStack* The stack to get the size of.
- * @return The size of the stack.
+ * @return The size of the stack, or ARRAY_STACK_NPOS if the stack is NULL.
 */
-int ArrayStack_size(ArrayStack*);
+size_t ArrayStack_size(ArrayStack*);
 
 /**
  * Checks if the stack is empty.
@@ -0,0 +1,249 @@
+/**
+ * @file int_compat.h
+ * @brief Compatibility layer for the int based sizes and indices
+ * @author Jonathan E
+ * @date 17-10-2026
+ *
+ * The data types in this library use size_t for their sizes and indices, with a
+ * per type NPOS value standing in for the old -1 results.
+ * This header provides int wrappers with the previous signatures for callers
+ * that have not moved to size_t yet. Negative indices are rejected, and sizes
+ * or indices that are NPOS or do not fit in an int are returned as -1.
+ * The wrappers are static inline so including this header adds no objects to
+ * link against.
+*/
+
+#ifndef INT_COMPAT_H
+#define INT_COMPAT_H
+
+#include <limits.h>
+
+#include "../array_list/array_list.h"
+#include "../array_queue/array_queue.h"
+#include "../array_stack/array_stack.h"
+#include "../linked_list/linked_list.h"
+#include "../queue/queue.h"
+#include "../stack/stack.h"
+
+/**
+ * Converts a size_t size or index to an int.
+ *
+ * @param size_t The value to convert.
+ * @return The value as an int, or -1 if it does not fit in an int, which
+ *         includes every NPOS value.
+*/
+static inline int IntCompat_toInt(size_t value) {
+  // If the value does not fit in an int, return -1.
+  if (value > (size_t) INT_MAX) {
+    return -1;
+  }
+
+  return (int) value;
+}
+
+/**
+ * Creates a new array list with the given initial capacity.
+ *
+ * @param int The initial capacity of the array list.
+ * @return A pointer to the new array list, or NULL if the capacity is negative
+ *         or the memory allocation failed.
+*/
+static inline ArrayList* new_ArrayListWithCapacityInt(int capacity) {
+  // If the capacity is negative, return NULL.
+  if (capacity < 0) {
+    return NULL;
+  }
+
+  return new_ArrayListWithCapacity((size_t) capacity);
+}
+
+/**
+ * Removes the element at the given index from the array list.
+ *
+ * @param ArrayList* The array list to remove the element from.
+ * @param int        The index of the element to remove.
+ * @return true if the element was removed, false otherwise.
+*/
+static inline bool ArrayList_removeInt(ArrayList* list, int index) {
+  // If the index is negative, return false.
+  if (index < 0) {
+    return false;
+  }
+
+  return ArrayList_remove(list, (size_t) index);
+}
+
+/**
+ * Gets the element at the given index of the array list.
+ *
+ * @param ArrayList* The array list to get the element from.
+ * @param int        The index of the element to get.
+ * @return The element at the given index, or NULL if the index is out of bounds.
+*/
+static inline void* ArrayList_getInt(ArrayList* list, int index) {
+  // If the index is negative, return NULL.
+  if (index < 0) {
+    return NULL;
+  }
+
+  return ArrayList_get(list, (size_t) index);
+}
+
+/**
+ * Gets the size of the array list.
+ *
+ * @param ArrayList* The array list to get the size of.
+ * @return The size of the array list, or -1 if the array list is NULL or its
+ *         size does not fit in an int.
+*/
+static inline int ArrayList_sizeInt(ArrayList* list) {
+  return IntCompat_toInt(ArrayList_size(list));
+}
+
+/**
+ * Gets the capacity of the array list.
+ *
+ * @param ArrayList* The array list to get the capacity of.
+ * @return The capacity of the array list, or -1 if the array list is NULL or
+ *         its capacity does not fit in an int.
+*/
+static inline int ArrayList_capacityInt(ArrayList* list) {
+  return IntCompat_toInt(ArrayList_capacity(list));
+}
+
+/**
+ * Gets the index of the first occurrence of the element in the array list.
+ *
+ * @param ArrayList* The array list to search.
+ * @param void*      The element to search for.
+ * @return The index of the element, or -1 if it is not found or its index does
+ *         not fit in an int.
+*/
+static inline int ArrayList_indexOfInt(ArrayList* list, void* data) {
+  return IntCompat_toInt(ArrayList_indexOf(list, data));
+}
+
+/**
+ * Gets the index of the last occurrence of the element in the array list.
+ *
+ * @param ArrayList* The array list to search.
+ * @param void*      The element to search for.
+ * @return The index of the element, or -1 if it is not found or its index does
+ *         not fit in an int.
+*/
+static inline int ArrayList_lastIndexOfInt(ArrayList* list, void* data) {
+  return IntCompat_toInt(ArrayList_lastIndexOf(list, data));
+}
+
+/**
+ * Counts the occurrences of the element in the array list.
+ *
+ * @param ArrayList* The array list to search.
+ * @param void*      The element to count.
+ * @return The number of occurrences, or -1 if the array list is NULL or the
+ *         count does not fit in an int.
+*/
+static inline int ArrayList_countInt(ArrayList* list, void* data) {
+  return IntCompat_toInt(ArrayList_count(list, data));
+}
+
+/**
+ * Gets the size of the array queue.
+ *
+ * @param ArrayQueue* The queue to get the size of.
+ * @return The size of the queue, or -1 if the queue is NULL or its size does
+ *         not fit in an int.
+*/
+static inline int ArrayQueue_sizeInt(ArrayQueue* queue) {
+  return IntCompat_toInt(ArrayQueue_size(queue));
+}
+
+/**
+ * Gets the size of the array stack.
+ *
+ * @param ArrayStack* The stack to get the size of.
+ * @return The size of the stack, or -1 if the stack is NULL or its size does
+ *         not fit in an int.
+*/
+static inline int ArrayStack_sizeInt(ArrayStack* stack) {
+  return IntCompat_toInt(ArrayStack_size(stack));
+}
+
+/**
+ * Removes the node at the given index from the linked list.
+ *
+ * @param LinkedList* The linked list to remove the node from.
+ * @param int         The index of the node to remove.
+ * @return true if the node was removed, false otherwise.
+*/
+static inline bool LinkedList_removeInt(LinkedList* list, int index) {
+  // If the index is negative, return false.
+  if (index < 0) {
+    return false;
+  }
+
+  return LinkedList_remove(list, (size_t) index);
+}
+
+/**
+ * Gets the data from the node at the given index of the linked list.
+ *
+ * @param LinkedList* The linked list to get the data from.
+ * @param int         The index of the node to get the data from.
+ * @return The data at the given index, or NULL if the index is out of bounds.
+*/
+static inline void* LinkedList_getInt(LinkedList* list, int index) {
+  // If the index is negative, return NULL.
+  if (index < 0) {
+    return NULL;
+  }
+
+  return LinkedList_get(list, (size_t) index);
+}
+
+/**
+ * Gets the size of the linked list.
+ *
+ * @param LinkedList* The linked list to get the size of.
+ * @return The size of the linked list, or -1 if the list is NULL or its size
+ *         does not fit in an int.
+*/
+static inline int LinkedList_sizeInt(LinkedList* list) {
+  return IntCompat_toInt(LinkedList_size(list));
+}
+
+/**
+ * Gets the index of the node with the given data in the linked list.
+ *
+ * @param LinkedList* The linked list to search.
+ * @param void*       The data to search for.
+ * @return The index of the data, or -1 if it is not found or its index does
+ *         not fit in an int.
+*/
+static inline int LinkedList_indexOfInt(LinkedList* list, void* data) {
+  return IntCompat_toInt(LinkedList_indexOf(list, data));
+}
+
+/**
+ * Gets the size of the queue.
+ *
+ * @param Queue* The queue to get the size of.
+ * @return The size of the queue, or -1 if the queue is NULL or its size does
+ *         not fit in an int.
+*/
+static inline int Queue_sizeInt(Queue* queue) {
+  return IntCompat_toInt(Queue_size(queue));
+}
+
+/**
+ * Gets the size of the stack.
+ *
+ * @param Stack* The stack to get the size of.
+ * @return The size of the stack, or -1 if the stack is NULL or its size does
+ *         not fit in an int.
+*/
+static inline int Stack_sizeInt(Stack* stack) {
+  return IntCompat_toInt(Stack_size(stack));
+}
+
+#endif /* INT_COMPAT_H */
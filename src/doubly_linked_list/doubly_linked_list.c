@@ -0,0 +1,474 @@
+/**
+ * @file doubly_linked_list.c
+ * @brief Doubly linked list data type implementation
+ * @author Jonathan E
+ * @date 17-10-2026
+ * 
+ * This is an implementation of a doubly linked list data type that can be used
+ * to store generic data.
+ * Each node links to the node before it as well as the node after it, so the
+ * ends of the list, and any node whose address is known, can be removed in
+ * O(1), and the list can be walked in both directions.
+ * The data stored in the nodes is a void pointer which is dynamically allocated
+ * to the heap.
+*/
+
+#include "doubly_linked_list.h"
+
+/**
+ * Creates a new node holding the given data, linked to nothing.
+ * 
+ * @param void* the data to be stored in the node.
+ * @return the new node, or NULL if the memory allocation failed.
+*/
+static DoublyList_Node* DoublyLinkedList_newNode(void* data) {
+  DoublyList_Node* new_node = malloc(sizeof(DoublyList_Node));
+  // If the memory allocation failed, return NULL.
+  if (new_node == NULL) {
+    return NULL;
+  }
+
+  new_node->data = data;
+  new_node->prev = NULL;
+  new_node->next = NULL;
+  return new_node;
+}
+
+/**
+ * Finds the node at the given index, walking from the head or the tail,
+ * whichever is nearer.
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+ * @param size_t            the index of the node, which must be in bounds.
+ * @return the node at the given index.
+*/
+static DoublyList_Node* DoublyLinkedList_nodeAt(DoublyLinkedList* list, size_t index) {
+  DoublyList_Node* node;
+  if (index < list->size / 2) {
+    node = list->head;
+    for (size_t i = 0; i < index; i++) {
+      node = node->next;
+    }
+  } else {
+    node = list->tail;
+    for (size_t i = list->size - 1; i > index; i--) {
+      node = node->prev;
+    }
+  }
+  return node;
+}
+
+/**
+ * Creates a new doubly linked list using a node structure as the underlying
+ * collection.
+ * This function uses malloc to allocate memory for the doubly linked list.
+ * 
+ * @return A pointer to the new doubly linked list, or NULL if the memory
+ *         allocation failed.
+*/
+DoublyLinkedList* new_DoublyLinkedList() {
+  DoublyLinkedList* list = malloc(sizeof(DoublyLinkedList));
+  // If the memory allocation failed, return NULL.
+  if (list == NULL) {
+    return NULL;
+  }
+
+  // Initialise the list.
+  list->head = NULL;
+  list->tail = NULL;
+  list->size = 0;
+  return list;
+}
+
+/**
+ * Adds a new node to the end of the doubly linked list in O(1).
+ * Note that the data is not copied, but rather the pointer to the data is
+ * stored in the node.
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+ * @param void*             the data to be stored in the node.
+ * @return true if the node was added successfully, false otherwise.
+*/
+bool DoublyLinkedList_add(DoublyLinkedList* list, void* data) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  DoublyList_Node* new_node = DoublyLinkedList_newNode(data);
+  // If the memory allocation failed, return false.
+  if (new_node == NULL) {
+    return false;
+  }
+
+  // Link the node in after the tail.
+  new_node->prev = list->tail;
+  if (list->tail == NULL) {
+    list->head = new_node;
+  } else {
+    list->tail->next = new_node;
+  }
+  list->tail = new_node;
+
+  list->size++;
+  return true;
+}
+
+/**
+ * Adds a new node to the start of the doubly linked list in O(1).
+ * Note that the data is not copied, but rather the pointer to the data is
+ * stored in the node.
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+ * @param void*             the data to be stored in the node.
+ * @return true if the node was added successfully, false otherwise.
+*/
+bool DoublyLinkedList_addFirst(DoublyLinkedList* list, void* data) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  // If the list is empty, adding to the start is adding to the end.
+  if (list->head == NULL) {
+    return DoublyLinkedList_add(list, data);
+  }
+
+  return DoublyLinkedList_insertBefore(list, list->head, data);
+}
+
+/**
+ * Inserts a new node before the given node of the doubly linked list in O(1).
+ * Note that the data is not copied, but rather the pointer to the data is
+ * stored in the node.
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+ * @param DoublyList_Node*  the node to insert before, which must be in the
+ *                          doubly linked list.
+ * @param void*             the data to be stored in the node.
+ * @return true if the node was inserted successfully, false otherwise.
+*/
+bool DoublyLinkedList_insertBefore(DoublyLinkedList* list, DoublyList_Node* node, void* data) {
+  // If the list or the node is NULL, return false.
+  if (list == NULL || node == NULL) {
+    return false;
+  }
+
+  DoublyList_Node* new_node = DoublyLinkedList_newNode(data);
+  // If the memory allocation failed, return false.
+  if (new_node == NULL) {
+    return false;
+  }
+
+  // Link the node in between the given node and the one before it.
+  new_node->prev = node->prev;
+  new_node->next = node;
+  if (node->prev == NULL) {
+    list->head = new_node;
+  } else {
+    node->prev->next = new_node;
+  }
+  node->prev = new_node;
+
+  list->size++;
+  return true;
+}
+
+/**
+ * Removes the given node from the doubly linked list in O(1).
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+ * @param DoublyList_Node*  the node to remove, which must be in the doubly
+ *                          linked list.
+ * @return true if the node was removed successfully, false otherwise.
+*/
+bool DoublyLinkedList_removeNode(DoublyLinkedList* list, DoublyList_Node* node) {
+  // If the list or the node is NULL, return false.
+  if (list == NULL || node == NULL) {
+    return false;
+  }
+
+  // Link the nodes on either side to each other, or move the ends in.
+  if (node->prev == NULL) {
+    list->head = node->next;
+  } else {
+    node->prev->next = node->next;
+  }
+  if (node->next == NULL) {
+    list->tail = node->prev;
+  } else {
+    node->next->prev = node->prev;
+  }
+  free(node);
+
+  list->size--;
+  return true;
+}
+
+/**
+ * Removes the first node of the doubly linked list in O(1).
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+ * @return true if the node was removed successfully, false if the list is
+ *         empty or NULL.
+*/
+bool DoublyLinkedList_removeFirst(DoublyLinkedList* list) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  return DoublyLinkedList_removeNode(list, list->head);
+}
+
+/**
+ * Removes the last node of the doubly linked list in O(1).
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+ * @return true if the node was removed successfully, false if the list is
+ *         empty or NULL.
+*/
+bool DoublyLinkedList_removeLast(DoublyLinkedList* list) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  return DoublyLinkedList_removeNode(list, list->tail);
+}
+
+/**
+ * Removes a given index from the doubly linked list, walking from whichever
+ * end of the list is nearer.
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+ * @param size_t            the index of the node to be removed.
+ * @return true if the node was removed successfully, false otherwise.
+*/
+bool DoublyLinkedList_remove(DoublyLinkedList* list, size_t index) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  // If the index is out of bounds, return false.
+  if (index >= list->size) {
+    return false;
+  }
+
+  return DoublyLinkedList_removeNode(list, DoublyLinkedList_nodeAt(list, index));
+}
+
+/**
+ * Gets the data from the node at the specified index, walking from whichever
+ * end of the list is nearer.
+ * Note that the data is not copied, but rather the pointer to the data is
+ * returned.
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+ * @param size_t            the index of the node to get the data from.
+ * @return the data from the node at the specified index, or NULL if the index
+ *         is out of bounds.
+*/
+void* DoublyLinkedList_get(DoublyLinkedList* list, size_t index) {
+  // If the list is NULL, return NULL.
+  if (list == NULL) {
+    return NULL;
+  }
+
+  // If the index is out of bounds, return NULL.
+  if (index >= list->size) {
+    return NULL;
+  }
+
+  return DoublyLinkedList_nodeAt(list, index)->data;
+}
+
+/**
+ * Gets the first node of the doubly linked list, from which the list can be
+ * walked forwards by following next.
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+ * @return the first node, or NULL if the list is empty or NULL.
+*/
+DoublyList_Node* DoublyLinkedList_first(DoublyLinkedList* list) {
+  // If the list is NULL, return NULL.
+  if (list == NULL) {
+    return NULL;
+  }
+
+  return list->head;
+}
+
+/**
+ * Gets the last node of the doubly linked list, from which the list can be
+ * walked backwards by following prev.
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+ * @return the last node, or NULL if the list is empty or NULL.
+*/
+DoublyList_Node* DoublyLinkedList_last(DoublyLinkedList* list) {
+  // If the list is NULL, return NULL.
+  if (list == NULL) {
+    return NULL;
+  }
+
+  return list->tail;
+}
+
+/**
+ * Gets the size of the doubly linked list.
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+ * @return the size of the doubly linked list, or DOUBLY_LINKED_LIST_NPOS if
+ *         the list is NULL.
+*/
+size_t DoublyLinkedList_size(DoublyLinkedList* list) {
+  // If the list is NULL, return DOUBLY_LINKED_LIST_NPOS.
+  if (list == NULL) {
+    return DOUBLY_LINKED_LIST_NPOS;
+  }
+
+  return list->size;
+}
+
+/**
+ * Checks if the doubly linked list is empty.
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+ * @return true if the doubly linked list is empty, false otherwise.
+*/
+bool DoublyLinkedList_isEmpty(DoublyLinkedList* list) {
+  // If the list is NULL, return true.
+  if (list == NULL) {
+    return true;
+  }
+
+  return list->size == 0;
+}
+
+/**
+ * Checks if the doubly linked list contains the specified data.
+ * The pointer to the data is checked, not the data itself.
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+ * @param void*             the data to check for.
+ * @return true if the doubly linked list contains the specified data, false
+ *         otherwise.
+*/
+bool DoublyLinkedList_contains(DoublyLinkedList* list, void* data) {
+  return DoublyLinkedList_indexOf(list, data) != DOUBLY_LINKED_LIST_NPOS;
+}
+
+/**
+ * Gets the index of the node with the specified data.
+ * The pointer to the data is checked, not the data itself.
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+ * @param void*             the data to check for.
+ * @return the index of the node with the specified data, or
+ *         DOUBLY_LINKED_LIST_NPOS if the data is not found.
+*/
+size_t DoublyLinkedList_indexOf(DoublyLinkedList* list, void* data) {
+  // If the list is NULL, return DOUBLY_LINKED_LIST_NPOS.
+  if (list == NULL) {
+    return DOUBLY_LINKED_LIST_NPOS;
+  }
+
+  // Find the node with the specified data.
+  DoublyList_Node* node = list->head;
+  size_t index = 0;
+  while (node != NULL) {
+    if (node->data == data) {
+      return index;
+    }
+    node = node->next;
+    index++;
+  }
+
+  return DOUBLY_LINKED_LIST_NPOS;
+}
+
+/**
+ * Prints the doubly linked list as a list of pointers.
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+*/
+void DoublyLinkedList_print(DoublyLinkedList* list) {
+  // If the list is NULL, return.
+  if (list == NULL) {
+    printf("NULL\n");
+    return;
+  }
+
+  // Print the list.
+  printf("[");
+  DoublyList_Node* node = list->head;
+  while (node != NULL) {
+    printf("%p ", node->data);
+    node = node->next;
+  }
+  printf("]\n");
+}
+
+/**
+ * Prints the doubly linked list as a list of integers.
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+*/
+void DoublyLinkedList_printInt(DoublyLinkedList* list) {
+  // If the list is NULL, return.
+  if (list == NULL) {
+    printf("NULL\n");
+    return;
+  }
+
+  // Print the list.
+  printf("[");
+  DoublyList_Node* node = list->head;
+  while (node != NULL) {
+    printf("%d ", *(int*)node->data);
+    node = node->next;
+  }
+  printf("]\n");
+}
+
+/**
+ * Clears the doubly linked list.
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+ * @return true if the nodes were removed successfully, false otherwise.
+*/
+bool DoublyLinkedList_clear(DoublyLinkedList* list) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  // Remove all nodes.
+  while (list->head != NULL) {
+    DoublyList_Node* node = list->head;
+    list->head = list->head->next;
+    free(node);
+  }
+
+  list->tail = NULL;
+  list->size = 0;
+  return true;
+}
+
+/**
+ * Frees the memory allocated for the doubly linked list.
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+*/
+void DoublyLinkedList_free(DoublyLinkedList* list) {
+  // If the list is NULL, return.
+  if (list == NULL) {
+    return;
+  }
+
+  // Remove all nodes, then deallocate the list.
+  DoublyLinkedList_clear(list);
+  free(list);
+}
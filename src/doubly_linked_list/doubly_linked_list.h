@@ -0,0 +1,228 @@
+/**
+ * @file doubly_linked_list.h
+ * @brief Doubly linked list data type implementation using a node structure
+ * @author Jonathan E
+ * @date 17-10-2026
+ * 
+ * This is a linked list data type that can be used to store data in a doubly
+ * linked list structure.
+ * Each node links to the node before it as well as the node after it, so
+ * either end of the list can be removed in O(1), a node can be unlinked in
+ * O(1) given only its address, and the list can be walked in both directions.
+ * The data stored in the nodes is a void pointer which is dynamically allocated
+ * to the heap.
+*/
+
+#ifndef DOUBLY_LINKED_LIST_H
+#define DOUBLY_LINKED_LIST_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * The value returned in place of a size or index when there is none, such as
+ * when the doubly linked list is NULL or an element is not found.
+*/
+#define DOUBLY_LINKED_LIST_NPOS ((size_t) -1)
+
+/**
+ * A node of a doubly linked list. prev is NULL at the head, and next is NULL
+ * at the tail. The nodes can be followed in either direction to walk the list,
+ * and a node stays at the same address until it is removed.
+*/
+typedef struct DoublyList_Node {
+  void* data;
+  struct DoublyList_Node* prev;
+  struct DoublyList_Node* next;
+} DoublyList_Node;
+
+typedef struct DoublyLinkedList {
+  DoublyList_Node* head;
+  DoublyList_Node* tail;
+  size_t size;
+} DoublyLinkedList;
+
+/**
+ * Creates a new doubly linked list using a series of nodes as the underlying
+ * collection.
+ * 
+ * @return A pointer to the new doubly linked list.
+*/
+DoublyLinkedList* new_DoublyLinkedList();
+
+/**
+ * Adds a new node to the end of the doubly linked list in O(1).
+ * Note that the data is not copied, but rather the pointer to the data is
+ * stored in the node.
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+ * @param void*             the data to be stored in the node.
+ * @return true if the node was added successfully, false otherwise.
+*/
+bool DoublyLinkedList_add(DoublyLinkedList*, void*);
+
+/**
+ * Adds a new node to the start of the doubly linked list in O(1).
+ * Note that the data is not copied, but rather the pointer to the data is
+ * stored in the node.
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+ * @param void*             the data to be stored in the node.
+ * @return true if the node was added successfully, false otherwise.
+*/
+bool DoublyLinkedList_addFirst(DoublyLinkedList*, void*);
+
+/**
+ * Inserts a new node before the given node of the doubly linked list in O(1).
+ * Note that the data is not copied, but rather the pointer to the data is
+ * stored in the node.
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+ * @param DoublyList_Node*  the node to insert before, which must be in the
+ *                          doubly linked list.
+ * @param void*             the data to be stored in the node.
+ * @return true if the node was inserted successfully, false otherwise.
+*/
+bool DoublyLinkedList_insertBefore(DoublyLinkedList*, DoublyList_Node*, void*);
+
+/**
+ * Removes the given node from the doubly linked list in O(1).
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+ * @param DoublyList_Node*  the node to remove, which must be in the doubly
+ *                          linked list.
+ * @return true if the node was removed successfully, false otherwise.
+*/
+bool DoublyLinkedList_removeNode(DoublyLinkedList*, DoublyList_Node*);
+
+/**
+ * Removes the first node of the doubly linked list in O(1).
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+ * @return true if the node was removed successfully, false if the list is
+ *         empty or NULL.
+*/
+bool DoublyLinkedList_removeFirst(DoublyLinkedList*);
+
+/**
+ * Removes the last node of the doubly linked list in O(1).
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+ * @return true if the node was removed successfully, false if the list is
+ *         empty or NULL.
+*/
+bool DoublyLinkedList_removeLast(DoublyLinkedList*);
+
+/**
+ * Removes a given index from the doubly linked list, walking from whichever
+ * end of the list is nearer.
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+ * @param size_t            the index of the node to be removed.
+ * @return true if the node was removed successfully, false otherwise.
+*/
+bool DoublyLinkedList_remove(DoublyLinkedList*, size_t);
+
+/**
+ * Gets the data from the node at the specified index, walking from whichever
+ * end of the list is nearer.
+ * Note that the data is not copied, but rather the pointer to the data is
+ * returned.
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+ * @param size_t            the index of the node to get the data from.
+ * @return the data from the node at the specified index, or NULL if the index
+ *         is out of bounds.
+*/
+void* DoublyLinkedList_get(DoublyLinkedList*, size_t);
+
+/**
+ * Gets the first node of the doubly linked list, from which the list can be
+ * walked forwards by following next.
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+ * @return the first node, or NULL if the list is empty or NULL.
+*/
+DoublyList_Node* DoublyLinkedList_first(DoublyLinkedList*);
+
+/**
+ * Gets the last node of the doubly linked list, from which the list can be
+ * walked backwards by following prev.
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+ * @return the last node, or NULL if the list is empty or NULL.
+*/
+DoublyList_Node* DoublyLinkedList_last(DoublyLinkedList*);
+
+/**
+ * Gets the size of the doubly linked list.
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+ * @return the size of the doubly linked list, or DOUBLY_LINKED_LIST_NPOS if
+ *         the list is NULL.
+*/
+size_t DoublyLinkedList_size(DoublyLinkedList*);
+
+/**
+ * Checks if the doubly linked list is empty.
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+ * @return true if the doubly linked list is empty, false otherwise.
+*/
+bool DoublyLinkedList_isEmpty(DoublyLinkedList*);
+
+/**
+ * Checks if the doubly linked list contains the specified data.
+ * The pointer to the data is checked, not the data itself.
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+ * @param void*             the data to be checked.
+ * @return true if the doubly linked list contains the specified data, false
+ *         otherwise.
+*/
+bool DoublyLinkedList_contains(DoublyLinkedList*, void*);
+
+/**
+ * Gets the index of the specified data in the doubly linked list.
+ * The pointer to the data is checked, not the data itself.
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+ * @param void*             the data to be checked.
+ * @return the index of the specified data, or DOUBLY_LINKED_LIST_NPOS if the
+ *         data is not in the doubly linked list.
+*/
+size_t DoublyLinkedList_indexOf(DoublyLinkedList*, void*);
+
+/**
+ * Prints the doubly linked list as a list of pointers.
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+*/
+void DoublyLinkedList_print(DoublyLinkedList*);
+
+/**
+ * Prints the doubly linked list as a list of integers.
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+*/
+void DoublyLinkedList_printInt(DoublyLinkedList*);
+
+/**
+ * Clears the given doubly linked list.
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+ * @return true if the doubly linked list was cleared successfully, false
+ *         otherwise.
+*/
+bool DoublyLinkedList_clear(DoublyLinkedList*);
+
+/**
+ * Frees the memory allocated to the doubly linked list.
+ * 
+ * @param DoublyLinkedList* the pointer to the doubly linked list.
+*/
+void DoublyLinkedList_free(DoublyLinkedList*);
+
+#endif /* DOUBLY_LINKED_LIST_H */
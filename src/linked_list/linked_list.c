@@ -14,6 +14,31 @@
 
 #include "linked_list.h"
 
+/**
+ * Finds the node at the given index, starting from the finger when the index
+ * is at or after it and from the head otherwise, then moves the finger there.
+ * 
+ * @param LinkedList* the pointer to the linked list.
+ * @param size_t      the index of the node, which must be in bounds.
+ * @return the node at the given index.
+*/
+static List_Node* LinkedList_nodeAt(LinkedList* list, size_t index) {
+  List_Node* node = list->head;
+  size_t i = 0;
+  if (list->finger != NULL && list->finger_index <= index) {
+    node = list->finger;
+    i = list->finger_index;
+  }
+
+  for (; i < index; i++) {
+    node = node->next;
+  }
+
+  list->finger = node;
+  list->finger_index = index;
+  return node;
+}
+
 /**
  * Creates a new linked list using a node structure as the underlying collection.
  * This function uses malloc to allocate memory for the linked list.
@@ -32,6 +57,8 @@ LinkedList* new_LinkedList() {
   list->head = NULL;
   list->tail = NULL;
   list->size = 0;
+  list->finger = NULL;
+  list->finger_index = 0;
   return list;
 }
 
@@ -74,38 +101,103 @@ bool LinkedList_add(LinkedList* list, void* data) {
 }
 
 /**
- * Removes a given index from the linked list.
+ * Inserts a new node at the given index of the linked list, walking from the
+ * finger when the index is past it.
+ * Note that the data is not copied, but rather the pointer to the data is
+ * stored in the node.
  * 
  * @param LinkedList* the pointer to the linked list.
- * @param int         the index of the node to be removed.
+ * @param size_t      the index to insert at, which may be the size of the list
+ *                    to add to the end.
+ * @param void*       the data to be stored in the node.
+ * @return true if the node was inserted successfully, false otherwise.
+*/
+bool LinkedList_insert(LinkedList* list, size_t index, void* data) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  // If the index is out of bounds, return false.
+  if (index > list->size) {
+    return false;
+  }
+
+  // If the index is the size, add the node to the end.
+  if (index == list->size) {
+    return LinkedList_add(list, data);
+  }
+
+  List_Node* new_node = malloc(sizeof(List_Node));
+  // If the memory allocation failed, return false.
+  if (new_node == NULL) {
+    return false;
+  }
+  new_node->data = data;
+
+  if (index == 0) {
+    // Make the node the head, which moves the finger up by one.
+    new_node->next = list->head;
+    list->head = new_node;
+    if (list->finger != NULL) {
+      list->finger_index++;
+    }
+  } else {
+    // Link the node in after the one before the index, which leaves the finger
+    // there.
+    List_Node* previous = LinkedList_nodeAt(list, index - 1);
+    new_node->next = previous->next;
+    previous->next = new_node;
+  }
+
+  list->size++;
+  return true;
+}
+
+/**
+ * Removes a given index from the linked list, walking from the finger when the
+ * index is past it.
+ * 
+ * @param LinkedList* the pointer to the linked list.
+ * @param size_t      the index of the node to be removed.
  * @return true if the node was removed successfully, false otherwise.
 */
-bool LinkedList_remove(LinkedList* list, int index) {
+bool LinkedList_remove(LinkedList* list, size_t index) {
   // If the list is NULL, return false.
   if (list == NULL) {
     return false;
   }
 
   // If the index is out of bounds, return false.
-  if (index < 0 || index >= list->size) {
+  if (index >= list->size) {
     return false;
   }
 
-  // If the index is 0, remove the head.
+  // If the index is 0, remove the head, which moves the finger down by one
+  // unless it is the head.
   if (index == 0) {
     List_Node* new_node = list->head;
+    if (list->finger == new_node) {
+      list->finger = NULL;
+    } else if (list->finger != NULL) {
+      list->finger_index--;
+    }
     list->head = list->head->next;
+    if (list->head == NULL) {
+      list->tail = NULL;
+    }
     free(new_node);
   } else {
-    // Find the node before the node to be removed.
-    List_Node* new_node = list->head;
-    for (int i = 0; i < index - 1; i++) {
-      new_node = new_node->next;
-    }
+    // Find the node before the node to be removed, which leaves the finger
+    // there.
+    List_Node* new_node = LinkedList_nodeAt(list, index - 1);
 
-    // Remove the node.
+    // Remove the node, moving the tail back if it was the last one.
     List_Node* temp = new_node->next;
     new_node->next = new_node->next->next;
+    if (list->tail == temp) {
+      list->tail = new_node;
+    }
     free(temp);
   }
 
@@ -117,42 +209,39 @@ bool LinkedList_remove(LinkedList* list, int index) {
  * Gets the data from the linked list at the specified index.
  * The data is stored in the node as a void pointer. Note that the data is not
  * copied, but rather the pointer to the data is returned.
+ * The walk starts from the finger when the index is at or past it, so getting
+ * each index in turn is O(1) per call.
  * 
  * @param LinkedList* the pointer to the linked list.
- * @param int         the index of the node to get the data from.
+ * @param size_t      the index of the node to get the data from.
  * @return the data from the node at the specified index, or NULL if the index
  *         is out of bounds.
 */
-void* LinkedList_get(LinkedList* list, int index) {
+void* LinkedList_get(LinkedList* list, size_t index) {
   // If the list is NULL, return NULL.
   if (list == NULL) {
     return NULL;
   }
 
   // If the index is out of bounds, return NULL.
-  if (index < 0 || index >= list->size) {
+  if (index >= list->size) {
     return NULL;
   }
 
-  // Find the node at the specified index.
-  List_Node* new_node = list->head;
-  for (int i = 0; i < index; i++) {
-    new_node = new_node->next;
-  }
-
-  return new_node->data;
+  return LinkedList_nodeAt(list, index)->data;
 }
 
 /**
  * Gets the size of the linked list.
  * 
  * @param LinkedList* the pointer to the linked list.
- * @return the size of the linked list, or -1 if the list is NULL.
+ * @return the size of the linked list, or LINKED_LIST_NPOS if the list is
+ *         NULL.
 */
-int LinkedList_size(LinkedList* list) {
-  // If the list is NULL, return 0.
+size_t LinkedList_size(LinkedList* list) {
+  // If the list is NULL, return LINKED_LIST_NPOS.
   if (list == NULL) {
-    return -1;
+    return LINKED_LIST_NPOS;
   }
 
   return list->size;
@@ -209,18 +298,18 @@ bool LinkedList_contains(LinkedList* list, void* data) {
  * 
  * @param LinkedList* the pointer to the linked list.
  * @param void*       the data to check for.
- * @return the index of the node with the specified data, or -1 if the data is
- *         not found.
+ * @return the index of the node with the specified data, or LINKED_LIST_NPOS
+ *         if the data is not found.
 */
-int LinkedList_indexOf(LinkedList* list, void* data) {
-  // If the list is NULL, return -1.
+size_t LinkedList_indexOf(LinkedList* list, void* data) {
+  // If the list is NULL, return LINKED_LIST_NPOS.
   if (list == NULL) {
-    return -1;
+    return LINKED_LIST_NPOS;
   }
 
   // Find the node with the specified data.
   List_Node* new_node = list->head;
-  int index = 0;
+  size_t index = 0;
   while (new_node != NULL) {
     if (new_node->data == data) {
       return index;
@@ -229,7 +318,153 @@ int LinkedList_indexOf(LinkedList* list, void* data) {
     index++;
   }
 
-  return -1;
+  return LINKED_LIST_NPOS;
+}
+
+/**
+ * Gets a cursor at the first node of the linked list, or past the end if the
+ * list is empty or NULL.
+ * 
+ * @param LinkedList* the pointer to the linked list.
+ * @return the cursor at the head of the linked list.
+*/
+LinkedListCursor LinkedList_begin(LinkedList* list) {
+  LinkedListCursor cursor;
+  cursor.list = list;
+  cursor.node = list == NULL ? NULL : list->head;
+  return cursor;
+}
+
+/**
+ * Checks if the cursor is past the end of its linked list.
+ * 
+ * @param LinkedListCursor* the pointer to the cursor.
+ * @return true if the cursor is past the end or NULL, false otherwise.
+*/
+bool LinkedListCursor_atEnd(LinkedListCursor* cursor) {
+  // If the cursor is NULL, return true.
+  if (cursor == NULL) {
+    return true;
+  }
+
+  return cursor->node == NULL;
+}
+
+/**
+ * Moves the cursor to the next node in O(1).
+ * 
+ * @param LinkedListCursor* the pointer to the cursor.
+ * @return true if the cursor moved, false if it was already past the end.
+*/
+bool LinkedListCursor_next(LinkedListCursor* cursor) {
+  // If the cursor is NULL or past the end, return false.
+  if (cursor == NULL || cursor->node == NULL) {
+    return false;
+  }
+
+  cursor->node = cursor->node->next;
+  return true;
+}
+
+/**
+ * Gets the data from the node at the cursor.
+ * Note that the data is not copied, but rather the pointer to the data is
+ * returned.
+ * 
+ * @param LinkedListCursor* the pointer to the cursor.
+ * @return the data from the node at the cursor, or NULL if the cursor is past
+ *         the end.
+*/
+void* LinkedListCursor_get(LinkedListCursor* cursor) {
+  // If the cursor is NULL or past the end, return NULL.
+  if (cursor == NULL || cursor->node == NULL) {
+    return NULL;
+  }
+
+  return cursor->node->data;
+}
+
+/**
+ * Inserts a new node after the node at the cursor in O(1), leaving the cursor
+ * where it is. A cursor past the end appends the node to the end of the list
+ * instead, so a run of inserts from there keeps its order.
+ * Note that the data is not copied, but rather the pointer to the data is
+ * stored in the node.
+ * 
+ * @param LinkedListCursor* the pointer to the cursor.
+ * @param void*             the data to be stored in the node.
+ * @return true if the node was inserted successfully, false otherwise.
+*/
+bool LinkedListCursor_insertAfter(LinkedListCursor* cursor, void* data) {
+  // If the cursor or its list is NULL, return false.
+  if (cursor == NULL || cursor->list == NULL) {
+    return false;
+  }
+
+  // If the cursor is past the end, append the data.
+  if (cursor->node == NULL) {
+    return LinkedList_add(cursor->list, data);
+  }
+
+  List_Node* new_node = malloc(sizeof(List_Node));
+  // If the memory allocation failed, return false.
+  if (new_node == NULL) {
+    return false;
+  }
+
+  // The index of the finger is only known to be unchanged if it is the node at
+  // the cursor.
+  if (cursor->list->finger != cursor->node) {
+    cursor->list->finger = NULL;
+  }
+
+  // Link the node in after the cursor.
+  new_node->data = data;
+  new_node->next = cursor->node->next;
+  cursor->node->next = new_node;
+  if (cursor->list->tail == cursor->node) {
+    cursor->list->tail = new_node;
+  }
+
+  cursor->list->size++;
+  return true;
+}
+
+/**
+ * Removes the node after the node at the cursor in O(1), leaving the cursor
+ * where it is.
+ * 
+ * @param LinkedListCursor* the pointer to the cursor.
+ * @return true if the node was removed successfully, false if the cursor is
+ *         at the last node or past the end.
+*/
+bool LinkedListCursor_removeNext(LinkedListCursor* cursor) {
+  // If the cursor or its list is NULL, return false.
+  if (cursor == NULL || cursor->list == NULL) {
+    return false;
+  }
+
+  // If there is no node after the cursor, return false.
+  if (cursor->node == NULL || cursor->node->next == NULL) {
+    return false;
+  }
+
+  // The index of the finger is only known to be unchanged if it is the node at
+  // the cursor.
+  if (cursor->list->finger != cursor->node) {
+    cursor->list->finger = NULL;
+  }
+
+  // Unlink the node after the cursor.
+  List_Node* temp = cursor->node->next;
+  cursor->node->next = temp->next;
+  if (cursor->list->tail == temp) {
+    cursor->list->tail = cursor->node;
+  }
+  free(temp);
+
+  cursor->list->size--;
+  return true;
 }
 
 /**
@@ -295,7 +530,9 @@ bool LinkedList_clear(LinkedList* list) {
     free(new_node);
   }
 
+  list->tail = NULL;
   list->size = 0;
+  list->finger = NULL;
   return true;
 }
 
@@ -18,18 +18,45 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * The value returned in place of a size or index when there is none, such as
+ * when the linked list is NULL or an element is not found.
+*/
+#define LINKED_LIST_NPOS ((size_t) -1)
 
 typedef struct List_Node {
   void* data;
   struct List_Node* next;
 } List_Node;
 
+/**
+ * A linked list. finger is the node last reached by index and finger_index is
+ * its index, or finger is NULL when there is none. A search for an index at or
+ * after the finger starts from it rather than from the head, so a loop over the
+ * indices of the list is O(n) in total rather than O(n^2).
+*/
 typedef struct LinkedList {
   List_Node* head;
   List_Node* tail;
-  int size;
+  size_t size;
+  List_Node* finger;
+  size_t finger_index;
 } LinkedList;
 
+/**
+ * A position in a linked list, used to walk it one node at a time rather than
+ * restarting from the head for every index. The cursor is at the given node,
+ * or past the end of the list when node is NULL. It is a plain value, so it
+ * needs no allocation and is simply dropped when no longer needed, but it
+ * must not be used once its node has been removed other than through it.
+*/
+typedef struct LinkedListCursor {
+  LinkedList* list;
+  List_Node* node;
+} LinkedListCursor;
+
 /**
  * Creates a new linked list using a series of nodes as the underlying collection.
  * 
@@ -49,32 +76,50 @@ LinkedList* new_LinkedList();
 bool LinkedList_add(LinkedList*, void*);
 
 /**
- * Removes a given index from the linked list.
+ * Inserts a new node at the given index of the linked list, walking from the
+ * finger when the index is past it.
+ * Note that the data is not copied, but rather the pointer to the data is
+ * stored in the node.
+ * 
+ * @param LinkedList* the pointer to the linked list.
+ * @param size_t      the index to insert at, which may be the size of the list
+ *                    to add to the end.
+ * @param void*       the data to be stored in the node.
+ * @return true if the node was inserted successfully, false otherwise.
+*/
+bool LinkedList_insert(LinkedList*, size_t, void*);
+
+/**
+ * Removes a given index from the linked list, walking from the finger when the
+ * index is past it.
  * 
  * @param LinkedList* the pointer to the linked list.
- * @param int         the index of the node to be removed.
+ * @param size_t      the index of the node to be removed.
  * @return true if the node was removed successfully, false otherwise.
 */
-bool LinkedList_remove(LinkedList*, int);
+bool LinkedList_remove(LinkedList*, size_t);
 
 /**
  * Gets the data from the node at the specified index.
  * The data is stored as a node in a series of nodes. Note that the data is not
  * copied, but rather the pointer to the data is copied.
+ * The walk starts from the finger when the index is at or past it, so getting
+ * each index in turn is O(1) per call.
  * 
  * @param LinkedList* the pointer to the linked list.
- * @param int         the index of the node to get the data from.
+ * @param size_t      the index of the node to get the data from.
  * @return the data from the node at the specified index.
 */
-void* LinkedList_get(LinkedList*, int);
+void* LinkedList_get(LinkedList*, size_t);
 
 /**
  * Gets the size of the linked list.
  * 
  * @param LinkedList* the pointer to the linked list.
- * @return the size of the linked list.
+ * @return the size of the linked list, or LINKED_LIST_NPOS if the list is
+ *         NULL.
 */
-int LinkedList_size(LinkedList*);
+size_t LinkedList_size(LinkedList*);
 
 /**
  * Checks if the linked list is empty.
@@ -104,10 +149,69 @@ bool LinkedList_contains(LinkedList*, void*);
  * 
  * @param LinkedList* the pointer to the linked list.
  * @param void*       the data to be checked.
- * @return the index of the specified data, or -1 if the data is not in the
- *         linked list.
+ * @return the index of the specified data, or LINKED_LIST_NPOS if the data is
+ *         not in the linked list.
+*/
+size_t LinkedList_indexOf(LinkedList*, void*);
+
+/**
+ * Gets a cursor at the first node of the linked list, or past the end if the
+ * list is empty or NULL.
+ * 
+ * @param LinkedList* the pointer to the linked list.
+ * @return the cursor at the head of the linked list.
+*/
+LinkedListCursor LinkedList_begin(LinkedList*);
+
+/**
+ * Checks if the cursor is past the end of its linked list.
+ * 
+ * @param LinkedListCursor* the pointer to the cursor.
+ * @return true if the cursor is past the end or NULL, false otherwise.
+*/
+bool LinkedListCursor_atEnd(LinkedListCursor*);
+
+/**
+ * Moves the cursor to the next node in O(1).
+ * 
+ * @param LinkedListCursor* the pointer to the cursor.
+ * @return true if the cursor moved, false if it was already past the end.
+*/
+bool LinkedListCursor_next(LinkedListCursor*);
+
+/**
+ * Gets the data from the node at the cursor.
+ * Note that the data is not copied, but rather the pointer to the data is
+ * returned.
+ * 
+ * @param LinkedListCursor* the pointer to the cursor.
+ * @return the data from the node at the cursor, or NULL if the cursor is past
+ *         the end.
+*/
+void* LinkedListCursor_get(LinkedListCursor*);
+
+/**
+ * Inserts a new node after the node at the cursor in O(1), leaving the cursor
+ * where it is. A cursor past the end appends the node to the end of the list
+ * instead, so a run of inserts from there keeps its order.
+ * Note that the data is not copied, but rather the pointer to the data is
+ * stored in the node.
+ * 
+ * @param LinkedListCursor* the pointer to the cursor.
+ * @param void*             the data to be stored in the node.
+ * @return true if the node was inserted successfully, false otherwise.
+*/
+bool LinkedListCursor_insertAfter(LinkedListCursor*, void*);
+
+/**
+ * Removes the node after the node at the cursor in O(1), leaving the cursor
+ * where it is.
+ * 
+ * @param LinkedListCursor* the pointer to the cursor.
+ * @return true if the node was removed successfully, false if the cursor is
+ *         at the last node or past the end.
 */
-int LinkedList_indexOf(LinkedList*, void*);
+bool LinkedListCursor_removeNext(LinkedListCursor*);
 
 /**
  * Prints the linked list as a list of pointers.
@@ -145,12 +145,12 @@ void* Queue_peek(Queue* queue) {
  * Gets the size of the queue.
  * 
  * @param Queue* the pointer to the queue.
- * @return the size of the queue, or -1 if the queue is NULL.
+ * @return the size of the queue, or QUEUE_NPOS if the queue is NULL.
 */
-int Queue_size(Queue* queue) {
-  // If the queue is NULL, return -1.
+size_t Queue_size(Queue* queue) {
+  // If the queue is NULL, return QUEUE_NPOS.
   if (queue == NULL) {
-    return -1;
+    return QUEUE_NPOS;
   }
 
   // Return the size of the queue.
@@ -19,6 +19,13 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include <string.h>
+#include <stdint.h>
+
+/**
+ * The value returned in place of a size when there is none, such as when the
+ * queue is NULL.
+*/
+#define QUEUE_NPOS ((size_t) -1)
 
 typedef struct Queue_Node {
   void *data;
@@ -28,7 +35,7 @@ typedef struct Queue_Node {
 typedef struct Queue {
   Queue_Node *head;
   Queue_Node *tail;
-  int size;
+  size_t size;
 } Queue;
 
 /**
@@ -73,9 +80,9 @@ void* Queue_peek(Queue*);
  * Gets the size of the queue.
  * 
  * @param Queue* The queue to get the size of.
- * @return The size of the queue.
+ * @return The size of the queue, or QUEUE_NPOS if the queue is NULL.
 */
-int Queue_size(Queue*);
+size_t Queue_size(Queue*);
 
 /**
  * Checks if the queue is empty.
@@ -0,0 +1,466 @@
+/**
+ * @file segmented_list.c
+ * @brief List data type implementation using segments of doubling size
+ * @author Jonathan E
+ * @date 17-10-2026
+ *
+ * This is an implementation of a list data type that stores its elements in
+ * a series of segments, each twice the size of the one before.
+ * The segment holding an index is found from the position of the highest set
+ * bit of the index, so getting an element is O(1), and growing the list only
+ * ever allocates a new segment, so existing elements are never moved.
+*/
+
+#include "segmented_list.h"
+
+/**
+ * Gets the position of the highest set bit of the given value.
+ *
+ * @param size_t The value, which must not be 0.
+ * @return The position of the highest set bit, counting from 0.
+*/
+static inline size_t SegmentedList_log2(size_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+  return sizeof(unsigned long long) * CHAR_BIT - 1 - (size_t) __builtin_clzll((unsigned long long) value);
+#else
+  size_t position = 0;
+  while (value >>= 1) {
+    position++;
+  }
+  return position;
+#endif
+}
+
+/**
+ * Gets the number of slots in the given segment.
+ *
+ * @param size_t The index of the segment.
+ * @return The number of slots in the segment.
+*/
+static inline size_t SegmentedList_segmentSize(size_t segment) {
+  return SEGMENTED_LIST_FIRST_SEGMENT_SIZE << segment;
+}
+
+/**
+ * Gets the index of the first element held by the given segment.
+ *
+ * @param size_t The index of the segment.
+ * @return The index of the first element of the segment.
+*/
+static inline size_t SegmentedList_segmentStart(size_t segment) {
+  return SegmentedList_segmentSize(segment) - SEGMENTED_LIST_FIRST_SEGMENT_SIZE;
+}
+
+/**
+ * Gets the number of bytes each slot of the given segmented list takes up.
+ *
+ * @param SegmentedList* The segmented list to get the slot size of.
+ * @return The size in bytes of each slot.
+*/
+static inline size_t SegmentedList_slotSize(SegmentedList* list) {
+  return list->elem_size > 0 ? list->elem_size : sizeof(void*);
+}
+
+/**
+ * Gets the address of the slot holding the given index.
+ * Adding the size of the first segment to the index makes the highest set bit
+ * give the segment, and the bits below it give the offset into the segment.
+ *
+ * @param SegmentedList* The segmented list to get the slot of.
+ * @param size_t         The index, whose segment must be allocated.
+ * @return The address of the slot.
+*/
+static inline void* SegmentedList_slot(SegmentedList* list, size_t index) {
+  size_t position = index + SEGMENTED_LIST_FIRST_SEGMENT_SIZE;
+  size_t bit = SegmentedList_log2(position);
+  size_t segment = bit - SEGMENTED_LIST_FIRST_SEGMENT_SHIFT;
+  size_t offset = position - ((size_t) 1 << bit);
+  return (unsigned char*) list->segments[segment] + offset * SegmentedList_slotSize(list);
+}
+
+/**
+ * Gets the element held by the given slot, which is the stored pointer, or
+ * the address of the stored value for a segmented list of values.
+ *
+ * @param SegmentedList* The segmented list the slot belongs to.
+ * @param void*          The address of the slot.
+ * @return The element held by the slot.
+*/
+static inline void* SegmentedList_element(SegmentedList* list, void* slot) {
+  return list->elem_size > 0 ? slot : *(void**) slot;
+}
+
+/**
+ * Creates a new segmented list with the given element size.
+ *
+ * @param size_t The size in bytes of each value, or 0 to store pointers.
+ * @return The new segmented list, or NULL if the memory allocation failed.
+*/
+static SegmentedList* SegmentedList_create(size_t elem_size) {
+  SegmentedList* list = malloc(sizeof(SegmentedList));
+  // If the memory allocation failed, return NULL.
+  if (list == NULL) {
+    return NULL;
+  }
+
+  // Initialise the list.
+  list->segment_count = 0;
+  list->size = 0;
+  list->elem_size = elem_size;
+  return list;
+}
+
+/**
+ * Creates a new segmented list of pointers. No segment is allocated until the
+ * first element is added.
+ *
+ * @return The new segmented list, or NULL if the memory allocation failed.
+*/
+SegmentedList* new_SegmentedList() {
+  return SegmentedList_create(0);
+}
+
+/**
+ * Creates a new segmented list that stores values of the given size directly
+ * in its segments, rather than pointers to them.
+ *
+ * @param size_t The size in bytes of each element, which must not be 0.
+ * @return The new segmented list, or NULL if the segmented list could not be
+ *         created.
+*/
+SegmentedList* new_SegmentedListOf(size_t elem_size) {
+  // If the element size is 0, there is nothing to store, so return NULL.
+  if (elem_size == 0) {
+    return NULL;
+  }
+
+  return SegmentedList_create(elem_size);
+}
+
+/**
+ * Adds an element to the end of the segmented list in O(1) time. When the
+ * last segment is full, a new segment twice its size is allocated, and no
+ * existing element is moved.
+ * Note that the data is not copied, but rather the pointer to the data is
+ * stored. For a segmented list of values, the value the pointer points to is
+ * copied into the list instead.
+ *
+ * @param SegmentedList* The segmented list to add the element to.
+ * @param void*          The pointer to the element to add.
+ * @return true if the element was added successfully, false otherwise.
+*/
+bool SegmentedList_add(SegmentedList* list, void* data) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  // If the list stores values, and there is no value to copy, return false.
+  if (list->elem_size > 0 && data == NULL) {
+    return false;
+  }
+
+  // If the allocated segments are full, allocate the next one.
+  size_t capacity = SegmentedList_segmentStart(list->segment_count);
+  if (list->size == capacity) {
+    // If the index is full, or the segment could not be addressed, return false.
+    size_t segment_size = SegmentedList_segmentSize(list->segment_count);
+    if (list->segment_count == SEGMENTED_LIST_MAX_SEGMENTS || segment_size > SIZE_MAX / SegmentedList_slotSize(list)) {
+      return false;
+    }
+
+    void* new_segment = malloc(segment_size * SegmentedList_slotSize(list));
+    // If the memory allocation failed, return false.
+    if (new_segment == NULL) {
+      return false;
+    }
+
+    list->segments[list->segment_count] = new_segment;
+    list->segment_count++;
+  }
+
+  // Store the element in the next slot.
+  void* slot = SegmentedList_slot(list, list->size);
+  if (list->elem_size > 0) {
+    memcpy(slot, data, list->elem_size);
+  } else {
+    *(void**) slot = data;
+  }
+  list->size++;
+  return true;
+}
+
+/**
+ * Gets the element at the given index of the segmented list in O(1) time.
+ * For a segmented list of values, the address of the value is returned, which
+ * stays valid until the element is removed.
+ *
+ * @param SegmentedList* The segmented list to get the element from.
+ * @param size_t         The index of the element to get.
+ * @return The element at the given index, or NULL if the index is out of
+ *         bounds.
+*/
+void* SegmentedList_get(SegmentedList* list, size_t index) {
+  // If the list is NULL, return NULL.
+  if (list == NULL) {
+    return NULL;
+  }
+
+  // If the index is out of bounds, return NULL.
+  if (index >= list->size) {
+    return NULL;
+  }
+
+  return SegmentedList_element(list, SegmentedList_slot(list, index));
+}
+
+/**
+ * Replaces the element at the given index of the segmented list.
+ * For a segmented list of values, the value the pointer points to is copied
+ * over the element.
+ *
+ * @param SegmentedList* The segmented list to update.
+ * @param size_t         The index of the element to replace.
+ * @param void*          The pointer to the new element.
+ * @return true if the element was replaced, false otherwise.
+*/
+bool SegmentedList_set(SegmentedList* list, size_t index, void* data) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  // If the index is out of bounds, return false.
+  if (index >= list->size) {
+    return false;
+  }
+
+  void* slot = SegmentedList_slot(list, index);
+  if (list->elem_size > 0) {
+    // If there is no value to copy, return false.
+    if (data == NULL) {
+      return false;
+    }
+    memcpy(slot, data, list->elem_size);
+  } else {
+    *(void**) slot = data;
+  }
+  return true;
+}
+
+/**
+ * Removes the last element of the segmented list in O(1) time. A segment is
+ * only freed once the segment before it is empty as well, so a list that
+ * shrinks and grows around a segment boundary does not allocate every time.
+ *
+ * @param SegmentedList* The segmented list to remove the element from.
+ * @return true if the element was removed, false if the list is empty or NULL.
+*/
+bool SegmentedList_removeLast(SegmentedList* list) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  // If the list is empty, return false.
+  if (list->size == 0) {
+    return false;
+  }
+
+  list->size--;
+
+  // If the last two segments are both empty, free the last one.
+  if (list->segment_count >= 2 && list->size <= SegmentedList_segmentStart(list->segment_count - 2)) {
+    list->segment_count--;
+    free(list->segments[list->segment_count]);
+  }
+  return true;
+}
+
+/**
+ * Gets the size of the segmented list.
+ *
+ * @param SegmentedList* The segmented list to get the size of.
+ * @return The size of the segmented list, or SEGMENTED_LIST_NPOS if the list
+ *         is NULL.
+*/
+size_t SegmentedList_size(SegmentedList* list) {
+  // If the list is NULL, return SEGMENTED_LIST_NPOS.
+  if (list == NULL) {
+    return SEGMENTED_LIST_NPOS;
+  }
+
+  return list->size;
+}
+
+/**
+ * Gets the number of elements the segmented list can hold before it has to
+ * allocate another segment.
+ *
+ * @param SegmentedList* The segmented list to get the capacity of.
+ * @return The capacity of the segmented list, or SEGMENTED_LIST_NPOS if the
+ *         list is NULL.
+*/
+size_t SegmentedList_capacity(SegmentedList* list) {
+  // If the list is NULL, return SEGMENTED_LIST_NPOS.
+  if (list == NULL) {
+    return SEGMENTED_LIST_NPOS;
+  }
+
+  return SegmentedList_segmentStart(list->segment_count);
+}
+
+/**
+ * Checks if the segmented list is empty.
+ *
+ * @param SegmentedList* The segmented list to check.
+ * @return true if the segmented list is empty, false otherwise.
+*/
+bool SegmentedList_isEmpty(SegmentedList* list) {
+  // If the list is NULL, return true.
+  if (list == NULL) {
+    return true;
+  }
+
+  return list->size == 0;
+}
+
+/**
+ * Checks if the segmented list contains the given element.
+ * The pointers to the data are compared, not the data itself, except in a
+ * segmented list of values where the values are compared byte for byte.
+ *
+ * @param SegmentedList* The segmented list to check.
+ * @param void*          The data to check for.
+ * @return true if the segmented list contains the element, false otherwise.
+*/
+bool SegmentedList_contains(SegmentedList* list, void* data) {
+  return SegmentedList_indexOf(list, data) != SEGMENTED_LIST_NPOS;
+}
+
+/**
+ * Gets the index of the first occurrence of the given element.
+ * The pointers to the data are compared, not the data itself, except in a
+ * segmented list of values where the values are compared byte for byte.
+ * The search runs over each segment in turn, so it reads memory in order.
+ *
+ * @param SegmentedList* The segmented list to search.
+ * @param void*          The data to search for.
+ * @return The index of the element, or SEGMENTED_LIST_NPOS if it is not found.
+*/
+size_t SegmentedList_indexOf(SegmentedList* list, void* data) {
+  // If the list is NULL, return SEGMENTED_LIST_NPOS.
+  if (list == NULL) {
+    return SEGMENTED_LIST_NPOS;
+  }
+
+  // If the list stores values, and there is no value to compare, return
+  // SEGMENTED_LIST_NPOS.
+  if (list->elem_size > 0 && data == NULL) {
+    return SEGMENTED_LIST_NPOS;
+  }
+
+  size_t start = 0;
+  for (size_t segment = 0; segment < list->segment_count && start < list->size; segment++) {
+    size_t count = SegmentedList_segmentSize(segment);
+    if (count > list->size - start) {
+      count = list->size - start;
+    }
+
+    if (list->elem_size > 0) {
+      unsigned char* values = list->segments[segment];
+      for (size_t i = 0; i < count; i++) {
+        if (memcmp(values + i * list->elem_size, data, list->elem_size) == 0) {
+          return start + i;
+        }
+      }
+    } else {
+      void** pointers = list->segments[segment];
+      for (size_t i = 0; i < count; i++) {
+        if (pointers[i] == data) {
+          return start + i;
+        }
+      }
+    }
+
+    start += count;
+  }
+
+  return SEGMENTED_LIST_NPOS;
+}
+
+/**
+ * Prints the segmented list as a list of pointers.
+ *
+ * @param SegmentedList* The segmented list to print.
+*/
+void SegmentedList_print(SegmentedList* list) {
+  // If the list is NULL, print NULL.
+  if (list == NULL) {
+    printf("NULL\n");
+    return;
+  }
+
+  printf("[ ");
+  for (size_t i = 0; i < list->size; i++) {
+    printf("%p ", SegmentedList_element(list, SegmentedList_slot(list, i)));
+  }
+  printf("]\n");
+}
+
+/**
+ * Prints the segmented list as a list of integers.
+ *
+ * @param SegmentedList* The segmented list to print.
+*/
+void SegmentedList_printInt(SegmentedList* list) {
+  // If the list is NULL, print NULL.
+  if (list == NULL) {
+    printf("NULL\n");
+    return;
+  }
+
+  printf("[ ");
+  for (size_t i = 0; i < list->size; i++) {
+    printf("%d ", *(int*) SegmentedList_element(list, SegmentedList_slot(list, i)));
+  }
+  printf("]\n");
+}
+
+/**
+ * Clears the segmented list, freeing all of its segments.
+ *
+ * @param SegmentedList* The segmented list to clear.
+ * @return true if the segmented list was cleared, false otherwise.
+*/
+bool SegmentedList_clear(SegmentedList* list) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  // Free the segments.
+  for (size_t segment = 0; segment < list->segment_count; segment++) {
+    free(list->segments[segment]);
+  }
+
+  list->segment_count = 0;
+  list->size = 0;
+  return true;
+}
+
+/**
+ * Frees the segmented list.
+ *
+ * @param SegmentedList* The segmented list to free.
+*/
+void SegmentedList_free(SegmentedList* list) {
+  // If the list is NULL, return.
+  if (list == NULL) {
+    return;
+  }
+
+  // Free the segments and the list.
+  SegmentedList_clear(list);
+  free(list);
+}
@@ -0,0 +1,207 @@
+/**
+ * @file segmented_list.h
+ * @brief List data type implementation using segments of doubling size
+ * @author Jonathan E
+ * @date 17-10-2026
+ *
+ * This is a list data type that can be used to store data in a series of
+ * segments rather than a single dynamic array.
+ * Each segment is twice the size of the one before, and the segments are kept
+ * in a fixed index inside the list. Growing the list allocates a new segment
+ * rather than reallocating the existing ones, so appending is O(1) in the
+ * worst case, no element is ever copied to grow the list, and the address of
+ * an element stays the same for as long as it is in the list.
+ * The data stored in the list are void pointers which are dynamically allocated
+ * to the heap, or values of a fixed size for a list created with
+ * new_SegmentedListOf().
+*/
+
+#ifndef SEGMENTED_LIST_H
+#define SEGMENTED_LIST_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+#include <stdint.h>
+
+/**
+ * The first segment holds 2 to the power of this number of elements.
+*/
+#define SEGMENTED_LIST_FIRST_SEGMENT_SHIFT 3
+
+/**
+ * The number of elements held by the first segment.
+*/
+#define SEGMENTED_LIST_FIRST_SEGMENT_SIZE ((size_t) 1 << SEGMENTED_LIST_FIRST_SEGMENT_SHIFT)
+
+/**
+ * The number of segments in the index, which is enough to address every
+ * element a size_t can count.
+*/
+#define SEGMENTED_LIST_MAX_SEGMENTS (sizeof(size_t) * CHAR_BIT - SEGMENTED_LIST_FIRST_SEGMENT_SHIFT)
+
+/**
+ * The value returned in place of an index or size when there is none, such as
+ * when an element is not found or the segmented list is NULL.
+*/
+#define SEGMENTED_LIST_NPOS ((size_t) -1)
+
+/**
+ * Segment k holds SEGMENTED_LIST_FIRST_SEGMENT_SIZE << k slots, and only the
+ * first segment_count segments are allocated. The slots hold pointers when
+ * elem_size is 0, and values of elem_size bytes otherwise.
+*/
+typedef struct SegmentedList {
+  void* segments[SEGMENTED_LIST_MAX_SEGMENTS];
+  size_t segment_count;
+  size_t size;
+  size_t elem_size;
+} SegmentedList;
+
+/**
+ * Creates a new segmented list of pointers. No segment is allocated until the
+ * first element is added.
+ *
+ * @return The new segmented list, or NULL if the memory allocation failed.
+*/
+SegmentedList* new_SegmentedList();
+
+/**
+ * Creates a new segmented list that stores values of the given size directly
+ * in its segments, rather than pointers to them.
+ *
+ * @param size_t The size in bytes of each element, which must not be 0.
+ * @return The new segmented list, or NULL if the segmented list could not be
+ *         created.
+*/
+SegmentedList* new_SegmentedListOf(size_t);
+
+/**
+ * Adds an element to the end of the segmented list in O(1) time. When the
+ * last segment is full, a new segment twice its size is allocated, and no
+ * existing element is moved.
+ * Note that the data is not copied, but rather the pointer to the data is
+ * stored. For a segmented list of values, the value the pointer points to is
+ * copied into the list instead.
+ *
+ * @param SegmentedList* The segmented list to add the element to.
+ * @param void*          The pointer to the element to add.
+ * @return true if the element was added successfully, false otherwise.
+*/
+bool SegmentedList_add(SegmentedList*, void*);
+
+/**
+ * Gets the element at the given index of the segmented list in O(1) time.
+ * For a segmented list of values, the address of the value is returned, which
+ * stays valid until the element is removed.
+ *
+ * @param SegmentedList* The segmented list to get the element from.
+ * @param size_t         The index of the element to get.
+ * @return The element at the given index, or NULL if the index is out of
+ *         bounds.
+*/
+void* SegmentedList_get(SegmentedList*, size_t);
+
+/**
+ * Replaces the element at the given index of the segmented list.
+ * For a segmented list of values, the value the pointer points to is copied
+ * over the element.
+ *
+ * @param SegmentedList* The segmented list to update.
+ * @param size_t         The index of the element to replace.
+ * @param void*          The pointer to the new element.
+ * @return true if the element was replaced, false otherwise.
+*/
+bool SegmentedList_set(SegmentedList*, size_t, void*);
+
+/**
+ * Removes the last element of the segmented list in O(1) time. A segment is
+ * only freed once the segment before it is empty as well, so a list that
+ * shrinks and grows around a segment boundary does not allocate every time.
+ *
+ * @param SegmentedList* The segmented list to remove the element from.
+ * @return true if the element was removed, false if the list is empty or NULL.
+*/
+bool SegmentedList_removeLast(SegmentedList*);
+
+/**
+ * Gets the size of the segmented list.
+ *
+ * @param SegmentedList* The segmented list to get the size of.
+ * @return The size of the segmented list, or SEGMENTED_LIST_NPOS if the list
+ *         is NULL.
+*/
+size_t SegmentedList_size(SegmentedList*);
+
+/**
+ * Gets the number of elements the segmented list can hold before it has to
+ * allocate another segment.
+ *
+ * @param SegmentedList* The segmented list to get the capacity of.
+ * @return The capacity of the segmented list, or SEGMENTED_LIST_NPOS if the
+ *         list is NULL.
+*/
+size_t SegmentedList_capacity(SegmentedList*);
+
+/**
+ * Checks if the segmented list is empty.
+ *
+ * @param SegmentedList* The segmented list to check.
+ * @return true if the segmented list is empty, false otherwise.
+*/
+bool SegmentedList_isEmpty(SegmentedList*);
+
+/**
+ * Checks if the segmented list contains the given element.
+ * The pointers to the data are compared, not the data itself, except in a
+ * segmented list of values where the values are compared byte for byte.
+ *
+ * @param SegmentedList* The segmented list to check.
+ * @param void*          The data to check for.
+ * @return true if the segmented list contains the element, false otherwise.
+*/
+bool SegmentedList_contains(SegmentedList*, void*);
+
+/**
+ * Gets the index of the first occurrence of the given element.
+ * The pointers to the data are compared, not the data itself, except in a
+ * segmented list of values where the values are compared byte for byte.
+ *
+ * @param SegmentedList* The segmented list to search.
+ * @param void*          The data to search for.
+ * @return The index of the element, or SEGMENTED_LIST_NPOS if it is not found.
+*/
+size_t SegmentedList_indexOf(SegmentedList*, void*);
+
+/**
+ * Prints the segmented list as a list of pointers.
+ *
+ * @param SegmentedList* The segmented list to print.
+*/
+void SegmentedList_print(SegmentedList*);
+
+/**
+ * Prints the segmented list as a list of integers.
+ *
+ * @param SegmentedList* The segmented list to print.
+*/
+void SegmentedList_printInt(SegmentedList*);
+
+/**
+ * Clears the segmented list, freeing all of its segments.
+ *
+ * @param SegmentedList* The segmented list to clear.
+ * @return true if the segmented list was cleared, false otherwise.
+*/
+bool SegmentedList_clear(SegmentedList*);
+
+/**
+ * Frees the segmented list.
+ *
+ * @param SegmentedList* The segmented list to free.
+*/
+void SegmentedList_free(SegmentedList*);
+
+#endif /* SEGMENTED_LIST_H */
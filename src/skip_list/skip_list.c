@@ -0,0 +1,433 @@
+/**
+ * @file skip_list.c
+ * @brief Indexable skip list data type implementation
+ * @author Jonathan E
+ * @date 17-10-2026
+ *
+ * This is an implementation of an indexable skip list data type that can be
+ * used to store generic data in sequence.
+ * Every link records the number of positions it moves forward, so a search for
+ * an index can take the highest link that does not overshoot it on each level,
+ * and inserting or removing a node only changes the spans of the links that
+ * pass over it.
+ * The data stored in the nodes is a void pointer which is dynamically allocated
+ * to the heap.
+*/
+
+#include "skip_list.h"
+
+/**
+ * Creates a new node holding the given data, with room for links on the given
+ * number of levels.
+ *
+ * @param void*  the data to be stored in the node.
+ * @param size_t the number of levels the node is linked into.
+ * @return the new node, or NULL if the memory allocation failed.
+*/
+static SkipList_Node* SkipList_newNode(void* data, size_t level) {
+  SkipList_Node* new_node = malloc(sizeof(SkipList_Node) + level * sizeof(SkipList_Link));
+  // If the memory allocation failed, return NULL.
+  if (new_node == NULL) {
+    return NULL;
+  }
+
+  new_node->data = data;
+  new_node->level = level;
+  return new_node;
+}
+
+/**
+ * Picks the number of levels for a new node, where each level above the first
+ * is reached with a probability of a quarter.
+ *
+ * @param SkipList* the pointer to the skip list.
+ * @return the number of levels, from 1 to SKIP_LIST_MAX_LEVEL.
+*/
+static size_t SkipList_randomLevel(SkipList* list) {
+  // Step the xorshift generator once, and use two bits per level.
+  list->random ^= list->random << 13;
+  list->random ^= list->random >> 7;
+  list->random ^= list->random << 17;
+
+  uint64_t bits = list->random;
+  size_t level = 1;
+  while (level < SKIP_LIST_MAX_LEVEL && (bits & 3) == 0 && bits != 0) {
+    level++;
+    bits >>= 2;
+  }
+  return level;
+}
+
+/**
+ * Finds, on every level in use, the last node before the given index, and the
+ * position of that node.
+ *
+ * @param SkipList*       the pointer to the skip list.
+ * @param size_t          the index, which may be the size of the list.
+ * @param SkipList_Node** where to store the node found on each level.
+ * @param size_t*         where to store the position of each node found, where
+ *                        the head is at 0 and the first element at 1.
+*/
+static void SkipList_findBefore(SkipList* list, size_t index, SkipList_Node** update, size_t* ranks) {
+  SkipList_Node* node = list->head;
+  size_t rank = 0;
+  // There is always at least one level, so the bottom one is always reached.
+  size_t i = list->level;
+  do {
+    i--;
+    // Follow the links on this level as far as they stay before the index.
+    while (node->links[i].next != NULL && rank + node->links[i].span <= index) {
+      rank += node->links[i].span;
+      node = node->links[i].next;
+    }
+    update[i] = node;
+    ranks[i] = rank;
+  } while (i > 0);
+}
+
+/**
+ * Creates a new, empty skip list.
+ * This function uses malloc to allocate memory for the skip list.
+ *
+ * @return A pointer to the new skip list, or NULL if the memory allocation
+ *         failed.
+*/
+SkipList* new_SkipList() {
+  SkipList* list = malloc(sizeof(SkipList));
+  // If the memory allocation failed, return NULL.
+  if (list == NULL) {
+    return NULL;
+  }
+
+  list->head = SkipList_newNode(NULL, SKIP_LIST_MAX_LEVEL);
+  // If the memory allocation failed, free the list and return NULL.
+  if (list->head == NULL) {
+    free(list);
+    return NULL;
+  }
+
+  // Initialise the list with a single level spanning to the end.
+  list->head->links[0].next = NULL;
+  list->head->links[0].span = 1;
+  list->level = 1;
+  list->size = 0;
+  list->random = 0x9E3779B97F4A7C15;
+  return list;
+}
+
+/**
+ * Adds a new element to the end of the skip list in O(log n) on average.
+ * Note that the data is not copied, but rather the pointer to the data is
+ * stored in the node.
+ *
+ * @param SkipList* the pointer to the skip list.
+ * @param void*     the data to be stored in the list.
+ * @return true if the element was added successfully, false otherwise.
+*/
+bool SkipList_add(SkipList* list, void* data) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  return SkipList_insert(list, list->size, data);
+}
+
+/**
+ * Inserts a new element at the given index of the skip list in O(log n) on
+ * average, moving the elements after it up by one index.
+ * Note that the data is not copied, but rather the pointer to the data is
+ * stored in the node.
+ *
+ * @param SkipList* the pointer to the skip list.
+ * @param size_t    the index to insert at, which may be the size of the list to
+ *                  add to the end.
+ * @param void*     the data to be stored in the list.
+ * @return true if the element was inserted successfully, false otherwise.
+*/
+bool SkipList_insert(SkipList* list, size_t index, void* data) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  // If the index is out of bounds, return false.
+  if (index > list->size) {
+    return false;
+  }
+
+  size_t level = SkipList_randomLevel(list);
+  SkipList_Node* new_node = SkipList_newNode(data, level);
+  // If the memory allocation failed, return false.
+  if (new_node == NULL) {
+    return false;
+  }
+
+  SkipList_Node* update[SKIP_LIST_MAX_LEVEL];
+  size_t ranks[SKIP_LIST_MAX_LEVEL];
+  SkipList_findBefore(list, index, update, ranks);
+
+  // Bring any new levels into use, each a single link from the head to the end.
+  for (size_t i = list->level; i < level; i++) {
+    list->head->links[i].next = NULL;
+    list->head->links[i].span = list->size + 1;
+    update[i] = list->head;
+    ranks[i] = 0;
+  }
+  if (level > list->level) {
+    list->level = level;
+  }
+
+  // Split the links passing over the index on the node's levels, and stretch
+  // the ones above it by one.
+  for (size_t i = 0; i < list->level; i++) {
+    if (i < level) {
+      size_t before = ranks[0] - ranks[i] + 1;
+      new_node->links[i].next = update[i]->links[i].next;
+      new_node->links[i].span = update[i]->links[i].span - before + 1;
+      update[i]->links[i].next = new_node;
+      update[i]->links[i].span = before;
+    } else {
+      update[i]->links[i].span++;
+    }
+  }
+
+  list->size++;
+  return true;
+}
+
+/**
+ * Removes a given index from the skip list in O(log n) on average, moving the
+ * elements after it down by one index.
+ *
+ * @param SkipList* the pointer to the skip list.
+ * @param size_t    the index of the element to be removed.
+ * @return true if the element was removed successfully, false otherwise.
+*/
+bool SkipList_remove(SkipList* list, size_t index) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  // If the index is out of bounds, return false.
+  if (index >= list->size) {
+    return false;
+  }
+
+  SkipList_Node* update[SKIP_LIST_MAX_LEVEL];
+  size_t ranks[SKIP_LIST_MAX_LEVEL];
+  SkipList_findBefore(list, index, update, ranks);
+  SkipList_Node* node = update[0]->links[0].next;
+
+  // Join the links around the node on its levels, and shorten the ones above
+  // it by one.
+  for (size_t i = 0; i < list->level; i++) {
+    if (update[i]->links[i].next == node) {
+      update[i]->links[i].span += node->links[i].span - 1;
+      update[i]->links[i].next = node->links[i].next;
+    } else {
+      update[i]->links[i].span--;
+    }
+  }
+  free(node);
+
+  // Drop any levels left empty, keeping at least one.
+  while (list->level > 1 && list->head->links[list->level - 1].next == NULL) {
+    list->level--;
+  }
+
+  list->size--;
+  return true;
+}
+
+/**
+ * Gets the data at the specified index in O(log n) on average.
+ * Note that the data is not copied, but rather the pointer to the data is
+ * returned.
+ *
+ * @param SkipList* the pointer to the skip list.
+ * @param size_t    the index of the element to get the data from.
+ * @return the data at the specified index, or NULL if the index is out of
+ *         bounds.
+*/
+void* SkipList_get(SkipList* list, size_t index) {
+  // If the list is NULL, return NULL.
+  if (list == NULL) {
+    return NULL;
+  }
+
+  // If the index is out of bounds, return NULL.
+  if (index >= list->size) {
+    return NULL;
+  }
+
+  // Walk down the levels until a link lands exactly on the index, which is at
+  // position index + 1 counting the head as 0.
+  SkipList_Node* node = list->head;
+  size_t rank = 0;
+  for (size_t i = list->level; i-- > 0;) {
+    while (node->links[i].next != NULL && rank + node->links[i].span <= index + 1) {
+      rank += node->links[i].span;
+      node = node->links[i].next;
+    }
+    if (rank == index + 1) {
+      break;
+    }
+  }
+
+  return node->data;
+}
+
+/**
+ * Gets the size of the skip list.
+ *
+ * @param SkipList* the pointer to the skip list.
+ * @return the size of the skip list, or SKIP_LIST_NPOS if the list is NULL.
+*/
+size_t SkipList_size(SkipList* list) {
+  // If the list is NULL, return SKIP_LIST_NPOS.
+  if (list == NULL) {
+    return SKIP_LIST_NPOS;
+  }
+
+  return list->size;
+}
+
+/**
+ * Checks if the skip list is empty.
+ *
+ * @param SkipList* the pointer to the skip list.
+ * @return true if the skip list is empty, false otherwise.
+*/
+bool SkipList_isEmpty(SkipList* list) {
+  // If the list is NULL, return true.
+  if (list == NULL) {
+    return true;
+  }
+
+  return list->size == 0;
+}
+
+/**
+ * Checks if the skip list contains the specified data.
+ * The pointer to the data is checked, not the data itself.
+ *
+ * @param SkipList* the pointer to the skip list.
+ * @param void*     the data to check for.
+ * @return true if the skip list contains the specified data, false otherwise.
+*/
+bool SkipList_contains(SkipList* list, void* data) {
+  return SkipList_indexOf(list, data) != SKIP_LIST_NPOS;
+}
+
+/**
+ * Gets the index of the specified data in the skip list. As the list is not
+ * sorted, this walks it from the head.
+ * The pointer to the data is checked, not the data itself.
+ *
+ * @param SkipList* the pointer to the skip list.
+ * @param void*     the data to check for.
+ * @return the index of the specified data, or SKIP_LIST_NPOS if the data is
+ *         not found.
+*/
+size_t SkipList_indexOf(SkipList* list, void* data) {
+  // If the list is NULL, return SKIP_LIST_NPOS.
+  if (list == NULL) {
+    return SKIP_LIST_NPOS;
+  }
+
+  // Walk the bottom level, which visits every node.
+  size_t index = 0;
+  for (SkipList_Node* node = list->head->links[0].next; node != NULL; node = node->links[0].next) {
+    if (node->data == data) {
+      return index;
+    }
+    index++;
+  }
+
+  return SKIP_LIST_NPOS;
+}
+
+/**
+ * Prints the skip list as a list of pointers.
+ *
+ * @param SkipList* the pointer to the skip list.
+*/
+void SkipList_print(SkipList* list) {
+  // If the list is NULL, return.
+  if (list == NULL) {
+    printf("NULL\n");
+    return;
+  }
+
+  // Print the list.
+  printf("[");
+  for (SkipList_Node* node = list->head->links[0].next; node != NULL; node = node->links[0].next) {
+    printf("%p ", node->data);
+  }
+  printf("]\n");
+}
+
+/**
+ * Prints the skip list as a list of integers.
+ *
+ * @param SkipList* the pointer to the skip list.
+*/
+void SkipList_printInt(SkipList* list) {
+  // If the list is NULL, return.
+  if (list == NULL) {
+    printf("NULL\n");
+    return;
+  }
+
+  // Print the list.
+  printf("[");
+  for (SkipList_Node* node = list->head->links[0].next; node != NULL; node = node->links[0].next) {
+    printf("%d ", *(int*)node->data);
+  }
+  printf("]\n");
+}
+
+/**
+ * Clears the skip list.
+ *
+ * @param SkipList* the pointer to the skip list.
+ * @return true if the nodes were removed successfully, false otherwise.
+*/
+bool SkipList_clear(SkipList* list) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  // Remove all nodes, following the bottom level.
+  SkipList_Node* node = list->head->links[0].next;
+  while (node != NULL) {
+    SkipList_Node* next = node->links[0].next;
+    free(node);
+    node = next;
+  }
+
+  list->head->links[0].next = NULL;
+  list->head->links[0].span = 1;
+  list->level = 1;
+  list->size = 0;
+  return true;
+}
+
+/**
+ * Frees the memory allocated for the skip list.
+ *
+ * @param SkipList* the pointer to the skip list.
+*/
+void SkipList_free(SkipList* list) {
+  // If the list is NULL, return.
+  if (list == NULL) {
+    return;
+  }
+
+  SkipList_clear(list);
+  free(list->head);
+  free(list);
+}
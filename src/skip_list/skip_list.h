@@ -0,0 +1,192 @@
+/**
+ * @file skip_list.h
+ * @brief Indexable skip list data type implementation using a node structure
+ * @author Jonathan E
+ * @date 17-10-2026
+ *
+ * This is a list data type that can be used to store data in an indexable skip
+ * list structure.
+ * The elements are kept in the order they were inserted, as in a linked list,
+ * but each node is also linked into a random number of higher levels, which
+ * skip over more and more of the list. Each link records how many positions it
+ * skips, so getting, inserting or removing an element at an index is O(log n)
+ * on average rather than a walk from the head.
+ * The data stored in the nodes is a void pointer which is dynamically allocated
+ * to the heap.
+*/
+
+#ifndef SKIP_LIST_H
+#define SKIP_LIST_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * The value returned in place of a size or index when there is none, such as
+ * when the skip list is NULL or an element is not found.
+*/
+#define SKIP_LIST_NPOS ((size_t) -1)
+
+/**
+ * The largest number of levels a node can be linked into. Each level holds a
+ * quarter of the nodes of the one below, so 32 levels is enough for any list
+ * that fits in memory.
+*/
+#define SKIP_LIST_MAX_LEVEL 32
+
+/**
+ * A link from a node to the next node on one level, and the number of
+ * positions it moves forward in the list. A link with no next node spans to
+ * one past the end of the list.
+*/
+typedef struct SkipList_Link {
+  struct SkipList_Node* next;
+  size_t span;
+} SkipList_Link;
+
+/**
+ * A node of a skip list, linked into the given number of levels. The links on
+ * level 0 visit every node in order.
+*/
+typedef struct SkipList_Node {
+  void* data;
+  size_t level;
+  SkipList_Link links[];
+} SkipList_Node;
+
+/**
+ * A skip list. head is a node holding no data that is linked into every level,
+ * level is the number of levels currently in use, and random is the state of
+ * the generator that picks the level of each new node.
+*/
+typedef struct SkipList {
+  SkipList_Node* head;
+  size_t level;
+  size_t size;
+  uint64_t random;
+} SkipList;
+
+/**
+ * Creates a new, empty skip list.
+ *
+ * @return A pointer to the new skip list.
+*/
+SkipList* new_SkipList();
+
+/**
+ * Adds a new element to the end of the skip list in O(log n) on average.
+ * Note that the data is not copied, but rather the pointer to the data is
+ * stored in the node.
+ *
+ * @param SkipList* the pointer to the skip list.
+ * @param void*     the data to be stored in the list.
+ * @return true if the element was added successfully, false otherwise.
+*/
+bool SkipList_add(SkipList*, void*);
+
+/**
+ * Inserts a new element at the given index of the skip list in O(log n) on
+ * average, moving the elements after it up by one index.
+ * Note that the data is not copied, but rather the pointer to the data is
+ * stored in the node.
+ *
+ * @param SkipList* the pointer to the skip list.
+ * @param size_t    the index to insert at, which may be the size of the list to
+ *                  add to the end.
+ * @param void*     the data to be stored in the list.
+ * @return true if the element was inserted successfully, false otherwise.
+*/
+bool SkipList_insert(SkipList*, size_t, void*);
+
+/**
+ * Removes a given index from the skip list in O(log n) on average, moving the
+ * elements after it down by one index.
+ *
+ * @param SkipList* the pointer to the skip list.
+ * @param size_t    the index of the element to be removed.
+ * @return true if the element was removed successfully, false otherwise.
+*/
+bool SkipList_remove(SkipList*, size_t);
+
+/**
+ * Gets the data at the specified index in O(log n) on average.
+ * Note that the data is not copied, but rather the pointer to the data is
+ * returned.
+ *
+ * @param SkipList* the pointer to the skip list.
+ * @param size_t    the index of the element to get the data from.
+ * @return the data at the specified index, or NULL if the index is out of
+ *         bounds.
+*/
+void* SkipList_get(SkipList*, size_t);
+
+/**
+ * Gets the size of the skip list.
+ *
+ * @param SkipList* the pointer to the skip list.
+ * @return the size of the skip list, or SKIP_LIST_NPOS if the list is NULL.
+*/
+size_t SkipList_size(SkipList*);
+
+/**
+ * Checks if the skip list is empty.
+ *
+ * @param SkipList* the pointer to the skip list.
+ * @return true if the skip list is empty, false otherwise.
+*/
+bool SkipList_isEmpty(SkipList*);
+
+/**
+ * Checks if the skip list contains the specified data.
+ * The pointer to the data is checked, not the data itself.
+ *
+ * @param SkipList* the pointer to the skip list.
+ * @param void*     the data to be checked.
+ * @return true if the skip list contains the specified data, false otherwise.
+*/
+bool SkipList_contains(SkipList*, void*);
+
+/**
+ * Gets the index of the specified data in the skip list. As the list is not
+ * sorted, this walks it from the head.
+ * The pointer to the data is checked, not the data itself.
+ *
+ * @param SkipList* the pointer to the skip list.
+ * @param void*     the data to be checked.
+ * @return the index of the specified data, or SKIP_LIST_NPOS if the data is
+ *         not in the skip list.
+*/
+size_t SkipList_indexOf(SkipList*, void*);
+
+/**
+ * Prints the skip list as a list of pointers.
+ *
+ * @param SkipList* the pointer to the skip list.
+*/
+void SkipList_print(SkipList*);
+
+/**
+ * Prints the skip list as a list of integers.
+ *
+ * @param SkipList* the pointer to the skip list.
+*/
+void SkipList_printInt(SkipList*);
+
+/**
+ * Clears the given skip list.
+ *
+ * @param SkipList* the pointer to the skip list.
+ * @return true if the skip list was cleared successfully, false otherwise.
+*/
+bool SkipList_clear(SkipList*);
+
+/**
+ * Frees the memory allocated to the skip list.
+ *
+ * @param SkipList* the pointer to the skip list.
+*/
+void SkipList_free(SkipList*);
+
+#endif /* SKIP_LIST_H */
@@ -131,12 +131,12 @@ void* Stack_peek(Stack* stack) {
  * Gets the size of the stack.
  * 
  * @param Stack* The stack to get the size of.
- * @return The size of the stack, or -1 if the stack is NULL.
+ * @return The size of the stack, or STACK_NPOS if the stack is NULL.
 */
-int Stack_size(Stack* stack) {
-  // If the stack is NULL, return 0.
+size_t Stack_size(Stack* stack) {
+  // If the stack is NULL, return STACK_NPOS.
   if (stack == NULL) {
-    return -1;
+    return STACK_NPOS;
   }
 
   return stack->size;
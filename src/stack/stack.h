@@ -19,6 +19,13 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include <string.h>
+#include <stdint.h>
+
+/**
+ * The value returned in place of a size when there is none, such as when the
+ * stack is NULL.
+*/
+#define STACK_NPOS ((size_t) -1)
 
 typedef struct Stack_Node {
   void *data;
@@ -27,7 +34,7 @@ typedef struct Stack_Node {
 
 typedef struct Stack {
   Stack_Node *top;
-  int size;
+  size_t size;
 } Stack;
 
 /**
@@ -72,9 +79,9 @@ void* Stack_peek(Stack*);
  * Gets the size of the stack.
  * 
  * @param Stack* The stack to get the size of.
- * @return The size of the stack.
+ * @return The size of the stack, or STACK_NPOS if the stack is NULL.
 */
-int Stack_size(Stack*);
+size_t Stack_size(Stack*);
 
 /**
  * Checks if the stack is empty.
@@ -0,0 +1,69 @@
+/**
+ * @file typed.h
+ * @brief Shared definitions for the type specialised data types
+ * @author Jonathan E
+ * @date 17-10-2026
+ *
+ * The headers in this directory provide macros that generate a data type for
+ * a single element type, such as CADTS_DEFINE_ARRAY_LIST(int32_t, i32). The
+ * elements are stored by value rather than behind a void pointer, and every
+ * generated function is static inline, so the compiler knows the element type
+ * and can inline and vectorise the operations on it.
+ * This header holds the definitions the generated data types share.
+*/
+
+#ifndef TYPED_H
+#define TYPED_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdint.h>
+
+/**
+ * The value returned in place of an index or size when there is none, such as
+ * when an element is not found or the data type is NULL.
+*/
+#define CADTS_NPOS ((size_t) -1)
+
+/**
+ * The number of elements a new array backed data type can hold before it has
+ * to grow.
+*/
+#define CADTS_DEFAULT_CAPACITY 8
+
+/**
+ * The equality used by the generated search functions when none is given,
+ * which works for any type that can be compared with ==.
+*/
+#define CADTS_EQUALS(a, b) ((a) == (b))
+
+/**
+ * Works out the capacity an array backed data type should grow to, doubling
+ * the current capacity until it holds the required number of elements.
+ *
+ * @param size_t The current capacity.
+ * @param size_t The number of elements that must fit.
+ * @param size_t The size in bytes of each element.
+ * @return The new capacity, or 0 if the required number of elements could not
+ *         be addressed.
+*/
+static inline size_t CADTS_growCapacity(size_t capacity, size_t required, size_t elem_size) {
+  size_t max_capacity = SIZE_MAX / elem_size;
+  // If the collection could not be addressed, return 0.
+  if (required > max_capacity) {
+    return 0;
+  }
+
+  size_t new_capacity = capacity > 0 ? capacity : CADTS_DEFAULT_CAPACITY;
+  while (new_capacity < required) {
+    if (new_capacity > max_capacity / 2) {
+      return max_capacity;
+    }
+    new_capacity *= 2;
+  }
+  return new_capacity;
+}
+
+#endif /* TYPED_H */
@@ -0,0 +1,203 @@
+/**
+ * @file typed_array_list.h
+ * @brief Type specialised list data type using a dynamic array
+ * @author Jonathan E
+ * @date 17-10-2026
+ *
+ * This is a macro that generates a list data type for a single element type.
+ * The elements are stored by value in a dynamic array, rather than as void
+ * pointers to data on the heap, so the element type is known at compile time.
+ *
+ * CADTS_DEFINE_ARRAY_LIST(T, name) generates the type ArrayList_name and the
+ * following functions, where T is the element type:
+ *
+ *   ArrayList_name* new_ArrayList_name()
+ *   ArrayList_name* new_ArrayList_nameWithCapacity(size_t capacity)
+ *   bool   ArrayList_name_reserve(ArrayList_name* list, size_t capacity)
+ *   bool   ArrayList_name_add(ArrayList_name* list, T value)
+ *   bool   ArrayList_name_insert(ArrayList_name* list, size_t index, T value)
+ *   bool   ArrayList_name_remove(ArrayList_name* list, size_t index)
+ *   bool   ArrayList_name_swapRemove(ArrayList_name* list, size_t index)
+ *   T*     ArrayList_name_get(ArrayList_name* list, size_t index)
+ *   bool   ArrayList_name_set(ArrayList_name* list, size_t index, T value)
+ *   size_t ArrayList_name_size(ArrayList_name* list)
+ *   bool   ArrayList_name_isEmpty(ArrayList_name* list)
+ *   bool   ArrayList_name_contains(ArrayList_name* list, T value)
+ *   size_t ArrayList_name_indexOf(ArrayList_name* list, T value)
+ *   bool   ArrayList_name_clear(ArrayList_name* list)
+ *   void   ArrayList_name_free(ArrayList_name* list)
+ *
+ * These behave like the ArrayList functions of the same name. ArrayList_get()
+ * returns the address of the element, which is only valid until the list is
+ * next modified, or NULL if the index is out of bounds. Sizes and indices that
+ * do not exist are returned as CADTS_NPOS.
+ *
+ * Elements are compared with ==. CADTS_DEFINE_ARRAY_LIST_WITH(T, name, equals)
+ * takes an equality macro or function instead, for types such as structs.
+*/
+
+#ifndef TYPED_ARRAY_LIST_H
+#define TYPED_ARRAY_LIST_H
+
+#include "typed.h"
+
+#define CADTS_DEFINE_ARRAY_LIST(T, name) CADTS_DEFINE_ARRAY_LIST_WITH(T, name, CADTS_EQUALS)
+
+#define CADTS_DEFINE_ARRAY_LIST_WITH(T, name, equals)                                       \
+  typedef struct ArrayList_##name {                                                         \
+    T* collection;                                                                          \
+    size_t size;                                                                            \
+    size_t capacity;                                                                        \
+  } ArrayList_##name;                                                                       \
+                                                                                            \
+  static inline ArrayList_##name* new_ArrayList_##name##WithCapacity(size_t capacity) {     \
+    if (capacity == 0) {                                                                    \
+      capacity = 1;                                                                         \
+    }                                                                                       \
+    if (capacity > SIZE_MAX / sizeof(T)) {                                                  \
+      return NULL;                                                                          \
+    }                                                                                       \
+    ArrayList_##name* list = malloc(sizeof(ArrayList_##name));                              \
+    if (list == NULL) {                                                                     \
+      return NULL;                                                                          \
+    }                                                                                       \
+    list->collection = malloc(sizeof(T) * capacity);                                        \
+    if (list->collection == NULL) {                                                         \
+      free(list);                                                                           \
+      return NULL;                                                                          \
+    }                                                                                       \
+    list->size = 0;                                                                         \
+    list->capacity = capacity;                                                              \
+    return list;                                                                            \
+  }                                                                                         \
+                                                                                            \
+  static inline ArrayList_##name* new_ArrayList_##name() {                                  \
+    return new_ArrayList_##name##WithCapacity(CADTS_DEFAULT_CAPACITY);                      \
+  }                                                                                         \
+                                                                                            \
+  static inline bool ArrayList_##name##_reserve(ArrayList_##name* list, size_t capacity) {  \
+    if (list == NULL) {                                                                     \
+      return false;                                                                         \
+    }                                                                                       \
+    if (capacity <= list->capacity) {                                                       \
+      return true;                                                                          \
+    }                                                                                       \
+    if (capacity > SIZE_MAX / sizeof(T)) {                                                  \
+      return false;                                                                         \
+    }                                                                                       \
+    T* new_collection = realloc(list->collection, sizeof(T) * capacity);                    \
+    if (new_collection == NULL) {                                                           \
+      return false;                                                                         \
+    }                                                                                       \
+    list->collection = new_collection;                                                      \
+    list->capacity = capacity;                                                              \
+    return true;                                                                            \
+  }                                                                                         \
+                                                                                            \
+  static inline bool ArrayList_##name##_grow(ArrayList_##name* list, size_t required) {     \
+    if (required <= list->capacity) {                                                       \
+      return true;                                                                          \
+    }                                                                                       \
+    size_t capacity = CADTS_growCapacity(list->capacity, required, sizeof(T));              \
+    return capacity > 0 && ArrayList_##name##_reserve(list, capacity);                      \
+  }                                                                                         \
+                                                                                            \
+  static inline bool ArrayList_##name##_add(ArrayList_##name* list, T value) {              \
+    if (list == NULL || !ArrayList_##name##_grow(list, list->size + 1)) {                   \
+      return false;                                                                         \
+    }                                                                                       \
+    list->collection[list->size++] = value;                                                 \
+    return true;                                                                            \
+  }                                                                                         \
+                                                                                            \
+  static inline bool ArrayList_##name##_insert(ArrayList_##name* list, size_t index,        \
+                                               T value) {                                   \
+    if (list == NULL || index > list->size) {                                               \
+      return false;                                                                         \
+    }                                                                                       \
+    if (!ArrayList_##name##_grow(list, list->size + 1)) {                                   \
+      return false;                                                                         \
+    }                                                                                       \
+    memmove(&list->collection[index + 1], &list->collection[index],                         \
+            sizeof(T) * (list->size - index));                                              \
+    list->collection[index] = value;                                                        \
+    list->size++;                                                                           \
+    return true;                                                                            \
+  }                                                                                         \
+                                                                                            \
+  static inline bool ArrayList_##name##_remove(ArrayList_##name* list, size_t index) {      \
+    if (list == NULL || index >= list->size) {                                              \
+      return false;                                                                         \
+    }                                                                                       \
+    memmove(&list->collection[index], &list->collection[index + 1],                         \
+            sizeof(T) * (list->size - index - 1));                                          \
+    list->size--;                                                                           \
+    return true;                                                                            \
+  }                                                                                         \
+                                                                                            \
+  static inline bool ArrayList_##name##_swapRemove(ArrayList_##name* list, size_t index) {  \
+    if (list == NULL || index >= list->size) {                                              \
+      return false;                                                                         \
+    }                                                                                       \
+    list->collection[index] = list->collection[list->size - 1];                             \
+    list->size--;                                                                           \
+    return true;                                                                            \
+  }                                                                                         \
+                                                                                            \
+  static inline T* ArrayList_##name##_get(ArrayList_##name* list, size_t index) {           \
+    if (list == NULL || index >= list->size) {                                              \
+      return NULL;                                                                          \
+    }                                                                                       \
+    return &list->collection[index];                                                        \
+  }                                                                                         \
+                                                                                            \
+  static inline bool ArrayList_##name##_set(ArrayList_##name* list, size_t index,           \
+                                            T value) {                                      \
+    if (list == NULL || index >= list->size) {                                              \
+      return false;                                                                         \
+    }                                                                                       \
+    list->collection[index] = value;                                                        \
+    return true;                                                                            \
+  }                                                                                         \
+                                                                                            \
+  static inline size_t ArrayList_##name##_size(ArrayList_##name* list) {                    \
+    return list == NULL ? CADTS_NPOS : list->size;                                          \
+  }                                                                                         \
+                                                                                            \
+  static inline bool ArrayList_##name##_isEmpty(ArrayList_##name* list) {                   \
+    return list == NULL || list->size == 0;                                                 \
+  }                                                                                         \
+                                                                                            \
+  static inline size_t ArrayList_##name##_indexOf(ArrayList_##name* list, T value) {        \
+    if (list == NULL) {                                                                     \
+      return CADTS_NPOS;                                                                    \
+    }                                                                                       \
+    for (size_t i = 0; i < list->size; i++) {                                               \
+      if (equals(list->collection[i], value)) {                                             \
+        return i;                                                                           \
+      }                                                                                     \
+    }                                                                                       \
+    return CADTS_NPOS;                                                                      \
+  }                                                                                         \
+                                                                                            \
+  static inline bool ArrayList_##name##_contains(ArrayList_##name* list, T value) {         \
+    return ArrayList_##name##_indexOf(list, value) != CADTS_NPOS;                           \
+  }                                                                                         \
+                                                                                            \
+  static inline bool ArrayList_##name##_clear(ArrayList_##name* list) {                     \
+    if (list == NULL) {                                                                     \
+      return false;                                                                         \
+    }                                                                                       \
+    list->size = 0;                                                                         \
+    return true;                                                                            \
+  }                                                                                         \
+                                                                                            \
+  static inline void ArrayList_##name##_free(ArrayList_##name* list) {                      \
+    if (list == NULL) {                                                                     \
+      return;                                                                               \
+    }                                                                                       \
+    free(list->collection);                                                                 \
+    free(list);                                                                             \
+  }
+
+#endif /* TYPED_ARRAY_LIST_H */
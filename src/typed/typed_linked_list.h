@@ -0,0 +1,167 @@
+/**
+ * @file typed_linked_list.h
+ * @brief Type specialised linked list data type using a node structure
+ * @author Jonathan E
+ * @date 17-10-2026
+ *
+ * This is a macro that generates a singly linked list data type for a single
+ * element type. Each node holds its element by value, so adding an element
+ * takes one allocation rather than one for the node and one for the data.
+ *
+ * CADTS_DEFINE_LINKED_LIST(T, name) generates the types LinkedList_name and
+ * List_Node_name and the following functions, where T is the element type:
+ *
+ *   LinkedList_name* new_LinkedList_name()
+ *   bool   LinkedList_name_add(LinkedList_name* list, T value)
+ *   bool   LinkedList_name_remove(LinkedList_name* list, size_t index)
+ *   T*     LinkedList_name_get(LinkedList_name* list, size_t index)
+ *   size_t LinkedList_name_size(LinkedList_name* list)
+ *   bool   LinkedList_name_isEmpty(LinkedList_name* list)
+ *   bool   LinkedList_name_contains(LinkedList_name* list, T value)
+ *   size_t LinkedList_name_indexOf(LinkedList_name* list, T value)
+ *   bool   LinkedList_name_clear(LinkedList_name* list)
+ *   void   LinkedList_name_free(LinkedList_name* list)
+ *
+ * These behave like the LinkedList functions of the same name.
+ * LinkedList_get() returns the address of the element in its node, which
+ * stays valid until that node is removed, or NULL if the index is out of
+ * bounds. Sizes and indices that do not exist are returned as CADTS_NPOS.
+ *
+ * Elements are compared with ==. CADTS_DEFINE_LINKED_LIST_WITH(T, name,
+ * equals) takes an equality macro or function instead, for types such as
+ * structs.
+*/
+
+#ifndef TYPED_LINKED_LIST_H
+#define TYPED_LINKED_LIST_H
+
+#include "typed.h"
+
+#define CADTS_DEFINE_LINKED_LIST(T, name) CADTS_DEFINE_LINKED_LIST_WITH(T, name, CADTS_EQUALS)
+
+#define CADTS_DEFINE_LINKED_LIST_WITH(T, name, equals)                                      \
+  typedef struct List_Node_##name {                                                         \
+    T data;                                                                                 \
+    struct List_Node_##name* next;                                                          \
+  } List_Node_##name;                                                                       \
+                                                                                            \
+  typedef struct LinkedList_##name {                                                        \
+    List_Node_##name* head;                                                                 \
+    List_Node_##name* tail;                                                                 \
+    size_t size;                                                                            \
+  } LinkedList_##name;                                                                      \
+                                                                                            \
+  static inline LinkedList_##name* new_LinkedList_##name() {                                \
+    LinkedList_##name* list = malloc(sizeof(LinkedList_##name));                            \
+    if (list == NULL) {                                                                     \
+      return NULL;                                                                          \
+    }                                                                                       \
+    list->head = NULL;                                                                      \
+    list->tail = NULL;                                                                      \
+    list->size = 0;                                                                         \
+    return list;                                                                            \
+  }                                                                                         \
+                                                                                            \
+  static inline bool LinkedList_##name##_add(LinkedList_##name* list, T value) {            \
+    if (list == NULL) {                                                                     \
+      return false;                                                                         \
+    }                                                                                       \
+    List_Node_##name* node = malloc(sizeof(List_Node_##name));                              \
+    if (node == NULL) {                                                                     \
+      return false;                                                                         \
+    }                                                                                       \
+    node->data = value;                                                                     \
+    node->next = NULL;                                                                      \
+    if (list->head == NULL) {                                                               \
+      list->head = node;                                                                    \
+    } else {                                                                                \
+      list->tail->next = node;                                                              \
+    }                                                                                       \
+    list->tail = node;                                                                      \
+    list->size++;                                                                           \
+    return true;                                                                            \
+  }                                                                                         \
+                                                                                            \
+  static inline bool LinkedList_##name##_remove(LinkedList_##name* list, size_t index) {    \
+    if (list == NULL || index >= list->size) {                                              \
+      return false;                                                                         \
+    }                                                                                       \
+    List_Node_##name* previous = NULL;                                                      \
+    List_Node_##name* node = list->head;                                                    \
+    for (size_t i = 0; i < index; i++) {                                                    \
+      previous = node;                                                                      \
+      node = node->next;                                                                    \
+    }                                                                                       \
+    if (previous == NULL) {                                                                 \
+      list->head = node->next;                                                              \
+    } else {                                                                                \
+      previous->next = node->next;                                                          \
+    }                                                                                       \
+    if (node == list->tail) {                                                               \
+      list->tail = previous;                                                                \
+    }                                                                                       \
+    free(node);                                                                             \
+    list->size--;                                                                           \
+    return true;                                                                            \
+  }                                                                                         \
+                                                                                            \
+  static inline T* LinkedList_##name##_get(LinkedList_##name* list, size_t index) {         \
+    if (list == NULL || index >= list->size) {                                              \
+      return NULL;                                                                          \
+    }                                                                                       \
+    List_Node_##name* node = list->head;                                                    \
+    for (size_t i = 0; i < index; i++) {                                                    \
+      node = node->next;                                                                    \
+    }                                                                                       \
+    return &node->data;                                                                     \
+  }                                                                                         \
+                                                                                            \
+  static inline size_t LinkedList_##name##_size(LinkedList_##name* list) {                  \
+    return list == NULL ? CADTS_NPOS : list->size;                                          \
+  }                                                                                         \
+                                                                                            \
+  static inline bool LinkedList_##name##_isEmpty(LinkedList_##name* list) {                 \
+    return list == NULL || list->size == 0;                                                 \
+  }                                                                                         \
+                                                                                            \
+  static inline size_t LinkedList_##name##_indexOf(LinkedList_##name* list, T value) {      \
+    if (list == NULL) {                                                                     \
+      return CADTS_NPOS;                                                                    \
+    }                                                                                       \
+    size_t index = 0;                                                                       \
+    for (List_Node_##name* node = list->head; node != NULL; node = node->next) {            \
+      if (equals(node->data, value)) {                                                      \
+        return index;                                                                       \
+      }                                                                                     \
+      index++;                                                                              \
+    }                                                                                       \
+    return CADTS_NPOS;                                                                      \
+  }                                                                                         \
+                                                                                            \
+  static inline bool LinkedList_##name##_contains(LinkedList_##name* list, T value) {       \
+    return LinkedList_##name##_indexOf(list, value) != CADTS_NPOS;                          \
+  }                                                                                         \
+                                                                                            \
+  static inline bool LinkedList_##name##_clear(LinkedList_##name* list) {                   \
+    if (list == NULL) {                                                                     \
+      return false;                                                                         \
+    }                                                                                       \
+    while (list->head != NULL) {                                                            \
+      List_Node_##name* node = list->head;                                                  \
+      list->head = node->next;                                                              \
+      free(node);                                                                           \
+    }                                                                                       \
+    list->tail = NULL;                                                                      \
+    list->size = 0;                                                                         \
+    return true;                                                                            \
+  }                                                                                         \
+                                                                                            \
+  static inline void LinkedList_##name##_free(LinkedList_##name* list) {                    \
+    if (list == NULL) {                                                                     \
+      return;                                                                               \
+    }                                                                                       \
+    LinkedList_##name##_clear(list);                                                        \
+    free(list);                                                                             \
+  }
+
+#endif /* TYPED_LINKED_LIST_H */
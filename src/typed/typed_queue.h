@@ -0,0 +1,134 @@
+/**
+ * @file typed_queue.h
+ * @brief Type specialised queue data type using a ring buffer
+ * @author Jonathan E
+ * @date 17-10-2026
+ *
+ * This is a macro that generates a queue data type for a single element type.
+ * The elements are stored by value in a ring buffer, so enqueueing is
+ * amortised O(1), dequeueing is O(1), and neither moves the other elements.
+ *
+ * CADTS_DEFINE_QUEUE(T, name) generates the type Queue_name and the following
+ * functions, where T is the element type:
+ *
+ *   Queue_name* new_Queue_name()
+ *   bool   Queue_name_enqueue(Queue_name* queue, T value)
+ *   bool   Queue_name_dequeue(Queue_name* queue, T* value)
+ *   T*     Queue_name_peek(Queue_name* queue)
+ *   size_t Queue_name_size(Queue_name* queue)
+ *   bool   Queue_name_isEmpty(Queue_name* queue)
+ *   bool   Queue_name_clear(Queue_name* queue)
+ *   void   Queue_name_free(Queue_name* queue)
+ *
+ * Queue_dequeue() copies the front element into the given pointer, which may
+ * be NULL to discard it, and returns false if the queue is empty.
+ * Queue_peek() returns the address of the front element, or NULL if the queue
+ * is empty.
+*/
+
+#ifndef TYPED_QUEUE_H
+#define TYPED_QUEUE_H
+
+#include "typed.h"
+
+#define CADTS_DEFINE_QUEUE(T, name)                                                         \
+  typedef struct Queue_##name {                                                             \
+    T* collection;                                                                          \
+    size_t head;                                                                            \
+    size_t size;                                                                            \
+    size_t capacity;                                                                        \
+  } Queue_##name;                                                                           \
+                                                                                            \
+  static inline Queue_##name* new_Queue_##name() {                                          \
+    Queue_##name* queue = malloc(sizeof(Queue_##name));                                     \
+    if (queue == NULL) {                                                                    \
+      return NULL;                                                                          \
+    }                                                                                       \
+    queue->collection = NULL;                                                               \
+    queue->head = 0;                                                                        \
+    queue->size = 0;                                                                        \
+    queue->capacity = 0;                                                                    \
+    return queue;                                                                           \
+  }                                                                                         \
+                                                                                            \
+  static inline bool Queue_##name##_enqueue(Queue_##name* queue, T value) {                 \
+    if (queue == NULL) {                                                                    \
+      return false;                                                                         \
+    }                                                                                       \
+    if (queue->size == queue->capacity) {                                                   \
+      size_t capacity = CADTS_growCapacity(queue->capacity, queue->size + 1, sizeof(T));    \
+      T* new_collection = capacity > 0 ? malloc(sizeof(T) * capacity) : NULL;               \
+      if (new_collection == NULL) {                                                         \
+        return false;                                                                       \
+      }                                                                                     \
+      /* Unwrap the elements to the start of the new buffer. */                             \
+      size_t first = queue->capacity - queue->head;                                         \
+      if (first > queue->size) {                                                            \
+        first = queue->size;                                                                \
+      }                                                                                     \
+      if (queue->size > 0) {                                                                \
+        memcpy(new_collection, &queue->collection[queue->head], sizeof(T) * first);         \
+        memcpy(&new_collection[first], queue->collection, sizeof(T) * (queue->size - first)); \
+      }                                                                                     \
+      free(queue->collection);                                                              \
+      queue->collection = new_collection;                                                   \
+      queue->head = 0;                                                                      \
+      queue->capacity = capacity;                                                           \
+    }                                                                                       \
+    size_t tail = queue->head + queue->size;                                                \
+    if (tail >= queue->capacity) {                                                          \
+      tail -= queue->capacity;                                                              \
+    }                                                                                       \
+    queue->collection[tail] = value;                                                        \
+    queue->size++;                                                                          \
+    return true;                                                                            \
+  }                                                                                         \
+                                                                                            \
+  static inline bool Queue_##name##_dequeue(Queue_##name* queue, T* value) {                \
+    if (queue == NULL || queue->size == 0) {                                                \
+      return false;                                                                         \
+    }                                                                                       \
+    if (value != NULL) {                                                                    \
+      *value = queue->collection[queue->head];                                              \
+    }                                                                                       \
+    queue->head++;                                                                          \
+    if (queue->head == queue->capacity) {                                                   \
+      queue->head = 0;                                                                      \
+    }                                                                                       \
+    queue->size--;                                                                          \
+    return true;                                                                            \
+  }                                                                                         \
+                                                                                            \
+  static inline T* Queue_##name##_peek(Queue_##name* queue) {                               \
+    if (queue == NULL || queue->size == 0) {                                                \
+      return NULL;                                                                          \
+    }                                                                                       \
+    return &queue->collection[queue->head];                                                 \
+  }                                                                                         \
+                                                                                            \
+  static inline size_t Queue_##name##_size(Queue_##name* queue) {                           \
+    return queue == NULL ? CADTS_NPOS : queue->size;                                        \
+  }                                                                                         \
+                                                                                            \
+  static inline bool Queue_##name##_isEmpty(Queue_##name* queue) {                         \
+    return queue == NULL || queue->size == 0;                                               \
+  }                                                                                         \
+                                                                                            \
+  static inline bool Queue_##name##_clear(Queue_##name* queue) {                            \
+    if (queue == NULL) {                                                                    \
+      return false;                                                                         \
+    }                                                                                       \
+    queue->head = 0;                                                                        \
+    queue->size = 0;                                                                        \
+    return true;                                                                            \
+  }                                                                                         \
+                                                                                            \
+  static inline void Queue_##name##_free(Queue_##name* queue) {                             \
+    if (queue == NULL) {                                                                    \
+      return;                                                                               \
+    }                                                                                       \
+    free(queue->collection);                                                                \
+    free(queue);                                                                            \
+  }
+
+#endif /* TYPED_QUEUE_H */
@@ -0,0 +1,112 @@
+/**
+ * @file typed_stack.h
+ * @brief Type specialised stack data type using a dynamic array
+ * @author Jonathan E
+ * @date 17-10-2026
+ *
+ * This is a macro that generates a stack data type for a single element type.
+ * The elements are stored by value in a dynamic array that grows
+ * geometrically, so pushing is amortised O(1) and needs no allocation per
+ * element.
+ *
+ * CADTS_DEFINE_STACK(T, name) generates the type Stack_name and the following
+ * functions, where T is the element type:
+ *
+ *   Stack_name* new_Stack_name()
+ *   bool   Stack_name_push(Stack_name* stack, T value)
+ *   bool   Stack_name_pop(Stack_name* stack, T* value)
+ *   T*     Stack_name_peek(Stack_name* stack)
+ *   size_t Stack_name_size(Stack_name* stack)
+ *   bool   Stack_name_isEmpty(Stack_name* stack)
+ *   bool   Stack_name_clear(Stack_name* stack)
+ *   void   Stack_name_free(Stack_name* stack)
+ *
+ * Stack_pop() copies the top element into the given pointer, which may be
+ * NULL to discard it, and returns false if the stack is empty. Stack_peek()
+ * returns the address of the top element, or NULL if the stack is empty.
+*/
+
+#ifndef TYPED_STACK_H
+#define TYPED_STACK_H
+
+#include "typed.h"
+
+#define CADTS_DEFINE_STACK(T, name)                                                         \
+  typedef struct Stack_##name {                                                             \
+    T* collection;                                                                          \
+    size_t size;                                                                            \
+    size_t capacity;                                                                        \
+  } Stack_##name;                                                                           \
+                                                                                            \
+  static inline Stack_##name* new_Stack_##name() {                                          \
+    Stack_##name* stack = malloc(sizeof(Stack_##name));                                     \
+    if (stack == NULL) {                                                                    \
+      return NULL;                                                                          \
+    }                                                                                       \
+    stack->collection = NULL;                                                               \
+    stack->size = 0;                                                                        \
+    stack->capacity = 0;                                                                    \
+    return stack;                                                                           \
+  }                                                                                         \
+                                                                                            \
+  static inline bool Stack_##name##_push(Stack_##name* stack, T value) {                    \
+    if (stack == NULL) {                                                                    \
+      return false;                                                                         \
+    }                                                                                       \
+    if (stack->size == stack->capacity) {                                                   \
+      size_t capacity = CADTS_growCapacity(stack->capacity, stack->size + 1, sizeof(T));    \
+      T* new_collection = capacity > 0 ? realloc(stack->collection, sizeof(T) * capacity)   \
+                                       : NULL;                                              \
+      if (new_collection == NULL) {                                                         \
+        return false;                                                                       \
+      }                                                                                     \
+      stack->collection = new_collection;                                                   \
+      stack->capacity = capacity;                                                           \
+    }                                                                                       \
+    stack->collection[stack->size++] = value;                                               \
+    return true;                                                                            \
+  }                                                                                         \
+                                                                                            \
+  static inline bool Stack_##name##_pop(Stack_##name* stack, T* value) {                    \
+    if (stack == NULL || stack->size == 0) {                                                \
+      return false;                                                                         \
+    }                                                                                       \
+    stack->size--;                                                                          \
+    if (value != NULL) {                                                                    \
+      *value = stack->collection[stack->size];                                              \
+    }                                                                                       \
+    return true;                                                                            \
+  }                                                                                         \
+                                                                                            \
+  static inline T* Stack_##name##_peek(Stack_##name* stack) {                               \
+    if (stack == NULL || stack->size == 0) {                                                \
+      return NULL;                                                                          \
+    }                                                                                       \
+    return &stack->collection[stack->size - 1];                                             \
+  }                                                                                         \
+                                                                                            \
+  static inline size_t Stack_##name##_size(Stack_##name* stack) {                           \
+    return stack == NULL ? CADTS_NPOS : stack->size;                                        \
+  }                                                                                         \
+                                                                                            \
+  static inline bool Stack_##name##_isEmpty(Stack_##name* stack) {                          \
+    return stack == NULL || stack->size == 0;                                               \
+  }                                                                                         \
+                                                                                            \
+  static inline bool Stack_##name##_clear(Stack_##name* stack) {                            \
+    if (stack == NULL) {                                                                    \
+      return false;                                                                         \
+    }                                                                                       \
+    stack->size = 0;                                                                        \
+    return true;                                                                            \
+  }                                                                                         \
+                                                                                            \
+  static inline void Stack_##name##_free(Stack_##name* stack) {                             \
+    if (stack == NULL) {                                                                    \
+      return;                                                                               \
+    }                                                                                       \
+    free(stack->collection);                                                                \
+    free(stack);                                                                            \
+  }
+
+#endif /* TYPED_STACK_H */
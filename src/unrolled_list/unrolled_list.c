@@ -0,0 +1,464 @@
+/**
+ * @file unrolled_list.c
+ * @brief Unrolled linked list data type implementation
+ * @author Jonathan E
+ * @date 17-10-2026
+ *
+ * This is an implementation of an unrolled linked list data type that can be
+ * used to store generic data.
+ * Each node holds a small array of data pointers, so walking the list follows
+ * one pointer per node rather than one per element, and adding an element
+ * only allocates once the last node is full.
+ * The data stored in the nodes is a void pointer which is dynamically allocated
+ * to the heap.
+*/
+
+#include <string.h>
+
+#include "unrolled_list.h"
+
+/**
+ * Creates a new, empty node, linked to nothing.
+ *
+ * @return the new node, or NULL if the memory allocation failed.
+*/
+static UnrolledList_Node* UnrolledList_newNode() {
+  UnrolledList_Node* new_node = malloc(sizeof(UnrolledList_Node));
+  // If the memory allocation failed, return NULL.
+  if (new_node == NULL) {
+    return NULL;
+  }
+
+  new_node->count = 0;
+  new_node->next = NULL;
+  return new_node;
+}
+
+/**
+ * Finds the node holding the given index, and the position of the index within
+ * that node.
+ *
+ * @param UnrolledList*       the pointer to the unrolled list.
+ * @param size_t*             the index, which must be in bounds. It is replaced
+ *                            by the position within the node.
+ * @param UnrolledList_Node** where to store the node before the one found, or
+ *                            NULL if it is not needed.
+ * @return the node holding the given index.
+*/
+static UnrolledList_Node* UnrolledList_nodeAt(UnrolledList* list, size_t* index, UnrolledList_Node** prev) {
+  UnrolledList_Node* before = NULL;
+  UnrolledList_Node* node = list->head;
+  while (*index >= node->count) {
+    *index -= node->count;
+    before = node;
+    node = node->next;
+  }
+
+  if (prev != NULL) {
+    *prev = before;
+  }
+  return node;
+}
+
+/**
+ * Splits a full node in two, moving the upper half of its elements to a new
+ * node linked in after it.
+ *
+ * @param UnrolledList*      the pointer to the unrolled list.
+ * @param UnrolledList_Node* the node to split.
+ * @return true if the node was split, false if the memory allocation failed.
+*/
+static bool UnrolledList_split(UnrolledList* list, UnrolledList_Node* node) {
+  UnrolledList_Node* new_node = UnrolledList_newNode();
+  // If the memory allocation failed, return false.
+  if (new_node == NULL) {
+    return false;
+  }
+
+  size_t keep = node->count / 2;
+  new_node->count = node->count - keep;
+  memcpy(new_node->data, &node->data[keep], new_node->count * sizeof(void*));
+  node->count = keep;
+
+  new_node->next = node->next;
+  node->next = new_node;
+  if (list->tail == node) {
+    list->tail = new_node;
+  }
+
+  list->node_count++;
+  return true;
+}
+
+/**
+ * Refills a node left less than half full from the node after it, merging the
+ * two if the elements of both fit in one node. The last node is left as it is.
+ *
+ * @param UnrolledList*      the pointer to the unrolled list.
+ * @param UnrolledList_Node* the node to refill.
+*/
+static void UnrolledList_rebalance(UnrolledList* list, UnrolledList_Node* node) {
+  UnrolledList_Node* next = node->next;
+  if (node->count >= UNROLLED_LIST_NODE_CAPACITY / 2 || next == NULL) {
+    return;
+  }
+
+  // Merge the next node into this one.
+  if (node->count + next->count <= UNROLLED_LIST_NODE_CAPACITY) {
+    memcpy(&node->data[node->count], next->data, next->count * sizeof(void*));
+    node->count += next->count;
+    node->next = next->next;
+    if (list->tail == next) {
+      list->tail = node;
+    }
+    free(next);
+    list->node_count--;
+    return;
+  }
+
+  // Otherwise take just enough from the next node to make this one half full,
+  // which leaves the next node more than half full.
+  size_t moved = UNROLLED_LIST_NODE_CAPACITY / 2 - node->count;
+  memcpy(&node->data[node->count], next->data, moved * sizeof(void*));
+  memmove(next->data, &next->data[moved], (next->count - moved) * sizeof(void*));
+  node->count += moved;
+  next->count -= moved;
+}
+
+/**
+ * Creates a new unrolled list using a series of nodes, each holding a small
+ * array of elements, as the underlying collection.
+ * This function uses malloc to allocate memory for the unrolled list.
+ *
+ * @return A pointer to the new unrolled list, or NULL if the memory allocation
+ *         failed.
+*/
+UnrolledList* new_UnrolledList() {
+  UnrolledList* list = malloc(sizeof(UnrolledList));
+  // If the memory allocation failed, return NULL.
+  if (list == NULL) {
+    return NULL;
+  }
+
+  // Initialise the list.
+  list->head = NULL;
+  list->tail = NULL;
+  list->size = 0;
+  list->node_count = 0;
+  return list;
+}
+
+/**
+ * Adds a new element to the end of the unrolled list in O(1), only allocating
+ * a node once the last one is full.
+ * Note that the data is not copied, but rather the pointer to the data is
+ * stored in the node.
+ *
+ * @param UnrolledList* the pointer to the unrolled list.
+ * @param void*         the data to be stored in the list.
+ * @return true if the element was added successfully, false otherwise.
+*/
+bool UnrolledList_add(UnrolledList* list, void* data) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  // If the last node is full, or there is none, link in a new one.
+  if (list->tail == NULL || list->tail->count == UNROLLED_LIST_NODE_CAPACITY) {
+    UnrolledList_Node* new_node = UnrolledList_newNode();
+    // If the memory allocation failed, return false.
+    if (new_node == NULL) {
+      return false;
+    }
+
+    if (list->tail == NULL) {
+      list->head = new_node;
+    } else {
+      list->tail->next = new_node;
+    }
+    list->tail = new_node;
+    list->node_count++;
+  }
+
+  list->tail->data[list->tail->count++] = data;
+  list->size++;
+  return true;
+}
+
+/**
+ * Inserts a new element at the given index of the unrolled list, moving the
+ * elements after it in its node up by one. If the node is full, it is split in
+ * two first.
+ * Note that the data is not copied, but rather the pointer to the data is
+ * stored in the node.
+ *
+ * @param UnrolledList* the pointer to the unrolled list.
+ * @param size_t        the index to insert at, which may be the size of the
+ *                      list to add to the end.
+ * @param void*         the data to be stored in the list.
+ * @return true if the element was inserted successfully, false otherwise.
+*/
+bool UnrolledList_insert(UnrolledList* list, size_t index, void* data) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  // If the index is out of bounds, return false.
+  if (index > list->size) {
+    return false;
+  }
+
+  // Inserting at the end is adding.
+  if (index == list->size) {
+    return UnrolledList_add(list, data);
+  }
+
+  UnrolledList_Node* node = UnrolledList_nodeAt(list, &index, NULL);
+
+  // If the node is full, split it and insert into whichever half holds the
+  // index.
+  if (node->count == UNROLLED_LIST_NODE_CAPACITY) {
+    if (!UnrolledList_split(list, node)) {
+      return false;
+    }
+    if (index >= node->count) {
+      index -= node->count;
+      node = node->next;
+    }
+  }
+
+  memmove(&node->data[index + 1], &node->data[index], (node->count - index) * sizeof(void*));
+  node->data[index] = data;
+  node->count++;
+  list->size++;
+  return true;
+}
+
+/**
+ * Removes a given index from the unrolled list. If its node is left less than
+ * half full, it is merged with the node after it, or takes elements from it.
+ *
+ * @param UnrolledList* the pointer to the unrolled list.
+ * @param size_t        the index of the element to be removed.
+ * @return true if the element was removed successfully, false otherwise.
+*/
+bool UnrolledList_remove(UnrolledList* list, size_t index) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  // If the index is out of bounds, return false.
+  if (index >= list->size) {
+    return false;
+  }
+
+  UnrolledList_Node* prev;
+  UnrolledList_Node* node = UnrolledList_nodeAt(list, &index, &prev);
+  memmove(&node->data[index], &node->data[index + 1], (node->count - index - 1) * sizeof(void*));
+  node->count--;
+  list->size--;
+
+  // Only the last node can be emptied, as any other is refilled before it
+  // gets there, so unlink it from the node before.
+  if (node->count == 0) {
+    if (prev == NULL) {
+      list->head = node->next;
+    } else {
+      prev->next = node->next;
+    }
+    if (list->tail == node) {
+      list->tail = prev;
+    }
+    free(node);
+    list->node_count--;
+    return true;
+  }
+
+  UnrolledList_rebalance(list, node);
+  return true;
+}
+
+/**
+ * Gets the data at the specified index, walking the list a node at a time.
+ * Note that the data is not copied, but rather the pointer to the data is
+ * returned.
+ *
+ * @param UnrolledList* the pointer to the unrolled list.
+ * @param size_t        the index of the element to get the data from.
+ * @return the data at the specified index, or NULL if the index is out of
+ *         bounds.
+*/
+void* UnrolledList_get(UnrolledList* list, size_t index) {
+  // If the list is NULL, return NULL.
+  if (list == NULL) {
+    return NULL;
+  }
+
+  // If the index is out of bounds, return NULL.
+  if (index >= list->size) {
+    return NULL;
+  }
+
+  UnrolledList_Node* node = UnrolledList_nodeAt(list, &index, NULL);
+  return node->data[index];
+}
+
+/**
+ * Gets the size of the unrolled list.
+ *
+ * @param UnrolledList* the pointer to the unrolled list.
+ * @return the size of the unrolled list, or UNROLLED_LIST_NPOS if the list is
+ *         NULL.
+*/
+size_t UnrolledList_size(UnrolledList* list) {
+  // If the list is NULL, return UNROLLED_LIST_NPOS.
+  if (list == NULL) {
+    return UNROLLED_LIST_NPOS;
+  }
+
+  return list->size;
+}
+
+/**
+ * Checks if the unrolled list is empty.
+ *
+ * @param UnrolledList* the pointer to the unrolled list.
+ * @return true if the unrolled list is empty, false otherwise.
+*/
+bool UnrolledList_isEmpty(UnrolledList* list) {
+  // If the list is NULL, return true.
+  if (list == NULL) {
+    return true;
+  }
+
+  return list->size == 0;
+}
+
+/**
+ * Checks if the unrolled list contains the specified data.
+ * The pointer to the data is checked, not the data itself.
+ *
+ * @param UnrolledList* the pointer to the unrolled list.
+ * @param void*         the data to check for.
+ * @return true if the unrolled list contains the specified data, false
+ *         otherwise.
+*/
+bool UnrolledList_contains(UnrolledList* list, void* data) {
+  return UnrolledList_indexOf(list, data) != UNROLLED_LIST_NPOS;
+}
+
+/**
+ * Gets the index of the specified data in the unrolled list.
+ * The pointer to the data is checked, not the data itself.
+ *
+ * @param UnrolledList* the pointer to the unrolled list.
+ * @param void*         the data to check for.
+ * @return the index of the specified data, or UNROLLED_LIST_NPOS if the data
+ *         is not found.
+*/
+size_t UnrolledList_indexOf(UnrolledList* list, void* data) {
+  // If the list is NULL, return UNROLLED_LIST_NPOS.
+  if (list == NULL) {
+    return UNROLLED_LIST_NPOS;
+  }
+
+  // Scan each node's elements in turn.
+  size_t base = 0;
+  for (UnrolledList_Node* node = list->head; node != NULL; node = node->next) {
+    for (size_t i = 0; i < node->count; i++) {
+      if (node->data[i] == data) {
+        return base + i;
+      }
+    }
+    base += node->count;
+  }
+
+  return UNROLLED_LIST_NPOS;
+}
+
+/**
+ * Prints the unrolled list as a list of pointers.
+ *
+ * @param UnrolledList* the pointer to the unrolled list.
+*/
+void UnrolledList_print(UnrolledList* list) {
+  // If the list is NULL, return.
+  if (list == NULL) {
+    printf("NULL\n");
+    return;
+  }
+
+  // Print the list.
+  printf("[");
+  for (UnrolledList_Node* node = list->head; node != NULL; node = node->next) {
+    for (size_t i = 0; i < node->count; i++) {
+      printf("%p ", node->data[i]);
+    }
+  }
+  printf("]\n");
+}
+
+/**
+ * Prints the unrolled list as a list of integers.
+ *
+ * @param UnrolledList* the pointer to the unrolled list.
+*/
+void UnrolledList_printInt(UnrolledList* list) {
+  // If the list is NULL, return.
+  if (list == NULL) {
+    printf("NULL\n");
+    return;
+  }
+
+  // Print the list.
+  printf("[");
+  for (UnrolledList_Node* node = list->head; node != NULL; node = node->next) {
+    for (size_t i = 0; i < node->count; i++) {
+      printf("%d ", *(int*)node->data[i]);
+    }
+  }
+  printf("]\n");
+}
+
+/**
+ * Clears the unrolled list.
+ *
+ * @param UnrolledList* the pointer to the unrolled list.
+ * @return true if the nodes were removed successfully, false otherwise.
+*/
+bool UnrolledList_clear(UnrolledList* list) {
+  // If the list is NULL, return false.
+  if (list == NULL) {
+    return false;
+  }
+
+  // Remove all nodes.
+  while (list->head != NULL) {
+    UnrolledList_Node* node = list->head;
+    list->head = list->head->next;
+    free(node);
+  }
+
+  list->tail = NULL;
+  list->size = 0;
+  list->node_count = 0;
+  return true;
+}
+
+/**
+ * Frees the memory allocated for the unrolled list.
+ *
+ * @param UnrolledList* the pointer to the unrolled list.
+*/
+void UnrolledList_free(UnrolledList* list) {
+  // If the list is NULL, return.
+  if (list == NULL) {
+    return;
+  }
+
+  UnrolledList_clear(list);
+  free(list);
+}
@@ -0,0 +1,181 @@
+/**
+ * @file unrolled_list.h
+ * @brief Unrolled linked list data type implementation using a node structure
+ * @author Jonathan E
+ * @date 17-10-2026
+ *
+ * This is a linked list data type that can be used to store data in an
+ * unrolled linked list structure.
+ * Each node holds a small array of up to UNROLLED_LIST_NODE_CAPACITY data
+ * pointers rather than a single one, so a walk over the list touches one node
+ * per run of elements instead of one per element, and the list makes one
+ * allocation per run rather than one per element. A full node is split in two
+ * to make room, and a node left less than half full is merged with, or refilled
+ * from, the node after it.
+ * The data stored in the nodes is a void pointer which is dynamically allocated
+ * to the heap.
+*/
+
+#ifndef UNROLLED_LIST_H
+#define UNROLLED_LIST_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * The value returned in place of a size or index when there is none, such as
+ * when the unrolled list is NULL or an element is not found.
+*/
+#define UNROLLED_LIST_NPOS ((size_t) -1)
+
+/**
+ * The number of data pointers held by each node. With 32 pointers and the
+ * count and next pointer, a node is 272 bytes on a 64-bit system.
+*/
+#define UNROLLED_LIST_NODE_CAPACITY 32
+
+/**
+ * A node of an unrolled list, holding count data pointers in order. Every node
+ * other than the last is kept at least half full.
+*/
+typedef struct UnrolledList_Node {
+  size_t count;
+  struct UnrolledList_Node* next;
+  void* data[UNROLLED_LIST_NODE_CAPACITY];
+} UnrolledList_Node;
+
+typedef struct UnrolledList {
+  UnrolledList_Node* head;
+  UnrolledList_Node* tail;
+  size_t size;
+  size_t node_count;
+} UnrolledList;
+
+/**
+ * Creates a new unrolled list using a series of nodes, each holding a small
+ * array of elements, as the underlying collection.
+ *
+ * @return A pointer to the new unrolled list.
+*/
+UnrolledList* new_UnrolledList();
+
+/**
+ * Adds a new element to the end of the unrolled list in O(1), only allocating
+ * a node once the last one is full.
+ * Note that the data is not copied, but rather the pointer to the data is
+ * stored in the node.
+ *
+ * @param UnrolledList* the pointer to the unrolled list.
+ * @param void*         the data to be stored in the list.
+ * @return true if the element was added successfully, false otherwise.
+*/
+bool UnrolledList_add(UnrolledList*, void*);
+
+/**
+ * Inserts a new element at the given index of the unrolled list, moving the
+ * elements after it in its node up by one. If the node is full, it is split in
+ * two first.
+ * Note that the data is not copied, but rather the pointer to the data is
+ * stored in the node.
+ *
+ * @param UnrolledList* the pointer to the unrolled list.
+ * @param size_t        the index to insert at, which may be the size of the
+ *                      list to add to the end.
+ * @param void*         the data to be stored in the list.
+ * @return true if the element was inserted successfully, false otherwise.
+*/
+bool UnrolledList_insert(UnrolledList*, size_t, void*);
+
+/**
+ * Removes a given index from the unrolled list. If its node is left less than
+ * half full, it is merged with the node after it, or takes elements from it.
+ *
+ * @param UnrolledList* the pointer to the unrolled list.
+ * @param size_t        the index of the element to be removed.
+ * @return true if the element was removed successfully, false otherwise.
+*/
+bool UnrolledList_remove(UnrolledList*, size_t);
+
+/**
+ * Gets the data at the specified index, walking the list a node at a time.
+ * Note that the data is not copied, but rather the pointer to the data is
+ * returned.
+ *
+ * @param UnrolledList* the pointer to the unrolled list.
+ * @param size_t        the index of the element to get the data from.
+ * @return the data at the specified index, or NULL if the index is out of
+ *         bounds.
+*/
+void* UnrolledList_get(UnrolledList*, size_t);
+
+/**
+ * Gets the size of the unrolled list.
+ *
+ * @param UnrolledList* the pointer to the unrolled list.
+ * @return the size of the unrolled list, or UNROLLED_LIST_NPOS if the list is
+ *         NULL.
+*/
+size_t UnrolledList_size(UnrolledList*);
+
+/**
+ * Checks if the unrolled list is empty.
+ *
+ * @param UnrolledList* the pointer to the unrolled list.
+ * @return true if the unrolled list is empty, false otherwise.
+*/
+bool UnrolledList_isEmpty(UnrolledList*);
+
+/**
+ * Checks if the unrolled list contains the specified data.
+ * The pointer to the data is checked, not the data itself.
+ *
+ * @param UnrolledList* the pointer to the unrolled list.
+ * @param void*         the data to be checked.
+ * @return true if the unrolled list contains the specified data, false
+ *         otherwise.
+*/
+bool UnrolledList_contains(UnrolledList*, void*);
+
+/**
+ * Gets the index of the specified data in the unrolled list.
+ * The pointer to the data is checked, not the data itself.
+ *
+ * @param UnrolledList* the pointer to the unrolled list.
+ * @param void*         the data to be checked.
+ * @return the index of the specified data, or UNROLLED_LIST_NPOS if the data
+ *         is not in the unrolled list.
+*/
+size_t UnrolledList_indexOf(UnrolledList*, void*);
+
+/**
+ * Prints the unrolled list as a list of pointers.
+ *
+ * @param UnrolledList* the pointer to the unrolled list.
+*/
+void UnrolledList_print(UnrolledList*);
+
+/**
+ * Prints the unrolled list as a list of integers.
+ *
+ * @param UnrolledList* the pointer to the unrolled list.
+*/
+void UnrolledList_printInt(UnrolledList*);
+
+/**
+ * Clears the given unrolled list.
+ *
+ * @param UnrolledList* the pointer to the unrolled list.
+ * @return true if the unrolled list was cleared successfully, false otherwise.
+*/
+bool UnrolledList_clear(UnrolledList*);
+
+/**
+ * Frees the memory allocated to the unrolled list.
+ *
+ * @param UnrolledList* the pointer to the unrolled list.
+*/
+void UnrolledList_free(UnrolledList*);
+
+#endif /* UNROLLED_LIST_H */
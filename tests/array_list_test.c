@@ -12,9 +12,54 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 #include "../src/array_list/array_list.h"
 
+#if defined(__linux__) && !defined(ARRAY_LIST_NO_MMAP)
+#include <sys/mman.h>
+#endif
+
+/**
+ * Compares two pointers to integers, for use as an ArrayList_Comparator.
+ * 
+ * @param const void* The first integer.
+ * @param const void* The second integer.
+ * @return A negative number, zero or a positive number if the first integer
+ *         is less than, equal to or greater than the second.
+*/
+int compare_int(const void* a, const void* b) {
+  int x = *(const int*) a;
+  int y = *(const int*) b;
+  return (x > y) - (x < y);
+}
+
+/**
+ * Checks that the given array list holds integers in ascending order.
+ * 
+ * @param ArrayList* The array list to check.
+ * @return true if the array list is sorted, false otherwise.
+*/
+bool is_sorted_int(ArrayList* list) {
+  for (size_t i = 1; i < ArrayList_size(list); i++) {
+    if (*(int*) ArrayList_get(list, i - 1) > *(int*) ArrayList_get(list, i)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Gives the value of a pointer to an integer as a key, for use as an
+ * ArrayList_KeyFunction.
+ * 
+ * @param const void* The integer.
+ * @return The integer as an unsigned key.
+*/
+uint64_t key_int(const void* data) {
+  return (uint64_t) *(const int*) data;
+}
+
 /**
  * Test function for new_ArrayList().
  * 
@@ -465,7 +510,7 @@ bool test_ArrayList_size_with_multiple() {
 bool test_ArrayList_size_from_null() {
   ArrayList* list = NULL;
 
-  if (ArrayList_size(list) != -1) {
+  if (ArrayList_size(list) != ARRAY_LIST_NPOS) {
     return false;
   }
 
@@ -712,7 +757,7 @@ bool test_ArrayList_indexOf_from_null() {
 
   int element = 1;
 
-  if (ArrayList_indexOf(list, &element) != -1) {
+  if (ArrayList_indexOf(list, &element) != ARRAY_LIST_NPOS) {
     return false;
   }
 
@@ -728,7 +773,7 @@ bool test_ArrayList_indexOf_from_empty() {
 
   int element = 1;
 
-  if (ArrayList_indexOf(list, &element) != -1) {
+  if (ArrayList_indexOf(list, &element) != ARRAY_LIST_NPOS) {
     return false;
   }
 
@@ -835,53 +880,3194 @@ bool test_ArrayList_clear_from_empty() {
 }
 
 /**
- * Main function used to run the tests.
+ * Test function for new_ArrayListWithCapacity().
+ * 
+ * @return true if the test passes, false otherwise.
 */
-int main() {
-  printf("Running unit tests for ArrayList.h...\n");
+bool test_new_ArrayListWithCapacity() {
+  ArrayList* list = new_ArrayListWithCapacity(100);
 
-  printf("\ttesting new_ArrayList()...............................%s\n", test_new_ArrayList() ? "PASS" : "FAIL");
-  
-  printf("\ttesting ArrayList_add()...............................%s\n", test_ArrayList_add() ? "PASS" : "FAIL");
-  printf("\ttesting ArrayList_add() with multiple elements........%s\n", test_ArrayList_add_multiple() ? "PASS" : "FAIL");
-  printf("\ttesting ArrayList_add() to NULL.......................%s\n", test_ArrayList_add_to_null() ? "PASS" : "FAIL");
+  if (list == NULL) {
+    return false;
+  }
 
-  printf("\ttesting ArrayList_remove()............................%s\n", test_ArrayList_remove() ? "PASS" : "FAIL");
-  printf("\ttesting ArrayList_remove() with multiple elements.....%s\n", test_ArrayList_remove_multiple() ? "PASS" : "FAIL");
-  printf("\ttesting ArrayList_remove() from NULL..................%s\n", test_ArrayList_remove_from_null() ? "PASS" : "FAIL");
-  printf("\ttesting ArrayList_remove() using index too large......%s\n", test_ArrayList_remove_index_too_large() ? "PASS" : "FAIL");
-  printf("\ttesting ArrayList_remove() using index too small......%s\n", test_ArrayList_remove_index_too_small() ? "PASS" : "FAIL");
-  printf("\ttesting ArrayList_remove() from empty.................%s\n", test_ArrayList_remove_from_empty() ? "PASS" : "FAIL");
+  if (list->size != 0) {
+    return false;
+  }
 
-  printf("\ttesting ArrayList_get()...............................%s\n", test_ArrayList_get() ? "PASS" : "FAIL");
-  printf("\ttesting ArrayList_get() with multiple elements........%s\n", test_ArrayList_get_multiple() ? "PASS" : "FAIL");
-  printf("\ttesting ArrayList_get() from NULL.....................%s\n", test_ArrayList_get_from_null() ? "PASS" : "FAIL");
-  printf("\ttesting ArrayList_get() using index too large.........%s\n", test_ArrayList_get_index_too_large() ? "PASS" : "FAIL");
-  printf("\ttesting ArrayList_get() using index too small.........%s\n", test_ArrayList_get_index_too_small() ? "PASS" : "FAIL");
-  printf("\ttesting ArrayList_get() from empty....................%s\n", test_ArrayList_get_from_empty() ? "PASS" : "FAIL");
+  if (ArrayList_capacity(list) != 100) {
+    return false;
+  }
 
-  printf("\ttesting ArrayList_size()..............................%s\n", test_ArrayList_size() ? "PASS" : "FAIL");
-  printf("\ttesting ArrayList_size() with multiple elements.......%s\n", test_ArrayList_size_with_multiple() ? "PASS" : "FAIL");
-  printf("\ttesting ArrayList_size() from NULL....................%s\n", test_ArrayList_size_from_null() ? "PASS" : "FAIL");
+  ArrayList_free(list);
+  return true;
+}
 
-  printf("\ttesting ArrayList_isEmpty()...........................%s\n", test_ArrayList_isEmpty() ? "PASS" : "FAIL");
-  printf("\ttesting ArrayList_isEmpty() with multiple elements....%s\n", test_ArrayList_isEmpty_with_multiple() ? "PASS" : "FAIL");
-  printf("\ttesting ArrayList_isEmpty() from NULL.................%s\n", test_ArrayList_isEmpty_from_null() ? "PASS" : "FAIL");
+bool test_new_ArrayListWithCapacity_negative() {
+  ArrayList* list = new_ArrayListWithCapacity(-1);
 
-  printf("\ttesting ArrayList_contains()..........................%s\n", test_ArrayList_contains() ? "PASS" : "FAIL");
-  printf("\ttesting ArrayList_contains() with multiple elements...%s\n", test_ArrayList_contains_with_multiple() ? "PASS" : "FAIL");
-  printf("\ttesting ArrayList_contains() from NULL................%s\n", test_ArrayList_contains_from_null() ? "PASS" : "FAIL");
-  printf("\ttesting ArrayList_contains() from empty...............%s\n", test_ArrayList_contains_from_empty() ? "PASS" : "FAIL");
+  if (list != NULL) {
+    return false;
+  }
 
-  printf("\ttesting ArrayList_indexOf()...........................%s\n", test_ArrayList_indexOf() ? "PASS" : "FAIL");
-  printf("\ttesting ArrayList_indexOf() with multiple elements....%s\n", test_ArrayList_indexOf_with_multiple() ? "PASS" : "FAIL");
-  printf("\ttesting ArrayList_indexOf() from NULL.................%s\n", test_ArrayList_indexOf_from_null() ? "PASS" : "FAIL");
-  printf("\ttesting ArrayList_indexOf() from empty................%s\n", test_ArrayList_indexOf_from_empty() ? "PASS" : "FAIL");
+  return true;
+}
 
-  printf("\ttesting ArrayList_clear().............................%s\n", test_ArrayList_clear() ? "PASS" : "FAIL");
-  printf("\ttesting ArrayList_clear() with multiple elements......%s\n", test_ArrayList_clear_with_multiple() ? "PASS" : "FAIL");
-  printf("\ttesting ArrayList_clear() from NULL...................%s\n", test_ArrayList_clear_from_null() ? "PASS" : "FAIL");
-  printf("\ttesting ArrayList_clear() from empty..................%s\n", test_ArrayList_clear_from_empty() ? "PASS" : "FAIL");
+/**
+ * Test function for ArrayList_reserve().
+ * 
+ * @return true if the test passes, false otherwise.
+*/
+bool test_ArrayList_reserve() {
+  ArrayList* list = new_ArrayList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  if (!ArrayList_reserve(list, 1000)) {
+    return false;
+  }
+
+  if (ArrayList_capacity(list) < 1000) {
+    return false;
+  }
+
+  // Adding up to the reserved capacity must not move the collection.
+  void** collection = list->collection;
+  int elements[1000];
+  for (int i = 0; i < 1000; i++) {
+    elements[i] = i;
+    if (!ArrayList_add(list, &elements[i])) {
+      return false;
+    }
+  }
+
+  if (list->collection != collection) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+bool test_ArrayList_reserve_from_null() {
+  ArrayList* list = NULL;
+
+  if (ArrayList_reserve(list, 10)) {
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * Test function for ArrayList_add() growing the collection geometrically.
+ * 
+ * @return true if the test passes, false otherwise.
+*/
+bool test_ArrayList_add_growth() {
+  ArrayList* list = new_ArrayList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int element = 1;
+  int reallocations = 0;
+  size_t capacity = ArrayList_capacity(list);
+  for (int i = 0; i < 100000; i++) {
+    if (!ArrayList_add(list, &element)) {
+      return false;
+    }
+    if (ArrayList_capacity(list) != capacity) {
+      capacity = ArrayList_capacity(list);
+      reallocations++;
+    }
+  }
+
+  if (ArrayList_size(list) != 100000) {
+    return false;
+  }
+
+  // Doubling from the default capacity needs at most 17 reallocations.
+  if (reallocations > 17) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_shrinkToFit().
+ * 
+ * @return true if the test passes, false otherwise.
+*/
+bool test_ArrayList_shrinkToFit() {
+  ArrayList* list = new_ArrayListWithCapacity(64);
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int element1 = 1;
+  int element2 = 2;
+
+  if (!ArrayList_add(list, &element1)) {
+    return false;
+  }
+
+  if (!ArrayList_add(list, &element2)) {
+    return false;
+  }
+
+  if (!ArrayList_shrinkToFit(list)) {
+    return false;
+  }
+
+  // A list small enough for the inline buffer moves back into it.
+  if (ArrayList_capacity(list) != ARRAY_LIST_INLINE_CAPACITY || list->collection != list->inline_buffer.pointers) {
+    return false;
+  }
+
+  if (ArrayList_get(list, 0) != &element1 || ArrayList_get(list, 1) != &element2) {
+    return false;
+  }
+
+  // A larger list keeps a collection on the heap of exactly its size.
+  int elements[10];
+  for (int i = 0; i < 10; i++) {
+    if (!ArrayList_add(list, &elements[i])) {
+      return false;
+    }
+  }
+
+  if (!ArrayList_shrinkToFit(list) || ArrayList_capacity(list) != 12) {
+    return false;
+  }
+
+  if (ArrayList_get(list, 1) != &element2 || ArrayList_get(list, 11) != &elements[9]) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+bool test_ArrayList_shrinkToFit_from_empty() {
+  ArrayList* list = new_ArrayListWithCapacity(64);
+
+  if (list == NULL) {
+    return false;
+  }
+
+  if (!ArrayList_shrinkToFit(list)) {
+    return false;
+  }
+
+  if (ArrayList_capacity(list) != ARRAY_LIST_INLINE_CAPACITY) {
+    return false;
+  }
+
+  int element = 1;
+
+  if (!ArrayList_add(list, &element)) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+bool test_ArrayList_shrinkToFit_from_null() {
+  ArrayList* list = NULL;
+
+  if (ArrayList_shrinkToFit(list)) {
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * Test function for ArrayList_addAll().
+ * 
+ * @return true if the test passes, false otherwise.
+*/
+bool test_ArrayList_addAll() {
+  ArrayList* list = new_ArrayList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int elements[100];
+  void* items[100];
+  for (int i = 0; i < 100; i++) {
+    elements[i] = i;
+    items[i] = &elements[i];
+  }
+
+  if (!ArrayList_add(list, &elements[0])) {
+    return false;
+  }
+
+  if (!ArrayList_addAll(list, items, 100)) {
+    return false;
+  }
+
+  if (ArrayList_size(list) != 101) {
+    return false;
+  }
+
+  for (int i = 0; i < 100; i++) {
+    if (ArrayList_get(list, i + 1) != &elements[i]) {
+      return false;
+    }
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+bool test_ArrayList_addAll_to_null() {
+  ArrayList* list = NULL;
+
+  int element = 1;
+  void* items[1] = { &element };
+
+  if (ArrayList_addAll(list, items, 1)) {
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * Test function for ArrayList_insertRange().
+ * 
+ * @return true if the test passes, false otherwise.
+*/
+bool test_ArrayList_insertRange() {
+  ArrayList* list = new_ArrayList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int element1 = 1;
+  int element2 = 2;
+  int element3 = 3;
+  int element4 = 4;
+  void* items[2] = { &element2, &element3 };
+
+  if (!ArrayList_add(list, &element1)) {
+    return false;
+  }
+
+  if (!ArrayList_add(list, &element4)) {
+    return false;
+  }
+
+  if (!ArrayList_insertRange(list, 1, items, 2)) {
+    return false;
+  }
+
+  if (ArrayList_size(list) != 4) {
+    return false;
+  }
+
+  if (ArrayList_get(list, 0) != &element1 || ArrayList_get(list, 1) != &element2 ||
+      ArrayList_get(list, 2) != &element3 || ArrayList_get(list, 3) != &element4) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+bool test_ArrayList_insertRange_index_too_large() {
+  ArrayList* list = new_ArrayList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int element = 1;
+  void* items[1] = { &element };
+
+  if (ArrayList_insertRange(list, 1, items, 1)) {
+    return false;
+  }
+
+  if (ArrayList_size(list) != 0) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_removeRange().
+ * 
+ * @return true if the test passes, false otherwise.
+*/
+bool test_ArrayList_removeRange() {
+  ArrayList* list = new_ArrayList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int elements[10];
+  for (int i = 0; i < 10; i++) {
+    elements[i] = i;
+    if (!ArrayList_add(list, &elements[i])) {
+      return false;
+    }
+  }
+
+  if (!ArrayList_removeRange(list, 2, 7)) {
+    return false;
+  }
+
+  if (ArrayList_size(list) != 5) {
+    return false;
+  }
+
+  if (ArrayList_get(list, 1) != &elements[1] || ArrayList_get(list, 2) != &elements[7]) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+bool test_ArrayList_removeRange_invalid() {
+  ArrayList* list = new_ArrayList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int element = 1;
+
+  if (!ArrayList_add(list, &element)) {
+    return false;
+  }
+
+  if (ArrayList_removeRange(list, 0, 2)) {
+    return false;
+  }
+
+  if (ArrayList_removeRange(list, 1, 0)) {
+    return false;
+  }
+
+  if (ArrayList_size(list) != 1) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+bool test_ArrayList_removeRange_from_null() {
+  ArrayList* list = NULL;
+
+  if (ArrayList_removeRange(list, 0, 0)) {
+    return false;
+  }
+
+  return true;
+}
+
+bool test_ArrayList_remove_keeps_capacity() {
+  ArrayList* list = new_ArrayList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int elements[100];
+  for (int i = 0; i < 100; i++) {
+    elements[i] = i;
+    if (!ArrayList_add(list, &elements[i])) {
+      return false;
+    }
+  }
+
+  // Removing a few elements must not reallocate the collection.
+  size_t capacity = ArrayList_capacity(list);
+  for (int i = 0; i < 10; i++) {
+    if (!ArrayList_remove(list, 0)) {
+      return false;
+    }
+  }
+
+  if (ArrayList_capacity(list) != capacity) {
+    return false;
+  }
+
+  // Once the list is sparse, the collection is allowed to shrink.
+  while (ArrayList_size(list) > 1) {
+    if (!ArrayList_remove(list, 0)) {
+      return false;
+    }
+  }
+
+  if (ArrayList_capacity(list) >= capacity) {
+    return false;
+  }
+
+  if (ArrayList_get(list, 0) != &elements[99]) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_swapRemove().
+ * 
+ * @return true if the test passes, false otherwise.
+*/
+bool test_ArrayList_swapRemove() {
+  ArrayList* list = new_ArrayList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int element1 = 1;
+  int element2 = 2;
+  int element3 = 3;
+
+  if (!ArrayList_add(list, &element1)) {
+    return false;
+  }
+
+  if (!ArrayList_add(list, &element2)) {
+    return false;
+  }
+
+  if (!ArrayList_add(list, &element3)) {
+    return false;
+  }
+
+  if (!ArrayList_swapRemove(list, 0)) {
+    return false;
+  }
+
+  if (ArrayList_size(list) != 2) {
+    return false;
+  }
+
+  if (ArrayList_get(list, 0) != &element3 || ArrayList_get(list, 1) != &element2) {
+    return false;
+  }
+
+  if (!ArrayList_swapRemove(list, 1)) {
+    return false;
+  }
+
+  if (ArrayList_size(list) != 1 || ArrayList_get(list, 0) != &element3) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+bool test_ArrayList_swapRemove_from_null() {
+  ArrayList* list = NULL;
+
+  if (ArrayList_swapRemove(list, 0)) {
+    return false;
+  }
+
+  return true;
+}
+
+bool test_ArrayList_swapRemove_from_empty() {
+  ArrayList* list = new_ArrayList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  if (ArrayList_swapRemove(list, 0)) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+bool test_ArrayList_indexOf_large() {
+  ArrayList* list = new_ArrayList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  // Use enough elements for the vectorised search and an odd-sized tail.
+  int elements[1003];
+  for (int i = 0; i < 1003; i++) {
+    elements[i] = i;
+    if (!ArrayList_add(list, &elements[i])) {
+      return false;
+    }
+  }
+
+  for (int i = 0; i < 1003; i++) {
+    if (ArrayList_indexOf(list, &elements[i]) != (size_t) i) {
+      return false;
+    }
+  }
+
+  int missing = 0;
+
+  if (ArrayList_indexOf(list, &missing) != ARRAY_LIST_NPOS) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_lastIndexOf().
+ * 
+ * @return true if the test passes, false otherwise.
+*/
+bool test_ArrayList_lastIndexOf() {
+  ArrayList* list = new_ArrayList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int element1 = 1;
+  int element2 = 2;
+
+  for (int i = 0; i < 101; i++) {
+    if (!ArrayList_add(list, i % 10 == 3 ? &element1 : &element2)) {
+      return false;
+    }
+  }
+
+  if (ArrayList_lastIndexOf(list, &element1) != 93) {
+    return false;
+  }
+
+  if (ArrayList_lastIndexOf(list, &element2) != 100) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+bool test_ArrayList_lastIndexOf_from_null() {
+  ArrayList* list = NULL;
+
+  int element = 1;
+
+  if (ArrayList_lastIndexOf(list, &element) != ARRAY_LIST_NPOS) {
+    return false;
+  }
+
+  return true;
+}
+
+bool test_ArrayList_lastIndexOf_from_empty() {
+  ArrayList* list = new_ArrayList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int element = 1;
+
+  if (ArrayList_lastIndexOf(list, &element) != ARRAY_LIST_NPOS) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_count().
+ * 
+ * @return true if the test passes, false otherwise.
+*/
+bool test_ArrayList_count() {
+  ArrayList* list = new_ArrayList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int element1 = 1;
+  int element2 = 2;
+  int element3 = 3;
+
+  for (int i = 0; i < 101; i++) {
+    if (!ArrayList_add(list, i % 10 == 3 ? &element1 : &element2)) {
+      return false;
+    }
+  }
+
+  if (ArrayList_count(list, &element1) != 10) {
+    return false;
+  }
+
+  if (ArrayList_count(list, &element2) != 91) {
+    return false;
+  }
+
+  if (ArrayList_count(list, &element3) != 0) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+bool test_ArrayList_count_from_null() {
+  ArrayList* list = NULL;
+
+  int element = 1;
+
+  if (ArrayList_count(list, &element) != ARRAY_LIST_NPOS) {
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * Test function for ArrayList_sort().
+ * 
+ * @return true if the test passes, false otherwise.
+*/
+bool test_ArrayList_sort() {
+  ArrayList* list = new_ArrayList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  // Use enough elements to exercise the partitioning, not just insertion sort.
+  int elements[5000];
+  srand(5000);
+  for (int i = 0; i < 5000; i++) {
+    elements[i] = rand() % 1000;
+    if (!ArrayList_add(list, &elements[i])) {
+      return false;
+    }
+  }
+
+  if (!ArrayList_sort(list, compare_int)) {
+    return false;
+  }
+
+  if (ArrayList_size(list) != 5000 || !is_sorted_int(list)) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+bool test_ArrayList_sort_patterns() {
+  int elements[3000];
+
+  // Sort ascending, descending, constant and sawtooth inputs.
+  for (int pattern = 0; pattern < 4; pattern++) {
+    ArrayList* list = new_ArrayList();
+
+    if (list == NULL) {
+      return false;
+    }
+
+    for (int i = 0; i < 3000; i++) {
+      switch (pattern) {
+        case 0: elements[i] = i; break;
+        case 1: elements[i] = 3000 - i; break;
+        case 2: elements[i] = 7; break;
+        default: elements[i] = i % 13; break;
+      }
+      if (!ArrayList_add(list, &elements[i])) {
+        return false;
+      }
+    }
+
+    if (!ArrayList_sort(list, compare_int) || !is_sorted_int(list)) {
+      return false;
+    }
+
+    ArrayList_free(list);
+  }
+
+  return true;
+}
+
+bool test_ArrayList_sort_from_null() {
+  ArrayList* list = NULL;
+
+  if (ArrayList_sort(list, compare_int)) {
+    return false;
+  }
+
+  ArrayList* empty = new_ArrayList();
+
+  if (empty == NULL) {
+    return false;
+  }
+
+  if (ArrayList_sort(empty, NULL)) {
+    return false;
+  }
+
+  if (!ArrayList_sort(empty, compare_int)) {
+    return false;
+  }
+
+  ArrayList_free(empty);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_sortRange().
+ * 
+ * @return true if the test passes, false otherwise.
+*/
+bool test_ArrayList_sortRange() {
+  ArrayList* list = new_ArrayList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int elements[100];
+  for (int i = 0; i < 100; i++) {
+    elements[i] = 100 - i;
+    if (!ArrayList_add(list, &elements[i])) {
+      return false;
+    }
+  }
+
+  if (!ArrayList_sortRange(list, 10, 90, compare_int)) {
+    return false;
+  }
+
+  // The elements outside the range must not move.
+  for (int i = 0; i < 10; i++) {
+    if (ArrayList_get(list, i) != &elements[i] || ArrayList_get(list, 90 + i) != &elements[90 + i]) {
+      return false;
+    }
+  }
+
+  for (int i = 10; i < 90; i++) {
+    if (*(int*) ArrayList_get(list, i) != i + 1) {
+      return false;
+    }
+  }
+
+  if (ArrayList_sortRange(list, 50, 101, compare_int)) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_radixSortByKey().
+ * 
+ * @return true if the test passes, false otherwise.
+*/
+bool test_ArrayList_radixSortByKey() {
+  ArrayList* list = new_ArrayList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int elements[5000];
+  srand(6000);
+  for (int i = 0; i < 5000; i++) {
+    elements[i] = rand() % 1000000;
+    if (!ArrayList_add(list, &elements[i])) {
+      return false;
+    }
+  }
+
+  if (!ArrayList_radixSortByKey(list, key_int, 32)) {
+    return false;
+  }
+
+  if (ArrayList_size(list) != 5000 || !is_sorted_int(list)) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+bool test_ArrayList_radixSortByKey_stable() {
+  ArrayList* list = new_ArrayList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  // Equal keys must keep the order they were added in.
+  int elements[1000];
+  for (int i = 0; i < 1000; i++) {
+    elements[i] = (i * 7) % 10;
+    if (!ArrayList_add(list, &elements[i])) {
+      return false;
+    }
+  }
+
+  if (!ArrayList_radixSortByKey(list, key_int, 8)) {
+    return false;
+  }
+
+  for (int i = 1; i < 1000; i++) {
+    int* previous = ArrayList_get(list, i - 1);
+    int* current = ArrayList_get(list, i);
+    if (*previous > *current || (*previous == *current && previous > current)) {
+      return false;
+    }
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+bool test_ArrayList_radixSortByKey_invalid() {
+  ArrayList* list = NULL;
+
+  if (ArrayList_radixSortByKey(list, key_int, 32)) {
+    return false;
+  }
+
+  ArrayList* empty = new_ArrayList();
+
+  if (empty == NULL) {
+    return false;
+  }
+
+  if (ArrayList_radixSortByKey(empty, key_int, 0) || ArrayList_radixSortByKey(empty, key_int, 65)) {
+    return false;
+  }
+
+  if (ArrayList_radixSortByKey(empty, NULL, 32)) {
+    return false;
+  }
+
+  ArrayList_free(empty);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_lowerBound() and ArrayList_upperBound().
+ * 
+ * @return true if the test passes, false otherwise.
+*/
+bool test_ArrayList_bounds() {
+  ArrayList* list = new_ArrayList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int elements[6] = { 1, 3, 3, 3, 5, 7 };
+  for (int i = 0; i < 6; i++) {
+    if (!ArrayList_add(list, &elements[i])) {
+      return false;
+    }
+  }
+
+  int three = 3;
+  int four = 4;
+  int eight = 8;
+
+  if (ArrayList_lowerBound(list, &three, compare_int) != 1 || ArrayList_upperBound(list, &three, compare_int) != 4) {
+    return false;
+  }
+
+  if (ArrayList_lowerBound(list, &four, compare_int) != 4 || ArrayList_upperBound(list, &four, compare_int) != 4) {
+    return false;
+  }
+
+  if (ArrayList_lowerBound(list, &eight, compare_int) != 6) {
+    return false;
+  }
+
+  if (ArrayList_lowerBound(NULL, &three, compare_int) != ARRAY_LIST_NPOS || ArrayList_upperBound(list, &three, NULL) != ARRAY_LIST_NPOS) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_binarySearch().
+ * 
+ * @return true if the test passes, false otherwise.
+*/
+bool test_ArrayList_binarySearch() {
+  ArrayList* list = new_ArrayList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int elements[1000];
+  for (int i = 0; i < 1000; i++) {
+    elements[i] = i * 2;
+    if (!ArrayList_add(list, &elements[i])) {
+      return false;
+    }
+  }
+
+  for (int i = 0; i < 1000; i++) {
+    int even = i * 2;
+    int odd = i * 2 + 1;
+    if (ArrayList_binarySearch(list, &even, compare_int) != (size_t) i) {
+      return false;
+    }
+    if (ArrayList_binarySearch(list, &odd, compare_int) != ARRAY_LIST_NPOS) {
+      return false;
+    }
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+bool test_ArrayList_binarySearch_from_empty() {
+  ArrayList* list = new_ArrayList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int element = 1;
+
+  if (ArrayList_binarySearch(list, &element, compare_int) != ARRAY_LIST_NPOS) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_insertSorted().
+ * 
+ * @return true if the test passes, false otherwise.
+*/
+bool test_ArrayList_insertSorted() {
+  ArrayList* list = new_ArrayList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int elements[500];
+  srand(7000);
+  for (int i = 0; i < 500; i++) {
+    elements[i] = rand() % 100;
+    if (!ArrayList_insertSorted(list, &elements[i], compare_int)) {
+      return false;
+    }
+  }
+
+  if (ArrayList_size(list) != 500 || !is_sorted_int(list)) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_mergeSorted().
+ * 
+ * @return true if the test passes, false otherwise.
+*/
+bool test_ArrayList_mergeSorted() {
+  ArrayList* list = new_ArrayList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int elements[100];
+  int batch[100];
+  void* items[100];
+  for (int i = 0; i < 100; i++) {
+    elements[i] = i * 3;
+    batch[i] = i * 2;
+    items[i] = &batch[i];
+    if (!ArrayList_add(list, &elements[i])) {
+      return false;
+    }
+  }
+
+  if (!ArrayList_mergeSorted(list, items, 100, compare_int)) {
+    return false;
+  }
+
+  if (ArrayList_size(list) != 200 || !is_sorted_int(list)) {
+    return false;
+  }
+
+  // Elements already in the list come before equal elements from the batch.
+  if (ArrayList_get(list, 0) != &elements[0] || ArrayList_get(list, 1) != &batch[0]) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_mergeSorted() into an empty array list.
+ * 
+ * @return true if the test passes, false otherwise.
+*/
+bool test_ArrayList_mergeSorted_into_empty() {
+  ArrayList* list = new_ArrayList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int batch[3] = { 1, 2, 3 };
+  void* items[3] = { &batch[0], &batch[1], &batch[2] };
+
+  if (!ArrayList_mergeSorted(list, items, 3, compare_int)) {
+    return false;
+  }
+
+  if (ArrayList_size(list) != 3 || ArrayList_get(list, 2) != &batch[2]) {
+    return false;
+  }
+
+  if (ArrayList_mergeSorted(NULL, items, 3, compare_int)) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * A small value type used to test array lists of values.
+*/
+typedef struct Point {
+  int x;
+  int y;
+} Point;
+
+/**
+ * Gives the x coordinate of a point as a key, for use as an
+ * ArrayList_KeyFunction.
+ * 
+ * @param const void* The point.
+ * @return The x coordinate as an unsigned key.
+*/
+uint64_t key_point_x(const void* data) {
+  return (uint64_t) ((const Point*) data)->x;
+}
+
+/**
+ * Test function for new_ArrayListOf().
+ * 
+ * @return true if the test passes, false otherwise.
+*/
+bool test_new_ArrayListOf() {
+  ArrayList* list = new_ArrayListOf(sizeof(Point));
+
+  if (list == NULL) {
+    return false;
+  }
+
+  if (ArrayList_size(list) != 0 || ArrayList_elementSize(list) != sizeof(Point)) {
+    return false;
+  }
+
+  if (new_ArrayListOf(0) != NULL) {
+    return false;
+  }
+
+  if (new_ArrayListOfWithCapacity(sizeof(Point), SIZE_MAX / sizeof(Point) + 1) != NULL) {
+    return false;
+  }
+
+  ArrayList* pointers = new_ArrayList();
+  if (ArrayList_elementSize(pointers) != 0 || ArrayList_elementSize(NULL) != ARRAY_LIST_NPOS) {
+    return false;
+  }
+
+  ArrayList_free(pointers);
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_add() and ArrayList_get() on an array list of
+ * values.
+ * 
+ * @return true if the test passes, false otherwise.
+*/
+bool test_ArrayList_add_values() {
+  ArrayList* list = new_ArrayListOf(sizeof(Point));
+
+  if (list == NULL) {
+    return false;
+  }
+
+  // Add enough values to grow the collection several times.
+  for (int i = 0; i < 1000; i++) {
+    Point point = { i, -i };
+    if (!ArrayList_add(list, &point)) {
+      return false;
+    }
+  }
+
+  if (ArrayList_size(list) != 1000) {
+    return false;
+  }
+
+  // The values are stored contiguously and were copied in.
+  Point* first = ArrayList_get(list, 0);
+  for (int i = 0; i < 1000; i++) {
+    Point* point = ArrayList_get(list, (size_t) i);
+    if (point != first + i || point->x != i || point->y != -i) {
+      return false;
+    }
+  }
+
+  if (ArrayList_add(list, NULL)) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for removing from and inserting into an array list of values.
+ * 
+ * @return true if the test passes, false otherwise.
+*/
+bool test_ArrayList_remove_values() {
+  ArrayList* list = new_ArrayListOf(sizeof(int));
+
+  if (list == NULL) {
+    return false;
+  }
+
+  for (int i = 0; i < 10; i++) {
+    if (!ArrayList_add(list, &i)) {
+      return false;
+    }
+  }
+
+  // [0 1 2 3 4 5 6 7 8 9] -> [1 2 3 4 5 6 7 8 9] -> [1 9 3 4 5 6 7 8]
+  // -> [1 9 6 7 8]
+  if (!ArrayList_remove(list, 0) || !ArrayList_swapRemove(list, 1) || !ArrayList_removeRange(list, 2, 5)) {
+    return false;
+  }
+
+  int a = 100;
+  int b = 200;
+  void* items[2] = { &a, &b };
+  if (!ArrayList_insertRange(list, 1, items, 2)) {
+    return false;
+  }
+
+  int expected[7] = { 1, 100, 200, 9, 6, 7, 8 };
+  if (ArrayList_size(list) != 7) {
+    return false;
+  }
+  for (size_t i = 0; i < 7; i++) {
+    if (*(int*) ArrayList_get(list, i) != expected[i]) {
+      return false;
+    }
+  }
+
+  void* missing[2] = { &a, NULL };
+  if (ArrayList_insertRange(list, 0, missing, 2) || ArrayList_size(list) != 7) {
+    return false;
+  }
+
+  if (!ArrayList_clear(list) || ArrayList_size(list) != 0 || !ArrayList_add(list, &a)) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for searching an array list of values, which compares the
+ * values rather than the pointers to them.
+ * 
+ * @return true if the test passes, false otherwise.
+*/
+bool test_ArrayList_indexOf_values() {
+  ArrayList* list = new_ArrayListOf(sizeof(Point));
+
+  if (list == NULL) {
+    return false;
+  }
+
+  for (int i = 0; i < 100; i++) {
+    Point point = { i % 10, 0 };
+    if (!ArrayList_add(list, &point)) {
+      return false;
+    }
+  }
+
+  Point needle = { 3, 0 };
+  Point missing = { 3, 1 };
+  if (ArrayList_indexOf(list, &needle) != 3 || ArrayList_lastIndexOf(list, &needle) != 93) {
+    return false;
+  }
+
+  if (ArrayList_count(list, &needle) != 10 || !ArrayList_contains(list, &needle)) {
+    return false;
+  }
+
+  if (ArrayList_indexOf(list, &missing) != ARRAY_LIST_NPOS || ArrayList_count(list, &missing) != 0) {
+    return false;
+  }
+
+  if (ArrayList_indexOf(list, NULL) != ARRAY_LIST_NPOS) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_sort() and ArrayList_sortRange() on an array
+ * list of values.
+ * 
+ * @return true if the test passes, false otherwise.
+*/
+bool test_ArrayList_sort_values() {
+  ArrayList* list = new_ArrayListOf(sizeof(int));
+
+  if (list == NULL) {
+    return false;
+  }
+
+  srand(9000);
+  for (int i = 0; i < 5000; i++) {
+    int element = rand() % 1000;
+    if (!ArrayList_add(list, &element)) {
+      return false;
+    }
+  }
+
+  // Sort the middle first, then the whole list.
+  if (!ArrayList_sortRange(list, 1000, 4000, compare_int)) {
+    return false;
+  }
+  for (size_t i = 1001; i < 4000; i++) {
+    if (*(int*) ArrayList_get(list, i - 1) > *(int*) ArrayList_get(list, i)) {
+      return false;
+    }
+  }
+
+  if (!ArrayList_sort(list, compare_int) || ArrayList_size(list) != 5000 || !is_sorted_int(list)) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_radixSortByKey() on an array list of values,
+ * which must keep equal keys in their original order.
+ * 
+ * @return true if the test passes, false otherwise.
+*/
+bool test_ArrayList_radixSortByKey_values() {
+  ArrayList* list = new_ArrayListOf(sizeof(Point));
+
+  if (list == NULL) {
+    return false;
+  }
+
+  srand(9100);
+  for (int i = 0; i < 3000; i++) {
+    Point point = { rand() % 300, i };
+    if (!ArrayList_add(list, &point)) {
+      return false;
+    }
+  }
+
+  if (!ArrayList_radixSortByKey(list, key_point_x, 16)) {
+    return false;
+  }
+
+  for (size_t i = 1; i < 3000; i++) {
+    Point* previous = ArrayList_get(list, i - 1);
+    Point* current = ArrayList_get(list, i);
+    if (previous->x > current->x || (previous->x == current->x && previous->y > current->y)) {
+      return false;
+    }
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for the sorted operations on an array list of values.
+ * 
+ * @return true if the test passes, false otherwise.
+*/
+bool test_ArrayList_sorted_values() {
+  ArrayList* list = new_ArrayListOf(sizeof(int));
+
+  if (list == NULL) {
+    return false;
+  }
+
+  srand(9200);
+  for (int i = 0; i < 500; i++) {
+    int element = (rand() % 250) * 2;
+    if (!ArrayList_insertSorted(list, &element, compare_int)) {
+      return false;
+    }
+  }
+
+  int batch[100];
+  void* items[100];
+  for (int i = 0; i < 100; i++) {
+    batch[i] = i * 2 + 1;
+    items[i] = &batch[i];
+  }
+
+  if (!ArrayList_mergeSorted(list, items, 100, compare_int)) {
+    return false;
+  }
+
+  if (ArrayList_size(list) != 600 || !is_sorted_int(list)) {
+    return false;
+  }
+
+  int odd = 51;
+  int absent = 1001;
+  size_t index = ArrayList_binarySearch(list, &odd, compare_int);
+  if (index == ARRAY_LIST_NPOS || *(int*) ArrayList_get(list, index) != 51) {
+    return false;
+  }
+
+  if (ArrayList_binarySearch(list, &absent, compare_int) != ARRAY_LIST_NPOS) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_init(), which keeps a small list entirely in
+ * the inline buffer of caller owned storage.
+ * 
+ * @return true if the test passes, false otherwise.
+*/
+bool test_ArrayList_init() {
+  ArrayList list;
+
+  if (!ArrayList_init(&list) || ArrayList_init(NULL)) {
+    return false;
+  }
+
+  int elements[100];
+  for (int i = 0; i < ARRAY_LIST_INLINE_CAPACITY; i++) {
+    if (!ArrayList_add(&list, &elements[i])) {
+      return false;
+    }
+  }
+
+  // Up to the inline capacity, the elements stay inside the list.
+  if (list.collection != list.inline_buffer.pointers || ArrayList_capacity(&list) != ARRAY_LIST_INLINE_CAPACITY) {
+    return false;
+  }
+
+  // Growing past it moves the elements to the heap.
+  for (int i = ARRAY_LIST_INLINE_CAPACITY; i < 100; i++) {
+    if (!ArrayList_add(&list, &elements[i])) {
+      return false;
+    }
+  }
+
+  if (list.collection == list.inline_buffer.pointers || ArrayList_size(&list) != 100) {
+    return false;
+  }
+
+  for (size_t i = 0; i < 100; i++) {
+    if (ArrayList_get(&list, i) != &elements[i]) {
+      return false;
+    }
+  }
+
+  // Clearing moves the list back into the inline buffer.
+  if (!ArrayList_clear(&list) || list.collection != list.inline_buffer.pointers) {
+    return false;
+  }
+
+  if (!ArrayList_add(&list, &elements[0]) || ArrayList_get(&list, 0) != &elements[0]) {
+    return false;
+  }
+
+  ArrayList_deinit(&list);
+  if (ArrayList_size(&list) != 0) {
+    return false;
+  }
+
+  // Freeing a list initialised in place only releases its collection.
+  for (int i = 0; i < 10; i++) {
+    ArrayList_add(&list, &elements[i]);
+  }
+  ArrayList_free(&list);
+  return ArrayList_size(&list) == 0;
+}
+
+/**
+ * Test function for ArrayList_initOf(), including values too large for the
+ * inline buffer.
+ * 
+ * @return true if the test passes, false otherwise.
+*/
+bool test_ArrayList_initOf() {
+  ArrayList list;
+
+  if (!ArrayList_initOf(&list, sizeof(int)) || ArrayList_initOf(&list, 0)) {
+    return false;
+  }
+
+  // The inline buffer holds more ints than pointers.
+  size_t inline_capacity = sizeof(list.inline_buffer) / sizeof(int);
+  if (ArrayList_capacity(&list) != inline_capacity) {
+    return false;
+  }
+
+  for (int i = 0; i < 50; i++) {
+    if (!ArrayList_add(&list, &i)) {
+      return false;
+    }
+  }
+  for (size_t i = 0; i < 50; i++) {
+    if (*(int*) ArrayList_get(&list, i) != (int) i) {
+      return false;
+    }
+  }
+
+  // Removing down to a few elements and shrinking moves them back inline.
+  if (!ArrayList_removeRange(&list, 3, 50) || !ArrayList_shrinkToFit(&list)) {
+    return false;
+  }
+  if (list.collection != list.inline_buffer.pointers || *(int*) ArrayList_get(&list, 2) != 2) {
+    return false;
+  }
+  ArrayList_deinit(&list);
+
+  // A value larger than the inline buffer goes straight to the heap.
+  typedef struct Large {
+    char bytes[sizeof(list.inline_buffer) + 1];
+  } Large;
+
+  if (!ArrayList_initOf(&list, sizeof(Large)) || ArrayList_capacity(&list) != 0) {
+    return false;
+  }
+
+  Large large;
+  memset(&large, 7, sizeof(large));
+  for (int i = 0; i < 10; i++) {
+    if (!ArrayList_add(&list, &large)) {
+      return false;
+    }
+  }
+
+  if (ArrayList_size(&list) != 10 || ((Large*) ArrayList_get(&list, 9))->bytes[sizeof(Large) - 1] != 7) {
+    return false;
+  }
+
+  if (!ArrayList_clear(&list) || !ArrayList_add(&list, &large)) {
+    return false;
+  }
+
+  ArrayList_deinit(&list);
+  return true;
+}
+
+/**
+ * Test function for new_ArrayList() starting out in the inline buffer.
+ * 
+ * @return true if the test passes, false otherwise.
+*/
+bool test_new_ArrayList_inline() {
+  ArrayList* list = new_ArrayList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  if (list->collection != list->inline_buffer.pointers || ArrayList_capacity(list) != ARRAY_LIST_INLINE_CAPACITY) {
+    return false;
+  }
+
+  if (!ArrayList_reserve(list, 100) || list->collection == list->inline_buffer.pointers) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_add() in incremental resize mode, which must
+ * never move more than ARRAY_LIST_INCREMENTAL_STEP elements in a single add.
+ * 
+ * @return true if the test passed, false otherwise.
+*/
+bool test_ArrayList_incremental_add() {
+  ArrayList* list = new_ArrayList();
+  if (list == NULL) {
+    return false;
+  }
+
+  if (!ArrayList_setIncrementalResize(list, true)) {
+    return false;
+  }
+
+  int data[5000];
+  bool resized = false;
+  for (int i = 0; i < 5000; i++) {
+    data[i] = i;
+    bool migrating = list->old_collection != NULL;
+    size_t migrated = list->migrated;
+    if (!ArrayList_add(list, &data[i])) {
+      return false;
+    }
+
+    // An add that carries on a resize moves at most a step's worth of elements.
+    if (migrating && list->old_collection != NULL && list->migrated - migrated > ARRAY_LIST_INCREMENTAL_STEP) {
+      return false;
+    }
+    if (list->old_collection != NULL) {
+      resized = true;
+      // Every element must be readable while the resize is in progress.
+      if (ArrayList_get(list, 0) != &data[0] || ArrayList_get(list, (size_t) i) != &data[i]) {
+        return false;
+      }
+    }
+  }
+
+  if (!resized || ArrayList_size(list) != 5000) {
+    return false;
+  }
+
+  for (size_t i = 0; i < 5000; i++) {
+    if (ArrayList_get(list, i) != &data[i]) {
+      return false;
+    }
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for an array list of values in incremental resize mode, and
+ * for the functions that finish the resize before using the collection.
+ * 
+ * @return true if the test passed, false otherwise.
+*/
+bool test_ArrayList_incremental_values() {
+  ArrayList* list = new_ArrayListOf(sizeof(int));
+  if (list == NULL) {
+    return false;
+  }
+
+  ArrayList_setIncrementalResize(list, true);
+
+  // Add until a resize has only just started.
+  int value = 0;
+  while (list->old_collection == NULL) {
+    ArrayList_add(list, &value);
+    value++;
+    if (value > 100000) {
+      return false;
+    }
+  }
+
+  // Elements still in the old collection can be read.
+  if (*(int*) ArrayList_get(list, list->migrate_end - 1) != (int) list->migrate_end - 1) {
+    return false;
+  }
+
+  // Searching finishes the resize first.
+  int needle = value - 1;
+  if (ArrayList_indexOf(list, &needle) != (size_t) value - 1 || list->old_collection != NULL) {
+    return false;
+  }
+
+  for (size_t i = 0; i < (size_t) value; i++) {
+    if (*(int*) ArrayList_get(list, i) != (int) i) {
+      return false;
+    }
+  }
+
+  // Clearing in the middle of a resize releases both collections.
+  while (list->old_collection == NULL) {
+    ArrayList_add(list, &value);
+  }
+  if (!ArrayList_clear(list) || list->old_collection != NULL || !ArrayList_isEmpty(list)) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_setIncrementalResize(), which finishes any
+ * resize in progress when the mode is turned off.
+ * 
+ * @return true if the test passed, false otherwise.
+*/
+bool test_ArrayList_setIncrementalResize() {
+  ArrayList* list = new_ArrayList();
+  if (list == NULL) {
+    return false;
+  }
+
+  if (ArrayList_setIncrementalResize(NULL, true) || list->incremental) {
+    return false;
+  }
+
+  ArrayList_setIncrementalResize(list, true);
+  int data = 0;
+  while (list->old_collection == NULL) {
+    ArrayList_add(list, &data);
+  }
+
+  if (!ArrayList_setIncrementalResize(list, false) || list->old_collection != NULL || list->incremental) {
+    return false;
+  }
+
+  // Without the mode, growing copies everything at once.
+  size_t size = list->size;
+  for (size_t i = 0; i < size * 2; i++) {
+    ArrayList_add(list, &data);
+    if (list->old_collection != NULL) {
+      return false;
+    }
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Checks that the given array list of int pointers holds the given values in
+ * order.
+ * 
+ * @param ArrayList* The array list to check.
+ * @param int*       The expected values.
+ * @param size_t     The number of expected values.
+ * @return true if the array list holds the values, false otherwise.
+*/
+bool holds_ints(ArrayList* list, int* expected, size_t count) {
+  if (ArrayList_size(list) != count) {
+    return false;
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    int* element = ArrayList_get(list, i);
+    if (element == NULL || *element != expected[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Test function for ArrayList_insert().
+ * 
+ * @return true if the test passed, false otherwise.
+*/
+bool test_ArrayList_insert() {
+  ArrayList* list = new_ArrayList();
+  if (list == NULL) {
+    return false;
+  }
+
+  int data[5] = { 0, 1, 2, 3, 4 };
+  // [] -> [2] -> [0 2] -> [0 2 4] -> [0 1 2 4] -> [0 1 2 3 4]
+  if (!ArrayList_insert(list, 0, &data[2]) || !ArrayList_insert(list, 0, &data[0]) || !ArrayList_insert(list, 2, &data[4])) {
+    return false;
+  }
+  if (!ArrayList_insert(list, 1, &data[1]) || !ArrayList_insert(list, 3, &data[3])) {
+    return false;
+  }
+
+  if (!holds_ints(list, data, 5) || list->cursor != 4) {
+    return false;
+  }
+
+  if (ArrayList_insert(list, 6, &data[0]) || ArrayList_insert(NULL, 0, &data[0])) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_insert() with many inserts at the cursor, which
+ * must grow the collection while keeping the gap at the cursor.
+ * 
+ * @return true if the test passed, false otherwise.
+*/
+bool test_ArrayList_insert_at_cursor() {
+  ArrayList* list = new_ArrayList();
+  if (list == NULL) {
+    return false;
+  }
+
+  int data[1000];
+  for (int i = 0; i < 1000; i++) {
+    data[i] = i;
+  }
+
+  // Add the first and last 100 values, then type the rest in between.
+  for (int i = 0; i < 100; i++) {
+    ArrayList_add(list, &data[i]);
+  }
+  for (int i = 900; i < 1000; i++) {
+    ArrayList_add(list, &data[i]);
+  }
+  for (int i = 100; i < 900; i++) {
+    if (!ArrayList_insert(list, (size_t) i, &data[i])) {
+      return false;
+    }
+    if (list->cursor != (size_t) i + 1) {
+      return false;
+    }
+  }
+
+  if (!holds_ints(list, data, 1000)) {
+    return false;
+  }
+
+  // Appending closes the gap.
+  int extra = 1000;
+  if (!ArrayList_add(list, &extra) || list->cursor != ARRAY_LIST_NPOS || ArrayList_get(list, 1000) != &extra) {
+    return false;
+  }
+  if (!ArrayList_remove(list, 1000) || !holds_ints(list, data, 1000)) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_moveCursor(), and for ArrayList_remove() while
+ * the gap buffer is open.
+ * 
+ * @return true if the test passed, false otherwise.
+*/
+bool test_ArrayList_moveCursor() {
+  ArrayList* list = new_ArrayList();
+  if (list == NULL) {
+    return false;
+  }
+
+  int data[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+  for (int i = 0; i < 10; i++) {
+    ArrayList_add(list, &data[i]);
+  }
+
+  if (!ArrayList_moveCursor(list, 6) || list->cursor != 6 || *(int*) ArrayList_get(list, 6) != 6) {
+    return false;
+  }
+
+  // Backspace twice at the cursor, then delete forwards once.
+  if (!ArrayList_remove(list, 5) || !ArrayList_remove(list, 4) || !ArrayList_remove(list, 4)) {
+    return false;
+  }
+  int expected[7] = { 0, 1, 2, 3, 7, 8, 9 };
+  if (!holds_ints(list, expected, 7) || list->cursor != 4) {
+    return false;
+  }
+
+  // Moving the cursor back and forth keeps the order.
+  if (!ArrayList_moveCursor(list, 0) || !ArrayList_moveCursor(list, 7) || !ArrayList_moveCursor(list, 2)) {
+    return false;
+  }
+  if (!holds_ints(list, expected, 7)) {
+    return false;
+  }
+
+  // Searching closes the gap.
+  if (ArrayList_indexOf(list, &data[8]) != 5 || list->cursor != ARRAY_LIST_NPOS) {
+    return false;
+  }
+
+  if (ArrayList_moveCursor(list, 8) || ArrayList_moveCursor(NULL, 0)) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_insert() on an array list of values, and for
+ * sorting it with the gap open.
+ * 
+ * @return true if the test passed, false otherwise.
+*/
+bool test_ArrayList_insert_values() {
+  ArrayList* list = new_ArrayListOf(sizeof(int));
+  if (list == NULL) {
+    return false;
+  }
+
+  // Insert 0 to 99 in an interleaved order: evens at the front, odds after.
+  for (int i = 0; i < 100; i += 2) {
+    ArrayList_insert(list, (size_t) i / 2, &i);
+  }
+  for (int i = 1; i < 100; i += 2) {
+    ArrayList_insert(list, ArrayList_size(list), &i);
+  }
+
+  if (*(int*) ArrayList_get(list, 49) != 98 || *(int*) ArrayList_get(list, 50) != 1) {
+    return false;
+  }
+
+  if (ArrayList_insert(list, 0, NULL)) {
+    return false;
+  }
+
+  if (!ArrayList_sort(list, compare_int) || list->cursor != ARRAY_LIST_NPOS) {
+    return false;
+  }
+  for (size_t i = 0; i < 100; i++) {
+    if (*(int*) ArrayList_get(list, i) != (int) i) {
+      return false;
+    }
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for growing an array list past ARRAY_LIST_MMAP_THRESHOLD,
+ * which maps the collection on Linux, and shrinking it back below.
+ * 
+ * @return true if the test passed, false otherwise.
+*/
+bool test_ArrayList_large_collection() {
+  ArrayList* list = new_ArrayList();
+  if (list == NULL) {
+    return false;
+  }
+
+  size_t count = ARRAY_LIST_MMAP_THRESHOLD / sizeof(void*) * 3;
+  for (size_t i = 0; i < count; i++) {
+    if (!ArrayList_add(list, (void*) (i + 1))) {
+      return false;
+    }
+  }
+
+#if defined(__linux__) && !defined(ARRAY_LIST_NO_MMAP)
+  if (list->mapped < count * sizeof(void*) || list->mapped % ARRAY_LIST_HUGE_PAGE_SIZE != 0) {
+    return false;
+  }
+  if ((uintptr_t) list->collection % ARRAY_LIST_HUGE_PAGE_SIZE != 0) {
+    return false;
+  }
+
+  // Map a page just past the collection, so it cannot grow in place and has to
+  // be moved, which must keep it on a huge page boundary.
+  void* end = (unsigned char*) list->collection + list->mapped;
+  void* blocker = mmap(end, 4096, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+  if (blocker != MAP_FAILED && blocker != end) {
+    munmap(blocker, 4096);
+    blocker = MAP_FAILED;
+  }
+
+  if (!ArrayList_reserve(list, list->capacity * 2)) {
+    return false;
+  }
+  if ((uintptr_t) list->collection % ARRAY_LIST_HUGE_PAGE_SIZE != 0 || list->mapped % ARRAY_LIST_HUGE_PAGE_SIZE != 0) {
+    return false;
+  }
+  if (blocker != MAP_FAILED) {
+    munmap(blocker, 4096);
+  }
+#endif
+
+  for (size_t i = 0; i < count; i++) {
+    if (ArrayList_get(list, i) != (void*) (i + 1)) {
+      return false;
+    }
+  }
+
+  // Shrinking below the threshold moves the collection back to malloc().
+  if (!ArrayList_removeRange(list, 100, count) || !ArrayList_shrinkToFit(list) || list->mapped != 0) {
+    return false;
+  }
+  for (size_t i = 0; i < 100; i++) {
+    if (ArrayList_get(list, i) != (void*) (i + 1)) {
+      return false;
+    }
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_reserve() on an array list of values large
+ * enough to be mapped, in place and with incremental resizing.
+ * 
+ * @return true if the test passed, false otherwise.
+*/
+bool test_ArrayList_large_values() {
+  ArrayList list;
+  if (!ArrayList_initOf(&list, sizeof(Point))) {
+    return false;
+  }
+  ArrayList_setIncrementalResize(&list, true);
+
+  size_t count = ARRAY_LIST_MMAP_THRESHOLD / sizeof(Point) * 2;
+  if (!ArrayList_reserve(&list, count / 2)) {
+    return false;
+  }
+  for (size_t i = 0; i < count; i++) {
+    Point point = { (int) i, -(int) i };
+    if (!ArrayList_add(&list, &point)) {
+      return false;
+    }
+  }
+
+  for (size_t i = 0; i < count; i += 997) {
+    Point* point = ArrayList_get(&list, i);
+    if (point->x != (int) i || point->y != -(int) i) {
+      return false;
+    }
+  }
+
+  ArrayList_deinit(&list);
+  return list.mapped == 0 && list.old_collection == NULL;
+}
+
+/**
+ * The file used by the tests of ArrayList_mapFile().
+*/
+#define MAPPED_FILE_PATH "/tmp/array_list_test_mapped.bin"
+
+/**
+ * Test function for ArrayList_mapFile(), adding past the end of a new file
+ * and reading the values back after the file is mapped again.
+ * 
+ * @return true if the test passed, false otherwise.
+*/
+bool test_ArrayList_mapFile() {
+  remove(MAPPED_FILE_PATH);
+  ArrayList* list = ArrayList_mapFile(MAPPED_FILE_PATH, sizeof(Point), 0);
+#ifdef __linux__
+  if (list == NULL || list->fd < 0 || list->size != 0 || list->capacity != ARRAY_LIST_DEFAULT_CAPACITY) {
+    return false;
+  }
+
+  // Grow the file well past its first capacity, and edit it as a gap buffer.
+  for (int i = 0; i < 1000; i++) {
+    Point point = { i, -i };
+    if (!ArrayList_add(list, &point)) {
+      return false;
+    }
+  }
+  Point first = { -1, 1 };
+  if (!ArrayList_insert(list, 0, &first) || !ArrayList_remove(list, 1)) {
+    return false;
+  }
+  ArrayList_free(list);
+
+  list = ArrayList_mapFile(MAPPED_FILE_PATH, sizeof(Point), 0);
+  if (list == NULL || list->size != 1000) {
+    return false;
+  }
+  Point* point = ArrayList_get(list, 0);
+  if (point->x != -1 || point->y != 1) {
+    return false;
+  }
+  for (size_t i = 1; i < 1000; i++) {
+    point = ArrayList_get(list, i);
+    if (point->x != (int) i || point->y != -(int) i) {
+      return false;
+    }
+  }
+
+  // A file of other values is refused.
+  if (ArrayList_mapFile(MAPPED_FILE_PATH, sizeof(int), 0) != NULL) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  remove(MAPPED_FILE_PATH);
+  return ArrayList_mapFile(NULL, sizeof(Point), 0) == NULL && ArrayList_mapFile(MAPPED_FILE_PATH, 0, 0) == NULL;
+#else
+  return list == NULL;
+#endif
+}
+
+/**
+ * Test function for ArrayList_flush(), and for ArrayList_mapFile() with the
+ * read only and truncate flags.
+ * 
+ * @return true if the test passed, false otherwise.
+*/
+bool test_ArrayList_mapFile_flags() {
+#ifdef __linux__
+  remove(MAPPED_FILE_PATH);
+  ArrayList* list = ArrayList_mapFile(MAPPED_FILE_PATH, sizeof(int), 0);
+  if (list == NULL) {
+    return false;
+  }
+
+  for (int i = 0; i < 20; i++) {
+    ArrayList_add(list, &i);
+  }
+  if (!ArrayList_flush(list, true) || !ArrayList_flush(list, false)) {
+    return false;
+  }
+
+  // The flushed size is seen by a second mapping of the same file.
+  ArrayList* reader = ArrayList_mapFile(MAPPED_FILE_PATH, sizeof(int), ARRAY_LIST_MAP_READ_ONLY);
+  if (reader == NULL || reader->size != 20 || *(int*) ArrayList_get(reader, 19) != 19) {
+    return false;
+  }
+
+  // A read only list cannot grow or be flushed, and its changes stay private.
+  int value = 42;
+  while (reader->size < reader->capacity) {
+    ArrayList_add(reader, &value);
+  }
+  if (ArrayList_add(reader, &value) || ArrayList_flush(reader, true)) {
+    return false;
+  }
+  *(int*) ArrayList_get(reader, 0) = value;
+  if (*(int*) ArrayList_get(list, 0) != 0) {
+    return false;
+  }
+  ArrayList_free(reader);
+  ArrayList_free(list);
+
+  list = ArrayList_mapFile(MAPPED_FILE_PATH, sizeof(int), ARRAY_LIST_MAP_TRUNCATE);
+  if (list == NULL || list->size != 0 || !ArrayList_add(list, &value) || ArrayList_flush(NULL, true)) {
+    return false;
+  }
+  ArrayList_free(list);
+
+  if (ArrayList_mapFile(MAPPED_FILE_PATH, sizeof(int), ARRAY_LIST_MAP_READ_ONLY | ARRAY_LIST_MAP_TRUNCATE) != NULL) {
+    return false;
+  }
+
+  ArrayList* plain = new_ArrayListOf(sizeof(int));
+  if (plain == NULL || ArrayList_flush(plain, true)) {
+    return false;
+  }
+
+  ArrayList_free(plain);
+  remove(MAPPED_FILE_PATH);
+#endif
+  return true;
+}
+
+/**
+ * Test function for ArrayList_markRemoved() and ArrayList_compact(), marking
+ * scattered elements of an array list of values across several bitmap words.
+ * 
+ * @return true if the test passed, false otherwise.
+*/
+bool test_ArrayList_markRemoved() {
+  ArrayList* list = new_ArrayListOf(sizeof(int));
+  if (list == NULL) {
+    return false;
+  }
+
+  for (int i = 0; i < 300; i++) {
+    ArrayList_add(list, &i);
+  }
+
+  // Mark every multiple of 3; the indices of the others do not move.
+  for (size_t i = 0; i < 300; i += 3) {
+    if (!ArrayList_markRemoved(list, i)) {
+      return false;
+    }
+  }
+  if (ArrayList_size(list) != 300 || list->removed != 100) {
+    return false;
+  }
+  for (size_t i = 0; i < 300; i++) {
+    int* element = ArrayList_get(list, i);
+    if ((i % 3 == 0) != (element == NULL) || (i % 3 == 0) != ArrayList_isRemoved(list, i)) {
+      return false;
+    }
+    if (element != NULL && *element != (int) i) {
+      return false;
+    }
+  }
+
+  if (ArrayList_markRemoved(list, 0) || ArrayList_markRemoved(list, 300) || ArrayList_markRemoved(NULL, 1)) {
+    return false;
+  }
+
+  if (!ArrayList_compact(list) || ArrayList_size(list) != 200 || list->removed != 0 || list->tombstones != NULL) {
+    return false;
+  }
+  for (size_t i = 0; i < 200; i++) {
+    int* element = ArrayList_get(list, i);
+    if (element == NULL || *element != (int) (i / 2 * 3 + i % 2 + 1)) {
+      return false;
+    }
+  }
+
+  if (ArrayList_compact(NULL) || ArrayList_isRemoved(NULL, 0)) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for the functions that squeeze out the elements marked by
+ * ArrayList_markRemoved() before they work by position.
+ * 
+ * @return true if the test passed, false otherwise.
+*/
+bool test_ArrayList_markRemoved_positional() {
+  ArrayList* list = new_ArrayListOf(sizeof(int));
+  if (list == NULL) {
+    return false;
+  }
+
+  for (int i = 0; i < 10; i++) {
+    ArrayList_add(list, &i);
+  }
+
+  // Marks made while the gap buffer is open are squeezed out by remove().
+  int value = 100;
+  ArrayList_insert(list, 5, &value);
+  ArrayList_markRemoved(list, 1);
+  ArrayList_markRemoved(list, 8);
+  if (!ArrayList_remove(list, 0)) {
+    return false;
+  }
+  int expected[] = { 2, 3, 4, 100, 5, 6, 8, 9 };
+  if (!holds_ints(list, expected, 8)) {
+    return false;
+  }
+
+  // indexOf() gives the index after squeezing.
+  ArrayList_markRemoved(list, 0);
+  value = 5;
+  if (ArrayList_indexOf(list, &value) != 3 || list->removed != 0) {
+    return false;
+  }
+
+  // insert() at the size, which counts the marked element, appends.
+  ArrayList_markRemoved(list, 6);
+  if (ArrayList_insert(list, 8, &value) || !ArrayList_insert(list, 7, &value)) {
+    return false;
+  }
+  int inserted[] = { 3, 4, 100, 5, 6, 8, 5 };
+  if (!holds_ints(list, inserted, 7)) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_add() compacting a full array list that has
+ * enough of its elements marked removed, rather than growing it.
+ * 
+ * @return true if the test passed, false otherwise.
+*/
+bool test_ArrayList_markRemoved_add() {
+  ArrayList* list = new_ArrayListOfWithCapacity(sizeof(int), 64);
+  if (list == NULL) {
+    return false;
+  }
+
+  for (int i = 0; i < 64; i++) {
+    ArrayList_add(list, &i);
+  }
+
+  // A few marks are not enough, so the list grows and keeps them.
+  ArrayList_markRemoved(list, 10);
+  int value = 64;
+  if (!ArrayList_add(list, &value) || list->capacity != 128 || list->removed != 1) {
+    return false;
+  }
+
+  for (int i = 65; i < 128; i++) {
+    ArrayList_add(list, &i);
+  }
+  for (size_t i = 0; i < 128; i += 2) {
+    ArrayList_markRemoved(list, i);
+  }
+
+  // Half of the full list is marked, so adding squeezes it instead.
+  value = 128;
+  if (!ArrayList_add(list, &value) || list->capacity != 128 || ArrayList_size(list) != 65 || list->removed != 0) {
+    return false;
+  }
+  if (*(int*) ArrayList_get(list, 0) != 1 || *(int*) ArrayList_get(list, 4) != 9 || *(int*) ArrayList_get(list, 5) != 11) {
+    return false;
+  }
+  if (*(int*) ArrayList_get(list, 63) != 127 || *(int*) ArrayList_get(list, 64) != 128) {
+    return false;
+  }
+
+  // Clearing forgets the marks.
+  ArrayList_markRemoved(list, 3);
+  if (!ArrayList_clear(list) || list->removed != 0 || list->tombstones != NULL) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_sort() and ArrayList_sortRange() on an array
+ * list with elements marked removed, whose range counts the marked elements.
+ * 
+ * @return true if the test passed, false otherwise.
+*/
+bool test_ArrayList_markRemoved_sort() {
+  ArrayList* list = new_ArrayListOf(sizeof(int));
+  if (list == NULL) {
+    return false;
+  }
+
+  for (int i = 9; i >= 0; i--) {
+    ArrayList_add(list, &i);
+  }
+
+  ArrayList_markRemoved(list, 3);
+  if (!ArrayList_sort(list, compare_int)) {
+    return false;
+  }
+  int sorted[] = { 0, 1, 2, 3, 4, 5, 7, 8, 9 };
+  if (!holds_ints(list, sorted, 9) || list->removed != 0) {
+    return false;
+  }
+
+  // The range ends at the same element before and after the squeeze.
+  ArrayList_clear(list);
+  for (int i = 5; i >= 0; i--) {
+    ArrayList_add(list, &i);
+  }
+  ArrayList_markRemoved(list, 1);
+  if (!ArrayList_sortRange(list, 0, 4, compare_int)) {
+    return false;
+  }
+  int range[] = { 2, 3, 5, 1, 0 };
+  if (!holds_ints(list, range, 5)) {
+    return false;
+  }
+
+  // The radix sort squeezes the marked elements out as well.
+  ArrayList_markRemoved(list, 0);
+  if (!ArrayList_radixSortByKey(list, key_int, 32)) {
+    return false;
+  }
+  int radix[] = { 0, 1, 3, 5 };
+  if (!holds_ints(list, radix, 4)) {
+    return false;
+  }
+
+  ArrayList_markRemoved(list, 3);
+  if (ArrayList_sortRange(list, 0, 5, compare_int)) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_addAll() and ArrayList_insertRange() on an
+ * array list with elements marked removed.
+ * 
+ * @return true if the test passed, false otherwise.
+*/
+bool test_ArrayList_markRemoved_addAll() {
+  ArrayList* list = new_ArrayListOf(sizeof(int));
+  if (list == NULL) {
+    return false;
+  }
+
+  for (int i = 0; i < 10; i++) {
+    ArrayList_add(list, &i);
+  }
+
+  int values[] = { 10, 11, 20 };
+  void* items[] = { &values[0], &values[1] };
+  ArrayList_markRemoved(list, 2);
+  if (!ArrayList_addAll(list, items, 2)) {
+    return false;
+  }
+  int added[] = { 0, 1, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+  if (!holds_ints(list, added, 11)) {
+    return false;
+  }
+
+  // Inserting at an index goes before the element that was at it.
+  void* middle[] = { &values[2] };
+  ArrayList_markRemoved(list, 0);
+  if (!ArrayList_insertRange(list, 4, middle, 1)) {
+    return false;
+  }
+  int inserted[] = { 1, 3, 4, 20, 5, 6, 7, 8, 9, 10, 11 };
+  if (!holds_ints(list, inserted, 11)) {
+    return false;
+  }
+
+  // The size counts the marked elements, so one past it is out of bounds.
+  ArrayList_markRemoved(list, 10);
+  if (ArrayList_insertRange(list, 12, middle, 1) || !ArrayList_insertRange(list, 11, middle, 1)) {
+    return false;
+  }
+  if (ArrayList_size(list) != 11 || *(int*) ArrayList_get(list, 10) != 20) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_remove(), ArrayList_swapRemove() and
+ * ArrayList_removeRange() on an array list with elements marked removed.
+ * 
+ * @return true if the test passed, false otherwise.
+*/
+bool test_ArrayList_markRemoved_removeRange() {
+  ArrayList* list = new_ArrayListOf(sizeof(int));
+  if (list == NULL) {
+    return false;
+  }
+
+  for (int i = 0; i < 10; i++) {
+    ArrayList_add(list, &i);
+  }
+
+  ArrayList_markRemoved(list, 1);
+  ArrayList_markRemoved(list, 8);
+  if (!ArrayList_removeRange(list, 2, 5)) {
+    return false;
+  }
+  int range[] = { 0, 5, 6, 7, 9 };
+  if (!holds_ints(list, range, 5)) {
+    return false;
+  }
+
+  // The last index is still in bounds while the element before it is marked.
+  ArrayList_markRemoved(list, 3);
+  if (!ArrayList_swapRemove(list, 4)) {
+    return false;
+  }
+  int swapped[] = { 0, 5, 6 };
+  if (!holds_ints(list, swapped, 3)) {
+    return false;
+  }
+
+  // A marked element is already removed, and the next index is still the next
+  // element.
+  ArrayList_markRemoved(list, 1);
+  if (ArrayList_remove(list, 1) || ArrayList_swapRemove(list, 1) || list->removed != 1) {
+    return false;
+  }
+  if (!ArrayList_remove(list, 2) || ArrayList_size(list) != 1 || *(int*) ArrayList_get(list, 0) != 0) {
+    return false;
+  }
+
+  ArrayList_markRemoved(list, 0);
+  if (ArrayList_removeRange(list, 0, 2) || !ArrayList_removeRange(list, 0, 1) || ArrayList_size(list) != 0) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for the sorted array list functions on an array list with
+ * elements marked removed, which search the squeezed list.
+ * 
+ * @return true if the test passed, false otherwise.
+*/
+bool test_ArrayList_markRemoved_sorted() {
+  ArrayList* list = new_ArrayListOf(sizeof(int));
+  if (list == NULL) {
+    return false;
+  }
+
+  for (int i = 0; i < 20; i += 2) {
+    ArrayList_add(list, &i);
+  }
+
+  // The marked 4 is not found, and 6 is found at its squeezed index.
+  int value = 4;
+  ArrayList_markRemoved(list, 2);
+  if (ArrayList_binarySearch(list, &value, compare_int) != ARRAY_LIST_NPOS) {
+    return false;
+  }
+  value = 6;
+  ArrayList_markRemoved(list, 0);
+  if (ArrayList_lowerBound(list, &value, compare_int) != 1 || ArrayList_upperBound(list, &value, compare_int) != 2) {
+    return false;
+  }
+
+  value = 5;
+  ArrayList_markRemoved(list, 7);
+  if (!ArrayList_insertSorted(list, &value, compare_int)) {
+    return false;
+  }
+  int inserted[] = { 2, 5, 6, 8, 10, 12, 14, 16 };
+  if (!holds_ints(list, inserted, 8)) {
+    return false;
+  }
+
+  int values[] = { 1, 7, 20 };
+  void* items[] = { &values[0], &values[1], &values[2] };
+  ArrayList_markRemoved(list, 7);
+  ArrayList_markRemoved(list, 3);
+  if (!ArrayList_mergeSorted(list, items, 3, compare_int)) {
+    return false;
+  }
+  int merged[] = { 1, 2, 5, 6, 7, 10, 12, 14, 20 };
+  if (!holds_ints(list, merged, 9)) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Adds the integer an element points to onto the total the context points to.
+ * 
+ * @param void* The element.
+ * @param void* The total.
+*/
+void sum_int(void* element, void* context) {
+  *(long*) context += *(int*) element;
+}
+
+/**
+ * Checks if the integer an element points to is a multiple of the integer
+ * the context points to.
+ * 
+ * @param const void* The element.
+ * @param void*       The divisor.
+ * @return true if the element is a multiple of the divisor.
+*/
+bool is_multiple_int(const void* element, void* context) {
+  return *(const int*) element % *(int*) context == 0;
+}
+
+/**
+ * Multiplies the integer an element points to in place by the integer the
+ * context points to.
+ * 
+ * @param void* The element.
+ * @param void* The factor.
+ * @return The element.
+*/
+void* scale_int(void* element, void* context) {
+  *(int*) element *= *(int*) context;
+  return element;
+}
+
+/**
+ * Gives the address of the integer in the array the context points to that
+ * comes after the integer an element points to.
+ * 
+ * @param void* The element.
+ * @param void* The array.
+ * @return The address of the next integer in the array.
+*/
+void* next_int(void* element, void* context) {
+  return (int*) context + *(int*) element + 1;
+}
+
+/**
+ * Test function for ArrayList_forEach().
+ * 
+ * @return true if the test passed, false otherwise.
+*/
+bool test_ArrayList_forEach() {
+  ArrayList* list = new_ArrayList();
+  ArrayList* values = new_ArrayListOf(sizeof(int));
+  if (list == NULL || values == NULL) {
+    return false;
+  }
+
+  int data[100];
+  for (int i = 0; i < 100; i++) {
+    data[i] = i;
+    ArrayList_add(list, &data[i]);
+    ArrayList_add(values, &i);
+  }
+
+  long total = 0;
+  if (!ArrayList_forEach(list, sum_int, &total) || total != 4950) {
+    return false;
+  }
+
+  // Elements marked removed are skipped, and the gap buffer is no obstacle.
+  int value = 1000;
+  ArrayList_insert(values, 50, &value);
+  ArrayList_markRemoved(values, 0);
+  ArrayList_markRemoved(values, 99);
+  total = 0;
+  if (!ArrayList_forEach(values, sum_int, &total) || total != 4950 + 1000 - 98) {
+    return false;
+  }
+
+  if (ArrayList_forEach(NULL, sum_int, &total) || ArrayList_forEach(list, NULL, &total)) {
+    return false;
+  }
+
+  ArrayList_free(values);
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_retainIf().
+ * 
+ * @return true if the test passed, false otherwise.
+*/
+bool test_ArrayList_retainIf() {
+  ArrayList* list = new_ArrayList();
+  ArrayList* values = new_ArrayListOf(sizeof(int));
+  if (list == NULL || values == NULL) {
+    return false;
+  }
+
+  int data[100];
+  for (int i = 0; i < 100; i++) {
+    data[i] = i;
+    ArrayList_add(list, &data[i]);
+    ArrayList_add(values, &i);
+  }
+
+  int divisor = 3;
+  if (!ArrayList_retainIf(list, is_multiple_int, &divisor) || ArrayList_size(list) != 34) {
+    return false;
+  }
+  for (size_t i = 0; i < 34; i++) {
+    if (ArrayList_get(list, i) != &data[i * 3]) {
+      return false;
+    }
+  }
+
+  // The marked elements are dropped in the same pass.
+  ArrayList_markRemoved(values, 0);
+  ArrayList_markRemoved(values, 10);
+  divisor = 5;
+  if (!ArrayList_retainIf(values, is_multiple_int, &divisor) || values->removed != 0) {
+    return false;
+  }
+  int expected[] = { 5, 15, 20, 25, 30, 35, 40, 45, 50, 55, 60, 65, 70, 75, 80, 85, 90, 95 };
+  if (!holds_ints(values, expected, 18)) {
+    return false;
+  }
+
+  if (ArrayList_retainIf(NULL, is_multiple_int, &divisor) || ArrayList_retainIf(list, NULL, &divisor)) {
+    return false;
+  }
+
+  ArrayList_free(values);
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_map().
+ * 
+ * @return true if the test passed, false otherwise.
+*/
+bool test_ArrayList_map() {
+  ArrayList* list = new_ArrayList();
+  ArrayList* values = new_ArrayListOf(sizeof(int));
+  if (list == NULL || values == NULL) {
+    return false;
+  }
+
+  int data[11];
+  for (int i = 0; i < 10; i++) {
+    data[i] = i;
+    ArrayList_add(list, &data[i]);
+    ArrayList_add(values, &i);
+  }
+  data[10] = 10;
+
+  // A list of pointers stores the new pointers.
+  if (!ArrayList_map(list, next_int, data) || ArrayList_get(list, 0) != &data[1] || ArrayList_get(list, 9) != &data[10]) {
+    return false;
+  }
+
+  // A list of values has the new values copied over it.
+  if (!ArrayList_map(values, next_int, data) || *(int*) ArrayList_get(values, 0) != 1) {
+    return false;
+  }
+
+  // Or can be changed in place, skipping the marked elements.
+  int factor = 10;
+  ArrayList_markRemoved(values, 4);
+  if (!ArrayList_map(values, scale_int, &factor)) {
+    return false;
+  }
+  ArrayList_compact(values);
+  int expected[] = { 10, 20, 30, 40, 60, 70, 80, 90, 100 };
+  if (!holds_ints(values, expected, 9)) {
+    return false;
+  }
+
+  if (ArrayList_map(NULL, scale_int, &factor) || ArrayList_map(list, NULL, &factor)) {
+    return false;
+  }
+
+  ArrayList_free(values);
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_unique().
+ * 
+ * @return true if the test passed, false otherwise.
+*/
+bool test_ArrayList_unique() {
+  ArrayList* list = new_ArrayList();
+  ArrayList* values = new_ArrayListOf(sizeof(Point));
+  if (list == NULL || values == NULL) {
+    return false;
+  }
+
+  int data[10];
+  for (int i = 0; i < 1000; i++) {
+    ArrayList_add(list, &data[(i * 7) % 10]);
+    Point point = { i % 37, -(i % 37) };
+    ArrayList_add(values, &point);
+  }
+
+  if (!ArrayList_unique(list) || ArrayList_size(list) != 10) {
+    return false;
+  }
+  for (size_t i = 0; i < 10; i++) {
+    if (ArrayList_get(list, i) != &data[(i * 7) % 10]) {
+      return false;
+    }
+  }
+
+  if (!ArrayList_unique(values) || ArrayList_size(values) != 37) {
+    return false;
+  }
+  for (size_t i = 0; i < 37; i++) {
+    Point* point = ArrayList_get(values, i);
+    if (point->x != (int) i || point->y != -(int) i) {
+      return false;
+    }
+  }
+
+  if (ArrayList_unique(NULL)) {
+    return false;
+  }
+
+  ArrayList_free(values);
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_intersect() and ArrayList_difference().
+ * 
+ * @return true if the test passed, false otherwise.
+*/
+bool test_ArrayList_intersect() {
+  ArrayList* list = new_ArrayListOf(sizeof(int));
+  ArrayList* other = new_ArrayListOf(sizeof(int));
+  ArrayList* copy = new_ArrayListOf(sizeof(int));
+  ArrayList* pointers = new_ArrayList();
+  if (list == NULL || other == NULL || copy == NULL || pointers == NULL) {
+    return false;
+  }
+
+  for (int i = 0; i < 20; i++) {
+    ArrayList_add(list, &i);
+    ArrayList_add(copy, &i);
+    int multiple = i * 3;
+    ArrayList_add(other, &multiple);
+  }
+  int duplicate = 6;
+  ArrayList_add(list, &duplicate);
+
+  if (!ArrayList_intersect(list, other)) {
+    return false;
+  }
+  int common[] = { 0, 3, 6, 9, 12, 15, 18, 6 };
+  if (!holds_ints(list, common, 8)) {
+    return false;
+  }
+
+  if (!ArrayList_difference(copy, other)) {
+    return false;
+  }
+  int rest[] = { 1, 2, 4, 5, 7, 8, 10, 11, 13, 14, 16, 17, 19 };
+  if (!holds_ints(copy, rest, 13)) {
+    return false;
+  }
+
+  // A list intersected with itself is unchanged, and has no difference.
+  if (!ArrayList_intersect(copy, copy) || ArrayList_size(copy) != 13) {
+    return false;
+  }
+  if (!ArrayList_difference(copy, copy) || ArrayList_size(copy) != 0) {
+    return false;
+  }
+
+  if (ArrayList_intersect(list, pointers) || ArrayList_difference(NULL, other) || ArrayList_intersect(list, NULL)) {
+    return false;
+  }
+
+  ArrayList_free(pointers);
+  ArrayList_free(copy);
+  ArrayList_free(other);
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_union(), with lists large enough to need many
+ * probes of the hash table.
+ * 
+ * @return true if the test passed, false otherwise.
+*/
+bool test_ArrayList_union() {
+  ArrayList* list = new_ArrayList();
+  ArrayList* other = new_ArrayList();
+  if (list == NULL || other == NULL) {
+    return false;
+  }
+
+  static int data[30000];
+  for (int i = 0; i < 20000; i++) {
+    ArrayList_add(list, &data[i]);
+    ArrayList_add(other, &data[10000 + i / 2 * 2]);
+  }
+
+  if (!ArrayList_union(list, other) || ArrayList_size(list) != 25000) {
+    return false;
+  }
+  for (size_t i = 20000; i < 25000; i++) {
+    if (ArrayList_get(list, i) != &data[20000 + (i - 20000) * 2]) {
+      return false;
+    }
+  }
+
+  if (!ArrayList_union(list, list) || ArrayList_size(list) != 25000 || ArrayList_union(NULL, other)) {
+    return false;
+  }
+
+  ArrayList_free(other);
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_unique() and the set operations on array lists
+ * with elements marked removed, which take no part in them.
+ * 
+ * @return true if the test passed, false otherwise.
+*/
+bool test_ArrayList_markRemoved_setOperations() {
+  ArrayList* list = new_ArrayListOf(sizeof(int));
+  ArrayList* other = new_ArrayListOf(sizeof(int));
+  if (list == NULL || other == NULL) {
+    return false;
+  }
+
+  int values[] = { 1, 2, 2, 3, 1, 4 };
+  for (int i = 0; i < 6; i++) {
+    ArrayList_add(list, &values[i]);
+  }
+
+  // The first 2 is marked, so the second one is kept.
+  ArrayList_markRemoved(list, 1);
+  if (!ArrayList_unique(list)) {
+    return false;
+  }
+  int unique[] = { 1, 2, 3, 4 };
+  if (!holds_ints(list, unique, 4)) {
+    return false;
+  }
+
+  // A marked element of the other list is not in it.
+  for (int i = 2; i < 6; i++) {
+    ArrayList_add(other, &i);
+  }
+  ArrayList_markRemoved(other, 1);
+  ArrayList_markRemoved(list, 0);
+  if (!ArrayList_intersect(list, other)) {
+    return false;
+  }
+  int common[] = { 2, 4 };
+  if (!holds_ints(list, common, 2)) {
+    return false;
+  }
+
+  ArrayList_markRemoved(other, 0);
+  if (!ArrayList_union(list, other)) {
+    return false;
+  }
+  int joined[] = { 2, 4, 5 };
+  if (!holds_ints(list, joined, 3)) {
+    return false;
+  }
+
+  ArrayList_markRemoved(other, 1);
+  if (!ArrayList_difference(list, other)) {
+    return false;
+  }
+  int left[] = { 2, 5 };
+  if (!holds_ints(list, left, 2)) {
+    return false;
+  }
+
+  ArrayList_free(other);
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_setIndexed(), looking up the elements of an
+ * indexed array list as it is added to and edited.
+ * 
+ * @return true if the test passed, false otherwise.
+*/
+bool test_ArrayList_setIndexed() {
+  ArrayList* list = new_ArrayList();
+  if (list == NULL || !ArrayList_setIndexed(list, true)) {
+    return false;
+  }
+
+  // A small list is scanned rather than indexed.
+  static int data[2000];
+  for (int i = 0; i < ARRAY_LIST_INDEX_THRESHOLD - 1; i++) {
+    ArrayList_add(list, &data[i]);
+  }
+  if (ArrayList_indexOf(list, &data[10]) != 10 || list->index.slots != NULL) {
+    return false;
+  }
+
+  for (int i = ARRAY_LIST_INDEX_THRESHOLD - 1; i < 1000; i++) {
+    ArrayList_add(list, &data[i]);
+  }
+  if (ArrayList_indexOf(list, &data[500]) != 500 || list->index.slots == NULL) {
+    return false;
+  }
+
+  // Appending keeps the index, and a duplicate keeps its first index.
+  for (int i = 1000; i < 1200; i++) {
+    ArrayList_add(list, &data[i]);
+  }
+  ArrayList_add(list, &data[3]);
+  if (list->index.slots == NULL || ArrayList_indexOf(list, &data[1100]) != 1100 || ArrayList_indexOf(list, &data[3]) != 3) {
+    return false;
+  }
+  if (ArrayList_contains(list, &data[1500]) || !ArrayList_contains(list, &data[1199])) {
+    return false;
+  }
+
+  // Removing the last elements keeps the index as well.
+  for (int i = 0; i < 300; i++) {
+    ArrayList_remove(list, list->size - 1);
+  }
+  if (list->index.slots == NULL || list->index.count != 901 || ArrayList_contains(list, &data[950])) {
+    return false;
+  }
+  for (size_t i = 0; i < 901; i++) {
+    if (ArrayList_indexOf(list, &data[i]) != i) {
+      return false;
+    }
+  }
+
+  // Any other removal drops it, and the next lookup rebuilds it.
+  ArrayList_remove(list, 0);
+  if (list->index.slots != NULL || ArrayList_indexOf(list, &data[1]) != 0 || ArrayList_contains(list, &data[0])) {
+    return false;
+  }
+  ArrayList_insert(list, 0, &data[0]);
+  if (ArrayList_indexOf(list, &data[0]) != 0 || ArrayList_indexOf(list, &data[900]) != 900) {
+    return false;
+  }
+
+  if (!ArrayList_setIndexed(list, false) || list->index.slots != NULL || ArrayList_indexOf(list, &data[5]) != 5) {
+    return false;
+  }
+
+  if (ArrayList_setIndexed(NULL, true)) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Compares the addresses of two points by their x coordinates, in descending
+ * order.
+ * 
+ * @param const void* The first point.
+ * @param const void* The second point.
+ * @return A negative number if the first point has the larger x coordinate,
+ *         zero if they are equal and a positive number otherwise.
+*/
+int compare_point_descending(const void* a, const void* b) {
+  const Point* first = a;
+  const Point* second = b;
+  return (second->x > first->x) - (second->x < first->x);
+}
+
+/**
+ * Test function for ArrayList_setIndexed() on an array list of values, with
+ * the index dropped by edits that reorder the list.
+ * 
+ * @return true if the test passed, false otherwise.
+*/
+bool test_ArrayList_setIndexed_values() {
+  ArrayList* list = new_ArrayListOf(sizeof(Point));
+  if (list == NULL || !ArrayList_setIndexed(list, true)) {
+    return false;
+  }
+
+  for (int i = 0; i < 500; i++) {
+    Point point = { i, i * i };
+    ArrayList_add(list, &point);
+  }
+
+  Point found = { 321, 321 * 321 };
+  Point missing = { 321, 0 };
+  if (ArrayList_indexOf(list, &found) != 321 || ArrayList_contains(list, &missing) || ArrayList_indexOf(list, NULL) != ARRAY_LIST_NPOS) {
+    return false;
+  }
+
+  // Marking and compacting moves the elements, and so does sorting.
+  ArrayList_markRemoved(list, 0);
+  if (ArrayList_indexOf(list, &found) != 320) {
+    return false;
+  }
+  ArrayList_sort(list, compare_point_descending);
+  if (ArrayList_indexOf(list, &found) != 499 - 321) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Main function used to run the tests.
+*/
+int main() {
+  printf("Running unit tests for ArrayList.h...\n");
+
+  printf("\ttesting new_ArrayList()...............................%s\n", test_new_ArrayList() ? "PASS" : "FAIL");
+  
+  printf("\ttesting ArrayList_add()...............................%s\n", test_ArrayList_add() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_add() with multiple elements........%s\n", test_ArrayList_add_multiple() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_add() to NULL.......................%s\n", test_ArrayList_add_to_null() ? "PASS" : "FAIL");
+
+  printf("\ttesting ArrayList_remove()............................%s\n", test_ArrayList_remove() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_remove() with multiple elements.....%s\n", test_ArrayList_remove_multiple() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_remove() from NULL..................%s\n", test_ArrayList_remove_from_null() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_remove() using index too large......%s\n", test_ArrayList_remove_index_too_large() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_remove() using index too small......%s\n", test_ArrayList_remove_index_too_small() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_remove() from empty.................%s\n", test_ArrayList_remove_from_empty() ? "PASS" : "FAIL");
+
+  printf("\ttesting ArrayList_get()...............................%s\n", test_ArrayList_get() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_get() with multiple elements........%s\n", test_ArrayList_get_multiple() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_get() from NULL.....................%s\n", test_ArrayList_get_from_null() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_get() using index too large.........%s\n", test_ArrayList_get_index_too_large() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_get() using index too small.........%s\n", test_ArrayList_get_index_too_small() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_get() from empty....................%s\n", test_ArrayList_get_from_empty() ? "PASS" : "FAIL");
+
+  printf("\ttesting ArrayList_size()..............................%s\n", test_ArrayList_size() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_size() with multiple elements.......%s\n", test_ArrayList_size_with_multiple() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_size() from NULL....................%s\n", test_ArrayList_size_from_null() ? "PASS" : "FAIL");
+
+  printf("\ttesting ArrayList_isEmpty()...........................%s\n", test_ArrayList_isEmpty() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_isEmpty() with multiple elements....%s\n", test_ArrayList_isEmpty_with_multiple() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_isEmpty() from NULL.................%s\n", test_ArrayList_isEmpty_from_null() ? "PASS" : "FAIL");
+
+  printf("\ttesting ArrayList_contains()..........................%s\n", test_ArrayList_contains() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_contains() with multiple elements...%s\n", test_ArrayList_contains_with_multiple() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_contains() from NULL................%s\n", test_ArrayList_contains_from_null() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_contains() from empty...............%s\n", test_ArrayList_contains_from_empty() ? "PASS" : "FAIL");
+
+  printf("\ttesting ArrayList_indexOf()...........................%s\n", test_ArrayList_indexOf() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_indexOf() with multiple elements....%s\n", test_ArrayList_indexOf_with_multiple() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_indexOf() from NULL.................%s\n", test_ArrayList_indexOf_from_null() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_indexOf() from empty................%s\n", test_ArrayList_indexOf_from_empty() ? "PASS" : "FAIL");
+
+  printf("\ttesting ArrayList_clear().............................%s\n", test_ArrayList_clear() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_clear() with multiple elements......%s\n", test_ArrayList_clear_with_multiple() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_clear() from NULL...................%s\n", test_ArrayList_clear_from_null() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_clear() from empty..................%s\n", test_ArrayList_clear_from_empty() ? "PASS" : "FAIL");
+
+  printf("\ttesting new_ArrayListWithCapacity()...................%s\n", test_new_ArrayListWithCapacity() ? "PASS" : "FAIL");
+  printf("\ttesting new_ArrayListWithCapacity() negative..........%s\n", test_new_ArrayListWithCapacity_negative() ? "PASS" : "FAIL");
+
+  printf("\ttesting ArrayList_reserve()...........................%s\n", test_ArrayList_reserve() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_reserve() from NULL.................%s\n", test_ArrayList_reserve_from_null() ? "PASS" : "FAIL");
+
+  printf("\ttesting ArrayList_add() with geometric growth.........%s\n", test_ArrayList_add_growth() ? "PASS" : "FAIL");
+
+  printf("\ttesting ArrayList_shrinkToFit().......................%s\n", test_ArrayList_shrinkToFit() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_shrinkToFit() from empty............%s\n", test_ArrayList_shrinkToFit_from_empty() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_shrinkToFit() from NULL.............%s\n", test_ArrayList_shrinkToFit_from_null() ? "PASS" : "FAIL");
+
+  printf("\ttesting ArrayList_addAll()............................%s\n", test_ArrayList_addAll() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_addAll() to NULL....................%s\n", test_ArrayList_addAll_to_null() ? "PASS" : "FAIL");
+
+  printf("\ttesting ArrayList_insertRange().......................%s\n", test_ArrayList_insertRange() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_insertRange() index too large.......%s\n", test_ArrayList_insertRange_index_too_large() ? "PASS" : "FAIL");
+
+  printf("\ttesting ArrayList_removeRange().......................%s\n", test_ArrayList_removeRange() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_removeRange() using invalid range...%s\n", test_ArrayList_removeRange_invalid() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_removeRange() from NULL.............%s\n", test_ArrayList_removeRange_from_null() ? "PASS" : "FAIL");
+
+  printf("\ttesting ArrayList_remove() keeps capacity.............%s\n", test_ArrayList_remove_keeps_capacity() ? "PASS" : "FAIL");
+
+  printf("\ttesting ArrayList_swapRemove()........................%s\n", test_ArrayList_swapRemove() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_swapRemove() from NULL..............%s\n", test_ArrayList_swapRemove_from_null() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_swapRemove() from empty.............%s\n", test_ArrayList_swapRemove_from_empty() ? "PASS" : "FAIL");
+
+  printf("\ttesting ArrayList_indexOf() with many elements........%s\n", test_ArrayList_indexOf_large() ? "PASS" : "FAIL");
+
+  printf("\ttesting ArrayList_lastIndexOf().......................%s\n", test_ArrayList_lastIndexOf() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_lastIndexOf() from NULL.............%s\n", test_ArrayList_lastIndexOf_from_null() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_lastIndexOf() from empty............%s\n", test_ArrayList_lastIndexOf_from_empty() ? "PASS" : "FAIL");
+
+  printf("\ttesting ArrayList_count().............................%s\n", test_ArrayList_count() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_count() from NULL...................%s\n", test_ArrayList_count_from_null() ? "PASS" : "FAIL");
+
+  printf("\ttesting ArrayList_sort()..............................%s\n", test_ArrayList_sort() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_sort() with patterned input.........%s\n", test_ArrayList_sort_patterns() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_sort() from NULL....................%s\n", test_ArrayList_sort_from_null() ? "PASS" : "FAIL");
+
+  printf("\ttesting ArrayList_sortRange().........................%s\n", test_ArrayList_sortRange() ? "PASS" : "FAIL");
+
+  printf("\ttesting ArrayList_radixSortByKey()....................%s\n", test_ArrayList_radixSortByKey() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_radixSortByKey() is stable..........%s\n", test_ArrayList_radixSortByKey_stable() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_radixSortByKey() invalid args.......%s\n", test_ArrayList_radixSortByKey_invalid() ? "PASS" : "FAIL");
+
+  printf("\ttesting ArrayList_lowerBound() and upperBound().......%s\n", test_ArrayList_bounds() ? "PASS" : "FAIL");
+
+  printf("\ttesting ArrayList_binarySearch()......................%s\n", test_ArrayList_binarySearch() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_binarySearch() from empty...........%s\n", test_ArrayList_binarySearch_from_empty() ? "PASS" : "FAIL");
+
+  printf("\ttesting ArrayList_insertSorted()......................%s\n", test_ArrayList_insertSorted() ? "PASS" : "FAIL");
+
+  printf("\ttesting ArrayList_mergeSorted().......................%s\n", test_ArrayList_mergeSorted() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_mergeSorted() into empty............%s\n", test_ArrayList_mergeSorted_into_empty() ? "PASS" : "FAIL");
+
+  printf("\ttesting new_ArrayListOf().............................%s\n", test_new_ArrayListOf() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_add() with values...................%s\n", test_ArrayList_add_values() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_remove() with values................%s\n", test_ArrayList_remove_values() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_indexOf() with values...............%s\n", test_ArrayList_indexOf_values() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_sort() with values..................%s\n", test_ArrayList_sort_values() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_radixSortByKey() with values........%s\n", test_ArrayList_radixSortByKey_values() ? "PASS" : "FAIL");
+  printf("\ttesting sorted operations with values.................%s\n", test_ArrayList_sorted_values() ? "PASS" : "FAIL");
+
+  printf("\ttesting ArrayList_init()..............................%s\n", test_ArrayList_init() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_initOf()............................%s\n", test_ArrayList_initOf() ? "PASS" : "FAIL");
+  printf("\ttesting new_ArrayList() uses the inline buffer........%s\n", test_new_ArrayList_inline() ? "PASS" : "FAIL");
+
+  printf("\ttesting ArrayList_add() with incremental resize.......%s\n", test_ArrayList_incremental_add() ? "PASS" : "FAIL");
+  printf("\ttesting incremental resize with values................%s\n", test_ArrayList_incremental_values() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_setIncrementalResize()..............%s\n", test_ArrayList_setIncrementalResize() ? "PASS" : "FAIL");
+
+  printf("\ttesting ArrayList_insert()............................%s\n", test_ArrayList_insert() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_insert() at the cursor..............%s\n", test_ArrayList_insert_at_cursor() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_moveCursor()........................%s\n", test_ArrayList_moveCursor() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_insert() with values................%s\n", test_ArrayList_insert_values() ? "PASS" : "FAIL");
+
+  printf("\ttesting ArrayList growing past the mmap threshold.....%s\n", test_ArrayList_large_collection() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList of large values with reserve()......%s\n", test_ArrayList_large_values() ? "PASS" : "FAIL");
+
+  printf("\ttesting ArrayList_mapFile()...........................%s\n", test_ArrayList_mapFile() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_flush() and map flags...............%s\n", test_ArrayList_mapFile_flags() ? "PASS" : "FAIL");
+
+  printf("\ttesting ArrayList_markRemoved().......................%s\n", test_ArrayList_markRemoved() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_markRemoved() then by position......%s\n", test_ArrayList_markRemoved_positional() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_markRemoved() then add()............%s\n", test_ArrayList_markRemoved_add() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_sort() with marks...................%s\n", test_ArrayList_markRemoved_sort() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_addAll() with marks.................%s\n", test_ArrayList_markRemoved_addAll() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_removeRange() with marks............%s\n", test_ArrayList_markRemoved_removeRange() ? "PASS" : "FAIL");
+  printf("\ttesting sorted ArrayList functions with marks.........%s\n", test_ArrayList_markRemoved_sorted() ? "PASS" : "FAIL");
+
+  printf("\ttesting ArrayList_forEach()...........................%s\n", test_ArrayList_forEach() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_retainIf()..........................%s\n", test_ArrayList_retainIf() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_map()...............................%s\n", test_ArrayList_map() ? "PASS" : "FAIL");
+
+  printf("\ttesting ArrayList_unique()............................%s\n", test_ArrayList_unique() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_intersect() and difference()........%s\n", test_ArrayList_intersect() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_union().............................%s\n", test_ArrayList_union() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList set operations with marks...........%s\n", test_ArrayList_markRemoved_setOperations() ? "PASS" : "FAIL");
+
+  printf("\ttesting ArrayList_setIndexed()........................%s\n", test_ArrayList_setIndexed() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_setIndexed() with values............%s\n", test_ArrayList_setIndexed_values() ? "PASS" : "FAIL");
 
   printf("Unit tests complete.\n");
 }
\ No newline at end of file
@@ -309,7 +309,7 @@ bool test_ArrayQueue_size() {
   ArrayQueue_enqueue(queue, data);
 
   // Check the size.
-  int size = ArrayQueue_size(queue);
+  size_t size = ArrayQueue_size(queue);
   if (size != 1) {
     return false;
   }
@@ -335,7 +335,7 @@ bool test_ArrayQueue_size_multiple() {
   ArrayQueue_enqueue(queue, data2);
 
   // Check the size.
-  int size = ArrayQueue_size(queue);
+  size_t size = ArrayQueue_size(queue);
   if (size != 2) {
     return false;
   }
@@ -346,8 +346,8 @@ bool test_ArrayQueue_size_multiple() {
 
 bool test_ArrayQueue_size_from_null() {
   ArrayQueue* queue = NULL;
-  int size = ArrayQueue_size(queue);
-  if (size != -1) {
+  size_t size = ArrayQueue_size(queue);
+  if (size != ARRAY_QUEUE_NPOS) {
     return false;
   }
   return true;
@@ -359,7 +359,7 @@ bool test_ArrayQueue_size_from_empty() {
     return false;
   }
 
-  int size = ArrayQueue_size(queue);
+  size_t size = ArrayQueue_size(queue);
   if (size != 0) {
     return false;
   }
@@ -491,6 +491,114 @@ bool test_ArrayQueue_clear_from_empty() {
   return true;
 }
 
+/**
+ * Test function for ArrayQueue_enqueue() and ArrayQueue_dequeue() when the
+ * elements wrap around the end of the collection before it grows.
+ * 
+ * @return true if the test passed, false otherwise.
+*/
+bool test_ArrayQueue_wrap_around() {
+  ArrayQueue* queue = new_ArrayQueue();
+  if (queue == NULL) {
+    return false;
+  }
+
+  int data[1000];
+  size_t next_in = 0;
+  size_t next_out = 0;
+  for (int round = 0; round < 100; round++) {
+    for (int i = 0; i < 7; i++) {
+      data[next_in] = (int) next_in;
+      if (!ArrayQueue_enqueue(queue, &data[next_in++])) {
+        return false;
+      }
+    }
+    for (int i = 0; i < 5; i++) {
+      if (ArrayQueue_dequeue(queue) != &data[next_out++]) {
+        return false;
+      }
+    }
+  }
+
+  if (ArrayQueue_size(queue) != next_in - next_out || ArrayQueue_peek(queue) != &data[next_out]) {
+    return false;
+  }
+
+  while (!ArrayQueue_isEmpty(queue)) {
+    if (ArrayQueue_dequeue(queue) != &data[next_out++]) {
+      return false;
+    }
+  }
+
+  ArrayQueue_free(queue);
+  return true;
+}
+
+/**
+ * Test function for ArrayQueue_enqueue() and ArrayQueue_dequeue() in
+ * incremental resize mode, which must keep the order of the elements while
+ * they are moved across a few at a time.
+ * 
+ * @return true if the test passed, false otherwise.
+*/
+bool test_ArrayQueue_incremental() {
+  ArrayQueue* queue = new_ArrayQueue();
+  if (queue == NULL) {
+    return false;
+  }
+
+  if (!ArrayQueue_setIncrementalResize(queue, true) || ArrayQueue_setIncrementalResize(NULL, true)) {
+    return false;
+  }
+
+  int data[20000];
+  size_t next_in = 0;
+  size_t next_out = 0;
+  bool resized = false;
+  for (int round = 0; round < 2000; round++) {
+    for (int i = 0; i < 9; i++) {
+      size_t migrated = queue->migrated;
+      bool migrating = queue->old_collection != NULL;
+      if (!ArrayQueue_enqueue(queue, &data[next_in++])) {
+        return false;
+      }
+      // An enqueue that carries on a resize moves at most a step's worth.
+      if (migrating && queue->old_collection != NULL && queue->migrated - migrated > ARRAY_QUEUE_INCREMENTAL_STEP) {
+        return false;
+      }
+      resized = resized || queue->old_collection != NULL;
+    }
+    for (int i = 0; i < 4; i++) {
+      if (ArrayQueue_peek(queue) != &data[next_out] || ArrayQueue_dequeue(queue) != &data[next_out]) {
+        return false;
+      }
+      next_out++;
+    }
+  }
+
+  if (!resized || ArrayQueue_size(queue) != next_in - next_out) {
+    return false;
+  }
+
+  // Turning the mode off finishes the move.
+  if (!ArrayQueue_setIncrementalResize(queue, false) || queue->old_collection != NULL) {
+    return false;
+  }
+
+  while (!ArrayQueue_isEmpty(queue)) {
+    if (ArrayQueue_dequeue(queue) != &data[next_out++]) {
+      return false;
+    }
+  }
+
+  if (next_out != next_in) {
+    return false;
+  }
+
+  ArrayQueue_free(queue);
+  return true;
+}
+
 /**
  * Main function used to run the tests.
 */
@@ -527,5 +635,8 @@ int main() {
   printf("\ttesting ArrayQueue_clear() with NULL queue............%s\n", test_ArrayQueue_clear_from_null() ? "PASS" : "FAIL");
   printf("\ttesting ArrayQueue_clear() from empty queue...........%s\n", test_ArrayQueue_clear_from_empty() ? "PASS" : "FAIL");
 
+  printf("\ttesting ArrayQueue wrapping around the collection.....%s\n", test_ArrayQueue_wrap_around() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayQueue with incremental resize............%s\n", test_ArrayQueue_incremental() ? "PASS" : "FAIL");
+
   printf("Unit tests complete.\n");
 }
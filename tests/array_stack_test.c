@@ -380,7 +380,7 @@ bool test_ArrayStack_size_multiple() {
 
 bool test_ArrayStack_size_from_null() {
   ArrayStack* stack = NULL;
-  if (ArrayStack_size(stack) != -1) {
+  if (ArrayStack_size(stack) != ARRAY_STACK_NPOS) {
     return false;
   }
 
@@ -0,0 +1,393 @@
+/**
+ * @file doubly_linked_list_test.c
+ * @brief Test file for doubly_linked_list.c
+ * @author Jonathan E
+ * @date 17-10-2026
+ * 
+ * This file contains the test functions for doubly_linked_list.c.
+ * By running this file, you can test the functions of doubly_linked_list.c
+ * with the test cases outputted to the console.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+#include "../src/doubly_linked_list/doubly_linked_list.h"
+
+/**
+ * Checks that the links of a doubly linked list agree in both directions, and
+ * that it holds the given elements in order.
+ * 
+ * @param DoublyLinkedList* the doubly linked list to check.
+ * @param int**             the expected elements.
+ * @param size_t            the number of expected elements.
+ * @return true if the list holds exactly the expected elements.
+*/
+bool holds_elements(DoublyLinkedList* list, int** expected, size_t count) {
+  if (list->size != count) {
+    return false;
+  }
+
+  // Walk forwards, checking each node links back to the one before it.
+  DoublyList_Node* previous = NULL;
+  DoublyList_Node* node = DoublyLinkedList_first(list);
+  for (size_t i = 0; i < count; i++) {
+    if (node == NULL || node->prev != previous || node->data != expected[i]) {
+      return false;
+    }
+    previous = node;
+    node = node->next;
+  }
+  if (node != NULL || DoublyLinkedList_last(list) != previous) {
+    return false;
+  }
+
+  // Walk backwards from the tail.
+  node = DoublyLinkedList_last(list);
+  for (size_t i = count; i > 0; i--) {
+    if (node == NULL || node->data != expected[i - 1]) {
+      return false;
+    }
+    node = node->prev;
+  }
+  return node == NULL;
+}
+
+/**
+ * Test function for new_DoublyLinkedList().
+ * 
+ * @return true if test passed, false otherwise.
+*/
+bool test_new_DoublyLinkedList() {
+  DoublyLinkedList* list = new_DoublyLinkedList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  if (list->size != 0 || list->head != NULL || list->tail != NULL) {
+    return false;
+  }
+
+  DoublyLinkedList_free(list);
+  return true;
+}
+
+/**
+ * Test function for DoublyLinkedList_add() and DoublyLinkedList_addFirst().
+ * 
+ * @return true if test passed, false otherwise.
+*/
+bool test_DoublyLinkedList_add() {
+  DoublyLinkedList* list = new_DoublyLinkedList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int elements[] = { 0, 1, 2, 3 };
+  if (!DoublyLinkedList_add(list, &elements[2]) || !DoublyLinkedList_addFirst(list, &elements[1])) {
+    return false;
+  }
+  if (!DoublyLinkedList_add(list, &elements[3]) || !DoublyLinkedList_addFirst(list, &elements[0])) {
+    return false;
+  }
+
+  int* expected[] = { &elements[0], &elements[1], &elements[2], &elements[3] };
+  if (!holds_elements(list, expected, 4)) {
+    return false;
+  }
+
+  if (DoublyLinkedList_add(NULL, &elements[0]) || DoublyLinkedList_addFirst(NULL, &elements[0])) {
+    return false;
+  }
+
+  DoublyLinkedList_free(list);
+  return true;
+}
+
+/**
+ * Test function for DoublyLinkedList_insertBefore().
+ * 
+ * @return true if test passed, false otherwise.
+*/
+bool test_DoublyLinkedList_insertBefore() {
+  DoublyLinkedList* list = new_DoublyLinkedList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int elements[] = { 0, 1, 2, 3 };
+  DoublyLinkedList_add(list, &elements[3]);
+
+  // Insert before the head, then in the middle.
+  if (!DoublyLinkedList_insertBefore(list, list->head, &elements[0])) {
+    return false;
+  }
+  if (!DoublyLinkedList_insertBefore(list, list->tail, &elements[2])) {
+    return false;
+  }
+  if (!DoublyLinkedList_insertBefore(list, list->head->next, &elements[1])) {
+    return false;
+  }
+
+  int* expected[] = { &elements[0], &elements[1], &elements[2], &elements[3] };
+  if (!holds_elements(list, expected, 4)) {
+    return false;
+  }
+
+  if (DoublyLinkedList_insertBefore(list, NULL, &elements[0]) || DoublyLinkedList_insertBefore(NULL, list->head, &elements[0])) {
+    return false;
+  }
+
+  DoublyLinkedList_free(list);
+  return true;
+}
+
+/**
+ * Test function for DoublyLinkedList_removeFirst() and
+ * DoublyLinkedList_removeLast().
+ * 
+ * @return true if test passed, false otherwise.
+*/
+bool test_DoublyLinkedList_removeEnds() {
+  DoublyLinkedList* list = new_DoublyLinkedList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int elements[] = { 0, 1, 2, 3, 4 };
+  for (int i = 0; i < 5; i++) {
+    DoublyLinkedList_add(list, &elements[i]);
+  }
+
+  if (!DoublyLinkedList_removeLast(list) || !DoublyLinkedList_removeFirst(list) || !DoublyLinkedList_removeLast(list)) {
+    return false;
+  }
+
+  int* expected[] = { &elements[1], &elements[2] };
+  if (!holds_elements(list, expected, 2)) {
+    return false;
+  }
+
+  // Emptying the list from either end leaves no head or tail behind.
+  DoublyLinkedList_removeFirst(list);
+  DoublyLinkedList_removeLast(list);
+  if (list->head != NULL || list->tail != NULL || list->size != 0) {
+    return false;
+  }
+
+  if (DoublyLinkedList_removeFirst(list) || DoublyLinkedList_removeLast(list) || DoublyLinkedList_removeLast(NULL)) {
+    return false;
+  }
+
+  // The list can still be used after being emptied.
+  int* last[] = { &elements[4] };
+  DoublyLinkedList_add(list, &elements[4]);
+  if (!holds_elements(list, last, 1)) {
+    return false;
+  }
+
+  DoublyLinkedList_free(list);
+  return true;
+}
+
+/**
+ * Test function for DoublyLinkedList_removeNode(), unlinking nodes from the
+ * middle of a list as an LRU cache would.
+ * 
+ * @return true if test passed, false otherwise.
+*/
+bool test_DoublyLinkedList_removeNode() {
+  DoublyLinkedList* list = new_DoublyLinkedList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int elements[] = { 0, 1, 2, 3, 4 };
+  for (int i = 0; i < 5; i++) {
+    DoublyLinkedList_add(list, &elements[i]);
+  }
+
+  // Move the middle node to the front.
+  DoublyList_Node* node = list->head->next->next;
+  void* data = node->data;
+  if (!DoublyLinkedList_removeNode(list, node) || !DoublyLinkedList_addFirst(list, data)) {
+    return false;
+  }
+
+  int* expected[] = { &elements[2], &elements[0], &elements[1], &elements[3], &elements[4] };
+  if (!holds_elements(list, expected, 5)) {
+    return false;
+  }
+
+  // Remove the tail and the head by their nodes.
+  if (!DoublyLinkedList_removeNode(list, list->tail) || !DoublyLinkedList_removeNode(list, list->head)) {
+    return false;
+  }
+  if (!holds_elements(list, &expected[1], 3)) {
+    return false;
+  }
+
+  if (DoublyLinkedList_removeNode(list, NULL) || DoublyLinkedList_removeNode(NULL, list->head)) {
+    return false;
+  }
+
+  DoublyLinkedList_free(list);
+  return true;
+}
+
+/**
+ * Test function for DoublyLinkedList_remove() and DoublyLinkedList_get(),
+ * which walk from the nearer end.
+ * 
+ * @return true if test passed, false otherwise.
+*/
+bool test_DoublyLinkedList_get() {
+  DoublyLinkedList* list = new_DoublyLinkedList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int elements[11];
+  for (int i = 0; i < 11; i++) {
+    elements[i] = i;
+    DoublyLinkedList_add(list, &elements[i]);
+  }
+
+  for (size_t i = 0; i < 11; i++) {
+    if (DoublyLinkedList_get(list, i) != &elements[i]) {
+      return false;
+    }
+  }
+
+  if (!DoublyLinkedList_remove(list, 8) || !DoublyLinkedList_remove(list, 1) || !DoublyLinkedList_remove(list, 8)) {
+    return false;
+  }
+
+  int* expected[] = { &elements[0], &elements[2], &elements[3], &elements[4], &elements[5], &elements[6], &elements[7], &elements[9] };
+  if (!holds_elements(list, expected, 8)) {
+    return false;
+  }
+
+  if (DoublyLinkedList_get(list, 8) != NULL || DoublyLinkedList_remove(list, 8) || DoublyLinkedList_get(NULL, 0) != NULL) {
+    return false;
+  }
+
+  DoublyLinkedList_free(list);
+  return true;
+}
+
+/**
+ * Test function for DoublyLinkedList_contains() and
+ * DoublyLinkedList_indexOf().
+ * 
+ * @return true if test passed, false otherwise.
+*/
+bool test_DoublyLinkedList_indexOf() {
+  DoublyLinkedList* list = new_DoublyLinkedList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int elements[] = { 0, 1, 2 };
+  DoublyLinkedList_add(list, &elements[0]);
+  DoublyLinkedList_add(list, &elements[1]);
+
+  if (DoublyLinkedList_indexOf(list, &elements[1]) != 1 || DoublyLinkedList_indexOf(list, &elements[2]) != DOUBLY_LINKED_LIST_NPOS) {
+    return false;
+  }
+
+  if (!DoublyLinkedList_contains(list, &elements[0]) || DoublyLinkedList_contains(list, &elements[2]) || DoublyLinkedList_contains(NULL, &elements[0])) {
+    return false;
+  }
+
+  DoublyLinkedList_free(list);
+  return true;
+}
+
+/**
+ * Test function for DoublyLinkedList_clear().
+ * 
+ * @return true if test passed, false otherwise.
+*/
+bool test_DoublyLinkedList_clear() {
+  DoublyLinkedList* list = new_DoublyLinkedList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int elements[] = { 0, 1, 2 };
+  for (int i = 0; i < 3; i++) {
+    DoublyLinkedList_add(list, &elements[i]);
+  }
+
+  if (!DoublyLinkedList_clear(list) || list->head != NULL || list->tail != NULL || !DoublyLinkedList_isEmpty(list)) {
+    return false;
+  }
+
+  // The list can still be used after being cleared.
+  DoublyLinkedList_add(list, &elements[1]);
+  int* expected[] = { &elements[1] };
+  if (!holds_elements(list, expected, 1)) {
+    return false;
+  }
+
+  if (DoublyLinkedList_clear(NULL)) {
+    return false;
+  }
+
+  DoublyLinkedList_free(list);
+  return true;
+}
+
+/**
+ * Test function for the DoublyLinkedList functions given NULL.
+ * 
+ * @return true if test passed, false otherwise.
+*/
+bool test_DoublyLinkedList_null() {
+  if (DoublyLinkedList_size(NULL) != DOUBLY_LINKED_LIST_NPOS || !DoublyLinkedList_isEmpty(NULL)) {
+    return false;
+  }
+
+  if (DoublyLinkedList_first(NULL) != NULL || DoublyLinkedList_last(NULL) != NULL) {
+    return false;
+  }
+
+  if (DoublyLinkedList_indexOf(NULL, NULL) != DOUBLY_LINKED_LIST_NPOS || DoublyLinkedList_remove(NULL, 0)) {
+    return false;
+  }
+
+  DoublyLinkedList_free(NULL);
+  return true;
+}
+
+/**
+ * Main function used to run the tests.
+*/
+int main() {
+  printf("Running unit tests for DoublyLinkedList...\n");
+
+  printf("\ttesting new_DoublyLinkedList()............................%s\n", test_new_DoublyLinkedList() ? "PASS" : "FAIL");
+
+  printf("\ttesting DoublyLinkedList_add() and addFirst().............%s\n", test_DoublyLinkedList_add() ? "PASS" : "FAIL");
+  printf("\ttesting DoublyLinkedList_insertBefore()...................%s\n", test_DoublyLinkedList_insertBefore() ? "PASS" : "FAIL");
+
+  printf("\ttesting DoublyLinkedList_removeFirst() and removeLast()...%s\n", test_DoublyLinkedList_removeEnds() ? "PASS" : "FAIL");
+  printf("\ttesting DoublyLinkedList_removeNode().....................%s\n", test_DoublyLinkedList_removeNode() ? "PASS" : "FAIL");
+  printf("\ttesting DoublyLinkedList_get() and remove()...............%s\n", test_DoublyLinkedList_get() ? "PASS" : "FAIL");
+
+  printf("\ttesting DoublyLinkedList_indexOf()........................%s\n", test_DoublyLinkedList_indexOf() ? "PASS" : "FAIL");
+  printf("\ttesting DoublyLinkedList_clear()..........................%s\n", test_DoublyLinkedList_clear() ? "PASS" : "FAIL");
+  printf("\ttesting DoublyLinkedList functions with NULL..............%s\n", test_DoublyLinkedList_null() ? "PASS" : "FAIL");
+
+  printf("Unit tests complete.\n");
+}
@@ -0,0 +1,268 @@
+/**
+ * @file int_compat_test.c
+ * @brief Test file for the int compatibility layer
+ * @author Jonathan E
+ * @date 17-10-2026
+ *
+ * This file contains the tests for the int wrappers in src/compat/int_compat.h.
+ * By running this file, you can test that the wrappers reject negative indices
+ * and return -1 in place of the NPOS values, with the test cases outputted to
+ * the console.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+#include "../src/compat/int_compat.h"
+
+/**
+ * Test function for IntCompat_toInt().
+ *
+ * @return true if the test passed, false otherwise.
+*/
+bool test_IntCompat_toInt() {
+  if (IntCompat_toInt(0) != 0 || IntCompat_toInt(42) != 42) {
+    return false;
+  }
+
+  if (IntCompat_toInt((size_t) INT_MAX) != INT_MAX) {
+    return false;
+  }
+
+  if (IntCompat_toInt((size_t) INT_MAX + 1) != -1) {
+    return false;
+  }
+
+  if (IntCompat_toInt(ARRAY_LIST_NPOS) != -1 || IntCompat_toInt(LINKED_LIST_NPOS) != -1) {
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * Test function for new_ArrayListWithCapacityInt().
+ *
+ * @return true if the test passed, false otherwise.
+*/
+bool test_new_ArrayListWithCapacityInt() {
+  if (new_ArrayListWithCapacityInt(-1) != NULL) {
+    return false;
+  }
+
+  ArrayList* list = new_ArrayListWithCapacityInt(16);
+  if (list == NULL) {
+    return false;
+  }
+
+  if (ArrayList_capacityInt(list) != 16 || ArrayList_sizeInt(list) != 0) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_getInt() and ArrayList_removeInt().
+ *
+ * @return true if the test passed, false otherwise.
+*/
+bool test_ArrayList_indexInt() {
+  ArrayList* list = new_ArrayList();
+  if (list == NULL) {
+    return false;
+  }
+
+  int values[] = { 10, 20, 30 };
+  for (int i = 0; i < 3; i++) {
+    ArrayList_add(list, &values[i]);
+  }
+
+  if (ArrayList_getInt(list, -1) != NULL || ArrayList_getInt(list, 3) != NULL) {
+    return false;
+  }
+
+  if (ArrayList_getInt(list, 1) != &values[1]) {
+    return false;
+  }
+
+  if (ArrayList_removeInt(list, -1) || ArrayList_removeInt(list, 3)) {
+    return false;
+  }
+
+  if (!ArrayList_removeInt(list, 0) || ArrayList_getInt(list, 0) != &values[1]) {
+    return false;
+  }
+
+  if (ArrayList_getInt(NULL, 0) != NULL || ArrayList_removeInt(NULL, 0)) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for the ArrayList size and search wrappers.
+ *
+ * @return true if the test passed, false otherwise.
+*/
+bool test_ArrayList_searchInt() {
+  ArrayList* list = new_ArrayList();
+  if (list == NULL) {
+    return false;
+  }
+
+  int values[] = { 10, 20 };
+  ArrayList_add(list, &values[0]);
+  ArrayList_add(list, &values[1]);
+  ArrayList_add(list, &values[0]);
+
+  if (ArrayList_sizeInt(list) != 3) {
+    return false;
+  }
+
+  if (ArrayList_indexOfInt(list, &values[0]) != 0 || ArrayList_lastIndexOfInt(list, &values[0]) != 2) {
+    return false;
+  }
+
+  if (ArrayList_countInt(list, &values[0]) != 2 || ArrayList_countInt(list, &values[1]) != 1) {
+    return false;
+  }
+
+  int missing = 0;
+  if (ArrayList_indexOfInt(list, &missing) != -1 || ArrayList_lastIndexOfInt(list, &missing) != -1) {
+    return false;
+  }
+
+  if (ArrayList_sizeInt(NULL) != -1 || ArrayList_capacityInt(NULL) != -1) {
+    return false;
+  }
+
+  if (ArrayList_indexOfInt(NULL, &values[0]) != -1 || ArrayList_lastIndexOfInt(NULL, &values[0]) != -1) {
+    return false;
+  }
+
+  if (ArrayList_countInt(NULL, &values[0]) != -1) {
+    return false;
+  }
+
+  ArrayList_free(list);
+  return true;
+}
+
+/**
+ * Test function for the LinkedList wrappers.
+ *
+ * @return true if the test passed, false otherwise.
+*/
+bool test_LinkedListInt() {
+  LinkedList* list = new_LinkedList();
+  if (list == NULL) {
+    return false;
+  }
+
+  int values[] = { 10, 20, 30 };
+  for (int i = 0; i < 3; i++) {
+    LinkedList_add(list, &values[i]);
+  }
+
+  if (LinkedList_sizeInt(list) != 3 || LinkedList_indexOfInt(list, &values[2]) != 2) {
+    return false;
+  }
+
+  int missing = 0;
+  if (LinkedList_indexOfInt(list, &missing) != -1) {
+    return false;
+  }
+
+  if (LinkedList_getInt(list, -1) != NULL || LinkedList_getInt(list, 3) != NULL) {
+    return false;
+  }
+
+  if (LinkedList_getInt(list, 1) != &values[1]) {
+    return false;
+  }
+
+  if (LinkedList_removeInt(list, -1) || LinkedList_removeInt(list, 3)) {
+    return false;
+  }
+
+  if (!LinkedList_removeInt(list, 1) || LinkedList_getInt(list, 1) != &values[2]) {
+    return false;
+  }
+
+  if (LinkedList_sizeInt(NULL) != -1 || LinkedList_indexOfInt(NULL, &values[0]) != -1) {
+    return false;
+  }
+
+  LinkedList_free(list);
+  return true;
+}
+
+/**
+ * Test function for the queue and stack size wrappers.
+ *
+ * @return true if the test passed, false otherwise.
+*/
+bool test_queueStackSizeInt() {
+  ArrayQueue* array_queue = new_ArrayQueue();
+  ArrayStack* array_stack = new_ArrayStack();
+  Queue* queue = new_Queue();
+  Stack* stack = new_Stack();
+  if (array_queue == NULL || array_stack == NULL || queue == NULL || stack == NULL) {
+    return false;
+  }
+
+  int value = 1;
+  ArrayQueue_enqueue(array_queue, &value);
+  ArrayStack_push(array_stack, &value);
+  ArrayStack_push(array_stack, &value);
+  Queue_enqueue(queue, &value);
+  Stack_push(stack, &value);
+  Stack_push(stack, &value);
+  Stack_push(stack, &value);
+
+  if (ArrayQueue_sizeInt(array_queue) != 1 || ArrayStack_sizeInt(array_stack) != 2) {
+    return false;
+  }
+
+  if (Queue_sizeInt(queue) != 1 || Stack_sizeInt(stack) != 3) {
+    return false;
+  }
+
+  if (ArrayQueue_sizeInt(NULL) != -1 || ArrayStack_sizeInt(NULL) != -1) {
+    return false;
+  }
+
+  if (Queue_sizeInt(NULL) != -1 || Stack_sizeInt(NULL) != -1) {
+    return false;
+  }
+
+  ArrayQueue_free(array_queue);
+  ArrayStack_free(array_stack);
+  Queue_free(queue);
+  Stack_free(stack);
+  return true;
+}
+
+/**
+ * Main function used to run the tests.
+*/
+int main() {
+  printf("Running unit tests for the int compatibility layer...\n");
+
+  printf("\ttesting IntCompat_toInt()..............................%s\n", test_IntCompat_toInt() ? "PASS" : "FAIL");
+
+  printf("\ttesting new_ArrayListWithCapacityInt().................%s\n", test_new_ArrayListWithCapacityInt() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList getInt() and removeInt().............%s\n", test_ArrayList_indexInt() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList size and search wrappers.............%s\n", test_ArrayList_searchInt() ? "PASS" : "FAIL");
+
+  printf("\ttesting LinkedList wrappers............................%s\n", test_LinkedListInt() ? "PASS" : "FAIL");
+
+  printf("\ttesting queue and stack size wrappers..................%s\n", test_queueStackSizeInt() ? "PASS" : "FAIL");
+
+  printf("Unit tests complete.\n");
+}
@@ -451,7 +451,7 @@ bool test_LinkedList_size_multiple() {
 bool test_LinkedList_size_from_null() {
   LinkedList* list = NULL;
 
-  if (LinkedList_size(list) != -1) {
+  if (LinkedList_size(list) != LINKED_LIST_NPOS) {
     return false;
   }
 
@@ -660,7 +660,7 @@ bool test_LinkedList_indexOf_multiple() {
 bool test_LinkedList_indexOf_from_null() {
   LinkedList* list = NULL;
 
-  if (LinkedList_indexOf(list, NULL) != -1) {
+  if (LinkedList_indexOf(list, NULL) != LINKED_LIST_NPOS) {
     return false;
   }
 
@@ -674,7 +674,7 @@ bool test_LinkedList_indexOf_from_empty() {
     return false;
   }
 
-  if (LinkedList_indexOf(list, NULL) != -1) {
+  if (LinkedList_indexOf(list, NULL) != LINKED_LIST_NPOS) {
     return false;
   }
 
@@ -759,6 +759,337 @@ bool test_LinkedList_clear_from_empty() {
   return true;
 }
 
+/**
+ * Test function for LinkedList_begin(), LinkedListCursor_next() and
+ * LinkedListCursor_get().
+ * 
+ * @return true if test passed, false otherwise.
+*/
+bool test_LinkedListCursor_next() {
+  LinkedList* list = new_LinkedList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int elements[100];
+  for (int i = 0; i < 100; i++) {
+    elements[i] = i;
+    LinkedList_add(list, &elements[i]);
+  }
+
+  LinkedListCursor cursor = LinkedList_begin(list);
+  int count = 0;
+  while (!LinkedListCursor_atEnd(&cursor)) {
+    if (LinkedListCursor_get(&cursor) != &elements[count]) {
+      return false;
+    }
+    LinkedListCursor_next(&cursor);
+    count++;
+  }
+
+  if (count != 100) {
+    return false;
+  }
+
+  if (LinkedListCursor_next(&cursor) || LinkedListCursor_get(&cursor) != NULL) {
+    return false;
+  }
+
+  LinkedList_free(list);
+  return true;
+}
+
+/**
+ * Test function for LinkedListCursor_insertAfter().
+ * 
+ * @return true if test passed, false otherwise.
+*/
+bool test_LinkedListCursor_insertAfter() {
+  LinkedList* list = new_LinkedList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int elements[] = { 0, 1, 2, 3, 4 };
+
+  // A cursor past the end of an empty list appends.
+  LinkedListCursor cursor = LinkedList_begin(list);
+  if (!LinkedListCursor_insertAfter(&cursor, &elements[0]) || !LinkedListCursor_insertAfter(&cursor, &elements[4])) {
+    return false;
+  }
+
+  // Insert in the middle, then after the tail.
+  cursor = LinkedList_begin(list);
+  if (!LinkedListCursor_insertAfter(&cursor, &elements[2]) || !LinkedListCursor_insertAfter(&cursor, &elements[1])) {
+    return false;
+  }
+  LinkedListCursor_next(&cursor);
+  LinkedListCursor_next(&cursor);
+  LinkedListCursor_next(&cursor);
+  if (!LinkedListCursor_insertAfter(&cursor, &elements[3])) {
+    return false;
+  }
+
+  int expected[] = { 0, 1, 2, 4, 3 };
+  if (list->size != 5 || list->tail->data != &elements[3]) {
+    return false;
+  }
+  for (size_t i = 0; i < 5; i++) {
+    if (*(int*)LinkedList_get(list, i) != expected[i]) {
+      return false;
+    }
+  }
+
+  // The tail was moved by the insert, so adding still goes on the end.
+  int element = 5;
+  LinkedList_add(list, &element);
+  if (*(int*)LinkedList_get(list, 5) != 5) {
+    return false;
+  }
+
+  if (LinkedListCursor_insertAfter(NULL, &element)) {
+    return false;
+  }
+
+  LinkedList_free(list);
+  return true;
+}
+
+/**
+ * Test function for LinkedListCursor_removeNext().
+ * 
+ * @return true if test passed, false otherwise.
+*/
+bool test_LinkedListCursor_removeNext() {
+  LinkedList* list = new_LinkedList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int elements[10];
+  for (int i = 0; i < 10; i++) {
+    elements[i] = i;
+    LinkedList_add(list, &elements[i]);
+  }
+
+  // Remove every odd element in a single pass.
+  LinkedListCursor cursor = LinkedList_begin(list);
+  while (!LinkedListCursor_atEnd(&cursor)) {
+    LinkedListCursor_removeNext(&cursor);
+    LinkedListCursor_next(&cursor);
+  }
+
+  if (list->size != 5 || list->tail->data != &elements[8]) {
+    return false;
+  }
+  for (size_t i = 0; i < 5; i++) {
+    if (LinkedList_get(list, i) != &elements[i * 2]) {
+      return false;
+    }
+  }
+
+  // The tail has nothing after it, and adding still goes after the new tail.
+  cursor = LinkedList_begin(list);
+  for (int i = 0; i < 4; i++) {
+    LinkedListCursor_next(&cursor);
+  }
+  if (LinkedListCursor_removeNext(&cursor) || LinkedListCursor_removeNext(NULL)) {
+    return false;
+  }
+  LinkedList_add(list, &elements[9]);
+  if (LinkedList_get(list, 5) != &elements[9]) {
+    return false;
+  }
+
+  LinkedList_free(list);
+  return true;
+}
+
+/**
+ * Test function for LinkedList_begin() from NULL and empty lists.
+ * 
+ * @return true if test passed, false otherwise.
+*/
+bool test_LinkedList_begin_from_empty() {
+  LinkedList* list = new_LinkedList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  LinkedListCursor cursor = LinkedList_begin(list);
+  if (!LinkedListCursor_atEnd(&cursor) || LinkedListCursor_removeNext(&cursor)) {
+    return false;
+  }
+
+  cursor = LinkedList_begin(NULL);
+  int element = 5;
+  if (!LinkedListCursor_atEnd(&cursor) || LinkedListCursor_insertAfter(&cursor, &element)) {
+    return false;
+  }
+
+  if (!LinkedListCursor_atEnd(NULL) || LinkedListCursor_next(NULL) || LinkedListCursor_get(NULL) != NULL) {
+    return false;
+  }
+
+  LinkedList_free(list);
+  return true;
+}
+
+/**
+ * Test function for LinkedList_remove() and LinkedList_clear() keeping the
+ * tail up to date, so later adds still go on the end.
+ * 
+ * @return true if test passed, false otherwise.
+*/
+bool test_LinkedList_remove_tail() {
+  LinkedList* list = new_LinkedList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int elements[] = { 0, 1, 2, 3 };
+  LinkedList_add(list, &elements[0]);
+  LinkedList_add(list, &elements[1]);
+  LinkedList_add(list, &elements[2]);
+
+  if (!LinkedList_remove(list, 2) || list->tail->data != &elements[1]) {
+    return false;
+  }
+
+  LinkedList_add(list, &elements[3]);
+  if (LinkedList_get(list, 2) != &elements[3] || list->size != 3) {
+    return false;
+  }
+
+  // Removing every node, or clearing the list, leaves no tail behind.
+  while (list->size > 0) {
+    LinkedList_remove(list, 0);
+  }
+  if (list->tail != NULL || !LinkedList_add(list, &elements[0]) || list->head != list->tail) {
+    return false;
+  }
+
+  LinkedList_clear(list);
+  if (list->tail != NULL || !LinkedList_add(list, &elements[2]) || LinkedList_get(list, 0) != &elements[2]) {
+    return false;
+  }
+
+  LinkedList_free(list);
+  return true;
+}
+
+/**
+ * Test function for LinkedList_insert().
+ * 
+ * @return true if test passed, false otherwise.
+*/
+bool test_LinkedList_insert() {
+  LinkedList* list = new_LinkedList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  // Insert at the end, the front and the middle.
+  int elements[] = { 0, 1, 2, 3 };
+  if (!LinkedList_insert(list, 0, &elements[3]) || !LinkedList_insert(list, 0, &elements[0])) {
+    return false;
+  }
+  if (!LinkedList_insert(list, 1, &elements[2]) || !LinkedList_insert(list, 1, &elements[1])) {
+    return false;
+  }
+
+  for (size_t i = 0; i < 4; i++) {
+    if (LinkedList_get(list, i) != &elements[i]) {
+      return false;
+    }
+  }
+  if (list->size != 4 || list->tail->data != &elements[3]) {
+    return false;
+  }
+
+  if (LinkedList_insert(list, 5, &elements[0]) || LinkedList_insert(NULL, 0, &elements[0])) {
+    return false;
+  }
+
+  LinkedList_free(list);
+  return true;
+}
+
+/**
+ * Test function for the finger, which must be moved by LinkedList_get() and
+ * kept correct by every change to the list.
+ * 
+ * @return true if test passed, false otherwise.
+*/
+bool test_LinkedList_finger() {
+  LinkedList* list = new_LinkedList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int elements[10];
+  for (int i = 0; i < 10; i++) {
+    elements[i] = i;
+    LinkedList_add(list, &elements[i]);
+  }
+
+  // Getting an index leaves the finger at it.
+  if (LinkedList_get(list, 6) != &elements[6] || list->finger_index != 6 || list->finger->data != &elements[6]) {
+    return false;
+  }
+
+  // Removing or inserting at the head moves the finger's index with it.
+  LinkedList_remove(list, 0);
+  if (list->finger_index != 5 || LinkedList_get(list, 5) != &elements[6]) {
+    return false;
+  }
+  LinkedList_insert(list, 0, &elements[0]);
+  if (list->finger_index != 6 || LinkedList_get(list, 7) != &elements[7]) {
+    return false;
+  }
+
+  // Removing the node at the finger, or before it, walks back to it.
+  LinkedList_remove(list, 7);
+  LinkedList_remove(list, 2);
+  if (LinkedList_get(list, 6) != &elements[8] || LinkedList_get(list, 1) != &elements[1]) {
+    return false;
+  }
+
+  // Removing the head while the finger is on it drops the finger.
+  LinkedList_get(list, 0);
+  LinkedList_remove(list, 0);
+  if (list->finger != NULL || LinkedList_get(list, 0) != &elements[1]) {
+    return false;
+  }
+
+  // Editing through a cursor elsewhere drops the finger too.
+  LinkedList_get(list, 4);
+  LinkedListCursor cursor = LinkedList_begin(list);
+  LinkedListCursor_insertAfter(&cursor, &elements[2]);
+  if (list->finger != NULL || LinkedList_get(list, 5) != &elements[6]) {
+    return false;
+  }
+  LinkedListCursor_removeNext(&cursor);
+  if (list->finger != NULL || LinkedList_get(list, 4) != &elements[6]) {
+    return false;
+  }
+
+  LinkedList_clear(list);
+  if (list->finger != NULL) {
+    return false;
+  }
+
+  LinkedList_free(list);
+  return true;
+}
+
 /**
  * Main function used to run the tests.
 */
@@ -808,5 +1139,15 @@ int main() {
   printf("\ttesting LinkedList_clear() from NULL...................%s\n", test_LinkedList_clear_from_null() ? "PASS" : "FAIL");
   printf("\ttesting LinkedList_clear() from empty..................%s\n", test_LinkedList_clear_from_empty() ? "PASS" : "FAIL");
 
+  printf("\ttesting LinkedListCursor_next()........................%s\n", test_LinkedListCursor_next() ? "PASS" : "FAIL");
+  printf("\ttesting LinkedListCursor_insertAfter().................%s\n", test_LinkedListCursor_insertAfter() ? "PASS" : "FAIL");
+  printf("\ttesting LinkedListCursor_removeNext()..................%s\n", test_LinkedListCursor_removeNext() ? "PASS" : "FAIL");
+  printf("\ttesting LinkedList_begin() from empty..................%s\n", test_LinkedList_begin_from_empty() ? "PASS" : "FAIL");
+
+  printf("\ttesting LinkedList_remove() of the tail................%s\n", test_LinkedList_remove_tail() ? "PASS" : "FAIL");
+
+  printf("\ttesting LinkedList_insert()............................%s\n", test_LinkedList_insert() ? "PASS" : "FAIL");
+  printf("\ttesting LinkedList finger after changes................%s\n", test_LinkedList_finger() ? "PASS" : "FAIL");
+
   printf("Unit tests complete.\n");
 }
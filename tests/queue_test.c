@@ -422,7 +422,7 @@ bool test_Queue_size_multiple() {
 bool test_Queue_size_from_null() {
   Queue* queue = NULL;
 
-  if (Queue_size(queue) != -1) {
+  if (Queue_size(queue) != QUEUE_NPOS) {
     return false;
   }
 
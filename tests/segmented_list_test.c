@@ -0,0 +1,395 @@
+/**
+ * @file segmented_list_test.c
+ * @brief Test file for segmented_list.c
+ * @author Jonathan E
+ * @date 17-10-2026
+ *
+ * This file contains the tests for the segmented_list.c file.
+ * By running this file, you can test the functions in segmented_list.c with
+ * the test cases outputted to the console.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+#include "../src/segmented_list/segmented_list.h"
+
+/**
+ * A small value type used to test segmented lists of values.
+*/
+typedef struct Point {
+  int x;
+  int y;
+} Point;
+
+/**
+ * Test function for new_SegmentedList().
+ *
+ * @return true if the test passed, false otherwise.
+*/
+bool test_new_SegmentedList() {
+  SegmentedList* list = new_SegmentedList();
+  if (list == NULL) {
+    return false;
+  }
+
+  if (list->size != 0 || list->segment_count != 0 || list->elem_size != 0) {
+    return false;
+  }
+
+  if (SegmentedList_capacity(list) != 0 || !SegmentedList_isEmpty(list)) {
+    return false;
+  }
+
+  SegmentedList_free(list);
+  return true;
+}
+
+/**
+ * Test function for new_SegmentedListOf().
+ *
+ * @return true if the test passed, false otherwise.
+*/
+bool test_new_SegmentedListOf() {
+  SegmentedList* list = new_SegmentedListOf(sizeof(Point));
+  if (list == NULL) {
+    return false;
+  }
+
+  if (list->elem_size != sizeof(Point) || list->size != 0) {
+    return false;
+  }
+
+  if (new_SegmentedListOf(0) != NULL) {
+    return false;
+  }
+
+  SegmentedList_free(list);
+  return true;
+}
+
+/**
+ * Test function for SegmentedList_add() and SegmentedList_get() across many
+ * segments.
+ *
+ * @return true if the test passed, false otherwise.
+*/
+bool test_SegmentedList_add() {
+  SegmentedList* list = new_SegmentedList();
+  if (list == NULL) {
+    return false;
+  }
+
+  int data[1000];
+  for (int i = 0; i < 1000; i++) {
+    data[i] = i;
+    if (!SegmentedList_add(list, &data[i])) {
+      return false;
+    }
+  }
+
+  if (SegmentedList_size(list) != 1000) {
+    return false;
+  }
+
+  for (size_t i = 0; i < 1000; i++) {
+    if (SegmentedList_get(list, i) != &data[i]) {
+      return false;
+    }
+  }
+
+  if (SegmentedList_get(list, 1000) != NULL) {
+    return false;
+  }
+
+  SegmentedList_free(list);
+  return true;
+}
+
+/**
+ * Test function for SegmentedList_capacity(), which grows one segment at a
+ * time, each twice the size of the one before.
+ *
+ * @return true if the test passed, false otherwise.
+*/
+bool test_SegmentedList_capacity() {
+  SegmentedList* list = new_SegmentedList();
+  if (list == NULL) {
+    return false;
+  }
+
+  size_t first = SEGMENTED_LIST_FIRST_SEGMENT_SIZE;
+  int data = 0;
+  for (size_t i = 0; i < first; i++) {
+    SegmentedList_add(list, &data);
+  }
+
+  if (SegmentedList_capacity(list) != first || list->segment_count != 1) {
+    return false;
+  }
+
+  SegmentedList_add(list, &data);
+  if (SegmentedList_capacity(list) != first * 3 || list->segment_count != 2) {
+    return false;
+  }
+
+  if (SegmentedList_capacity(NULL) != SEGMENTED_LIST_NPOS) {
+    return false;
+  }
+
+  SegmentedList_free(list);
+  return true;
+}
+
+/**
+ * Test function for the addresses of the values in a segmented list of
+ * values, which must not change as the list grows.
+ *
+ * @return true if the test passed, false otherwise.
+*/
+bool test_SegmentedList_stable_addresses() {
+  SegmentedList* list = new_SegmentedListOf(sizeof(Point));
+  if (list == NULL) {
+    return false;
+  }
+
+  Point* addresses[100];
+  for (int i = 0; i < 100; i++) {
+    Point point = { i, -i };
+    if (!SegmentedList_add(list, &point)) {
+      return false;
+    }
+    addresses[i] = SegmentedList_get(list, list->size - 1);
+  }
+
+  // Grow the list well past its current segments.
+  for (int i = 100; i < 10000; i++) {
+    Point point = { i, -i };
+    SegmentedList_add(list, &point);
+  }
+
+  for (size_t i = 0; i < 100; i++) {
+    if (SegmentedList_get(list, i) != addresses[i] || addresses[i]->x != (int) i || addresses[i]->y != -(int) i) {
+      return false;
+    }
+  }
+
+  SegmentedList_free(list);
+  return true;
+}
+
+/**
+ * Test function for SegmentedList_add() to a segmented list of values with no
+ * value, and to NULL.
+ *
+ * @return true if the test passed, false otherwise.
+*/
+bool test_SegmentedList_add_invalid() {
+  SegmentedList* list = new_SegmentedListOf(sizeof(int));
+  if (list == NULL) {
+    return false;
+  }
+
+  int data = 1;
+  if (SegmentedList_add(list, NULL) || SegmentedList_add(NULL, &data)) {
+    return false;
+  }
+
+  if (list->size != 0) {
+    return false;
+  }
+
+  SegmentedList_free(list);
+  return true;
+}
+
+/**
+ * Test function for SegmentedList_set().
+ *
+ * @return true if the test passed, false otherwise.
+*/
+bool test_SegmentedList_set() {
+  SegmentedList* list = new_SegmentedListOf(sizeof(int));
+  if (list == NULL) {
+    return false;
+  }
+
+  for (int i = 0; i < 50; i++) {
+    SegmentedList_add(list, &i);
+  }
+
+  int value = 42;
+  if (!SegmentedList_set(list, 30, &value) || *(int*) SegmentedList_get(list, 30) != 42) {
+    return false;
+  }
+
+  if (SegmentedList_set(list, 50, &value) || SegmentedList_set(list, 0, NULL) || SegmentedList_set(NULL, 0, &value)) {
+    return false;
+  }
+
+  SegmentedList_free(list);
+  return true;
+}
+
+/**
+ * Test function for SegmentedList_removeLast(), which frees a segment once the
+ * segment before it is empty as well.
+ *
+ * @return true if the test passed, false otherwise.
+*/
+bool test_SegmentedList_removeLast() {
+  SegmentedList* list = new_SegmentedListOf(sizeof(int));
+  if (list == NULL) {
+    return false;
+  }
+
+  // Fill the first three segments exactly.
+  size_t first = SEGMENTED_LIST_FIRST_SEGMENT_SIZE;
+  for (int i = 0; i < (int) (first * 7); i++) {
+    SegmentedList_add(list, &i);
+  }
+
+  if (list->segment_count != 3) {
+    return false;
+  }
+
+  // Emptying the third segment keeps it for the next add.
+  while (list->size > first * 3) {
+    SegmentedList_removeLast(list);
+  }
+  if (list->segment_count != 3) {
+    return false;
+  }
+
+  // Emptying the second segment as well frees the third.
+  while (list->size > first) {
+    SegmentedList_removeLast(list);
+  }
+  if (list->segment_count != 2 || *(int*) SegmentedList_get(list, first - 1) != (int) first - 1) {
+    return false;
+  }
+
+  while (SegmentedList_removeLast(list)) {
+  }
+  if (list->size != 0 || list->segment_count != 1 || SegmentedList_removeLast(NULL)) {
+    return false;
+  }
+
+  SegmentedList_free(list);
+  return true;
+}
+
+/**
+ * Test function for SegmentedList_indexOf() and SegmentedList_contains().
+ *
+ * @return true if the test passed, false otherwise.
+*/
+bool test_SegmentedList_indexOf() {
+  SegmentedList* list = new_SegmentedList();
+  SegmentedList* values = new_SegmentedListOf(sizeof(Point));
+  if (list == NULL || values == NULL) {
+    return false;
+  }
+
+  int data[200];
+  for (int i = 0; i < 200; i++) {
+    data[i] = i;
+    SegmentedList_add(list, &data[i]);
+    Point point = { i, i * 2 };
+    SegmentedList_add(values, &point);
+  }
+
+  if (SegmentedList_indexOf(list, &data[150]) != 150 || SegmentedList_contains(list, NULL)) {
+    return false;
+  }
+
+  Point found = { 120, 240 };
+  Point missing = { 120, 120 };
+  if (SegmentedList_indexOf(values, &found) != 120 || SegmentedList_contains(values, &missing)) {
+    return false;
+  }
+
+  if (SegmentedList_indexOf(values, NULL) != SEGMENTED_LIST_NPOS || SegmentedList_indexOf(NULL, &found) != SEGMENTED_LIST_NPOS) {
+    return false;
+  }
+
+  SegmentedList_free(values);
+  SegmentedList_free(list);
+  return true;
+}
+
+/**
+ * Test function for SegmentedList_clear().
+ *
+ * @return true if the test passed, false otherwise.
+*/
+bool test_SegmentedList_clear() {
+  SegmentedList* list = new_SegmentedListOf(sizeof(int));
+  if (list == NULL) {
+    return false;
+  }
+
+  for (int i = 0; i < 100; i++) {
+    SegmentedList_add(list, &i);
+  }
+
+  if (!SegmentedList_clear(list) || !SegmentedList_isEmpty(list) || SegmentedList_capacity(list) != 0) {
+    return false;
+  }
+
+  // The list can still be used after being cleared.
+  int value = 7;
+  if (!SegmentedList_add(list, &value) || *(int*) SegmentedList_get(list, 0) != 7) {
+    return false;
+  }
+
+  if (SegmentedList_clear(NULL)) {
+    return false;
+  }
+
+  SegmentedList_free(list);
+  return true;
+}
+
+/**
+ * Test function for the SegmentedList functions given NULL.
+ *
+ * @return true if the test passed, false otherwise.
+*/
+bool test_SegmentedList_null() {
+  if (SegmentedList_size(NULL) != SEGMENTED_LIST_NPOS || !SegmentedList_isEmpty(NULL)) {
+    return false;
+  }
+
+  if (SegmentedList_get(NULL, 0) != NULL) {
+    return false;
+  }
+
+  SegmentedList_free(NULL);
+  return true;
+}
+
+/**
+ * Main function used to run the tests.
+*/
+int main() {
+  printf("Running unit tests for SegmentedList...\n");
+
+  printf("\ttesting new_SegmentedList()......................%s\n", test_new_SegmentedList() ? "PASS" : "FAIL");
+  printf("\ttesting new_SegmentedListOf()....................%s\n", test_new_SegmentedListOf() ? "PASS" : "FAIL");
+
+  printf("\ttesting SegmentedList_add()......................%s\n", test_SegmentedList_add() ? "PASS" : "FAIL");
+  printf("\ttesting SegmentedList_capacity().................%s\n", test_SegmentedList_capacity() ? "PASS" : "FAIL");
+  printf("\ttesting SegmentedList addresses are stable.......%s\n", test_SegmentedList_stable_addresses() ? "PASS" : "FAIL");
+  printf("\ttesting SegmentedList_add() invalid args.........%s\n", test_SegmentedList_add_invalid() ? "PASS" : "FAIL");
+
+  printf("\ttesting SegmentedList_set()......................%s\n", test_SegmentedList_set() ? "PASS" : "FAIL");
+  printf("\ttesting SegmentedList_removeLast()...............%s\n", test_SegmentedList_removeLast() ? "PASS" : "FAIL");
+
+  printf("\ttesting SegmentedList_indexOf()..................%s\n", test_SegmentedList_indexOf() ? "PASS" : "FAIL");
+  printf("\ttesting SegmentedList_clear()....................%s\n", test_SegmentedList_clear() ? "PASS" : "FAIL");
+  printf("\ttesting SegmentedList functions with NULL........%s\n", test_SegmentedList_null() ? "PASS" : "FAIL");
+
+  printf("Unit tests complete.\n");
+}
@@ -0,0 +1,367 @@
+/**
+ * @file skip_list_test.c
+ * @brief Test file for skip_list.c
+ * @author Jonathan E
+ * @date 17-10-2026
+ * 
+ * This file contains the test functions for skip_list.c.
+ * By running this file, you can test the functions of skip_list.c
+ * with the test cases outputted to the console.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+#include "../src/skip_list/skip_list.h"
+
+/**
+ * Checks that a skip list holds the given elements in order, and that the span
+ * of every link on every level is the number of positions it moves forward.
+ * 
+ * @param SkipList* the skip list to check.
+ * @param int**     the expected elements.
+ * @param size_t    the number of expected elements.
+ * @return true if the list holds exactly the expected elements.
+*/
+bool holds_elements(SkipList* list, int** expected, size_t count) {
+  if (list->size != count || list->level < 1 || list->level > SKIP_LIST_MAX_LEVEL) {
+    return false;
+  }
+
+  // Number the nodes by walking the bottom level.
+  size_t position = 0;
+  for (SkipList_Node* node = list->head->links[0].next; node != NULL; node = node->links[0].next) {
+    if (position >= count || node->data != expected[position++]) {
+      return false;
+    }
+  }
+  if (position != count) {
+    return false;
+  }
+
+  // On each level, every link must land where its span says.
+  for (size_t i = 0; i < list->level; i++) {
+    SkipList_Node* node = list->head;
+    size_t rank = 0;
+    while (true) {
+      SkipList_Link link = node->links[i];
+      if (link.next == NULL) {
+        if (rank + link.span != count + 1) {
+          return false;
+        }
+        break;
+      }
+      if (link.next->level <= i || link.span == 0 || rank + link.span > count || link.next->data != expected[rank + link.span - 1]) {
+        return false;
+      }
+      rank += link.span;
+      node = link.next;
+    }
+  }
+  return true;
+}
+
+/**
+ * Test function for new_SkipList().
+ * 
+ * @return true if test passed, false otherwise.
+*/
+bool test_new_SkipList() {
+  SkipList* list = new_SkipList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  if (list->size != 0 || list->level != 1 || list->head == NULL || list->head->links[0].next != NULL) {
+    return false;
+  }
+
+  SkipList_free(list);
+  return true;
+}
+
+/**
+ * Test function for SkipList_add() and SkipList_get().
+ * 
+ * @return true if test passed, false otherwise.
+*/
+bool test_SkipList_add() {
+  SkipList* list = new_SkipList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int elements[1000];
+  int* expected[1000];
+  for (int i = 0; i < 1000; i++) {
+    elements[i] = i;
+    expected[i] = &elements[i];
+    if (!SkipList_add(list, &elements[i])) {
+      return false;
+    }
+  }
+
+  // A thousand nodes should have been spread over several levels.
+  if (!holds_elements(list, expected, 1000) || list->level < 3) {
+    return false;
+  }
+
+  for (size_t i = 0; i < 1000; i++) {
+    if (SkipList_get(list, i) != &elements[i]) {
+      return false;
+    }
+  }
+
+  if (SkipList_get(list, 1000) != NULL || SkipList_add(NULL, &elements[0])) {
+    return false;
+  }
+
+  SkipList_free(list);
+  return true;
+}
+
+/**
+ * Test function for SkipList_insert().
+ * 
+ * @return true if test passed, false otherwise.
+*/
+bool test_SkipList_insert() {
+  SkipList* list = new_SkipList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  // Insert at the front, the end and the middle.
+  int elements[] = { 0, 1, 2, 3, 4 };
+  if (!SkipList_insert(list, 0, &elements[3]) || !SkipList_insert(list, 0, &elements[0]) || !SkipList_insert(list, 2, &elements[4])) {
+    return false;
+  }
+  if (!SkipList_insert(list, 1, &elements[1]) || !SkipList_insert(list, 2, &elements[2])) {
+    return false;
+  }
+
+  int* expected[] = { &elements[0], &elements[1], &elements[2], &elements[3], &elements[4] };
+  if (!holds_elements(list, expected, 5)) {
+    return false;
+  }
+
+  if (SkipList_insert(list, 6, &elements[0]) || SkipList_insert(NULL, 0, &elements[0])) {
+    return false;
+  }
+
+  SkipList_free(list);
+  return true;
+}
+
+/**
+ * Test function for SkipList_remove().
+ * 
+ * @return true if test passed, false otherwise.
+*/
+bool test_SkipList_remove() {
+  SkipList* list = new_SkipList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int elements[500];
+  int* expected[500];
+  size_t count = 500;
+  for (int i = 0; i < 500; i++) {
+    elements[i] = i;
+    expected[i] = &elements[i];
+    SkipList_add(list, &elements[i]);
+  }
+
+  // Remove every other element from the front.
+  for (size_t index = 0; index < count; index++) {
+    if (!SkipList_remove(list, index)) {
+      return false;
+    }
+    for (size_t i = index; i + 1 < count; i++) {
+      expected[i] = expected[i + 1];
+    }
+    count--;
+  }
+  if (!holds_elements(list, expected, count)) {
+    return false;
+  }
+
+  // Emptying the list drops back to a single level.
+  while (SkipList_remove(list, list->size - 1)) {
+  }
+  if (list->size != 0 || list->level != 1 || list->head->links[0].next != NULL || list->head->links[0].span != 1) {
+    return false;
+  }
+
+  if (SkipList_remove(list, 0) || SkipList_remove(NULL, 0)) {
+    return false;
+  }
+
+  SkipList_free(list);
+  return true;
+}
+
+/**
+ * Test function for a long run of random inserts, removes and gets, checked
+ * against an array of the expected elements.
+ * 
+ * @return true if test passed, false otherwise.
+*/
+bool test_SkipList_random() {
+  SkipList* list = new_SkipList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int elements[2000];
+  int* expected[2000];
+  size_t count = 0;
+  srand(24);
+  for (int step = 0; step < 10000; step++) {
+    int choice = rand() % 6;
+    if (count < 2000 && (count == 0 || choice < 3)) {
+      size_t index = (size_t) rand() % (count + 1);
+      int* data = &elements[rand() % 2000];
+      if (!SkipList_insert(list, index, data)) {
+        return false;
+      }
+      for (size_t i = count; i > index; i--) {
+        expected[i] = expected[i - 1];
+      }
+      expected[index] = data;
+      count++;
+    } else if (choice < 5) {
+      size_t index = (size_t) rand() % count;
+      if (!SkipList_remove(list, index)) {
+        return false;
+      }
+      for (size_t i = index; i + 1 < count; i++) {
+        expected[i] = expected[i + 1];
+      }
+      count--;
+    } else {
+      size_t index = (size_t) rand() % count;
+      if (SkipList_get(list, index) != expected[index]) {
+        return false;
+      }
+    }
+  }
+
+  if (!holds_elements(list, expected, count)) {
+    return false;
+  }
+
+  SkipList_free(list);
+  return true;
+}
+
+/**
+ * Test function for SkipList_contains() and SkipList_indexOf().
+ * 
+ * @return true if test passed, false otherwise.
+*/
+bool test_SkipList_indexOf() {
+  SkipList* list = new_SkipList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int elements[101];
+  for (int i = 0; i < 100; i++) {
+    SkipList_add(list, &elements[i]);
+  }
+
+  if (SkipList_indexOf(list, &elements[70]) != 70 || SkipList_indexOf(list, &elements[100]) != SKIP_LIST_NPOS) {
+    return false;
+  }
+
+  if (!SkipList_contains(list, &elements[99]) || SkipList_contains(list, &elements[100]) || SkipList_contains(NULL, &elements[0])) {
+    return false;
+  }
+
+  SkipList_free(list);
+  return true;
+}
+
+/**
+ * Test function for SkipList_clear().
+ * 
+ * @return true if test passed, false otherwise.
+*/
+bool test_SkipList_clear() {
+  SkipList* list = new_SkipList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int elements[100];
+  for (int i = 0; i < 100; i++) {
+    SkipList_add(list, &elements[i]);
+  }
+
+  if (!SkipList_clear(list) || list->level != 1 || !SkipList_isEmpty(list)) {
+    return false;
+  }
+
+  // The list can still be used after being cleared.
+  int* expected[] = { &elements[1], &elements[2] };
+  SkipList_add(list, &elements[2]);
+  SkipList_insert(list, 0, &elements[1]);
+  if (!holds_elements(list, expected, 2)) {
+    return false;
+  }
+
+  if (SkipList_clear(NULL)) {
+    return false;
+  }
+
+  SkipList_free(list);
+  return true;
+}
+
+/**
+ * Test function for the SkipList functions given NULL.
+ * 
+ * @return true if test passed, false otherwise.
+*/
+bool test_SkipList_null() {
+  if (SkipList_size(NULL) != SKIP_LIST_NPOS || !SkipList_isEmpty(NULL)) {
+    return false;
+  }
+
+  if (SkipList_get(NULL, 0) != NULL || SkipList_indexOf(NULL, NULL) != SKIP_LIST_NPOS) {
+    return false;
+  }
+
+  SkipList_free(NULL);
+  return true;
+}
+
+/**
+ * Main function used to run the tests.
+*/
+int main() {
+  printf("Running unit tests for SkipList...\n");
+
+  printf("\ttesting new_SkipList()....................%s\n", test_new_SkipList() ? "PASS" : "FAIL");
+
+  printf("\ttesting SkipList_add() and get()..........%s\n", test_SkipList_add() ? "PASS" : "FAIL");
+  printf("\ttesting SkipList_insert().................%s\n", test_SkipList_insert() ? "PASS" : "FAIL");
+  printf("\ttesting SkipList_remove().................%s\n", test_SkipList_remove() ? "PASS" : "FAIL");
+  printf("\ttesting SkipList random operations........%s\n", test_SkipList_random() ? "PASS" : "FAIL");
+
+  printf("\ttesting SkipList_indexOf()................%s\n", test_SkipList_indexOf() ? "PASS" : "FAIL");
+  printf("\ttesting SkipList_clear()..................%s\n", test_SkipList_clear() ? "PASS" : "FAIL");
+  printf("\ttesting SkipList functions with NULL......%s\n", test_SkipList_null() ? "PASS" : "FAIL");
+
+  printf("Unit tests complete.\n");
+}
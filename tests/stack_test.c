@@ -365,7 +365,7 @@ bool test_Stack_size_multiple() {
 bool test_Stack_size_from_null() {
   Stack *stack = NULL;
 
-  if (Stack_size(stack) != -1) {
+  if (Stack_size(stack) != STACK_NPOS) {
     return false;
   }
 
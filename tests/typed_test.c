@@ -0,0 +1,375 @@
+/**
+ * @file typed_test.c
+ * @brief Test file for the type specialised data types
+ * @author Jonathan E
+ * @date 17-10-2026
+ *
+ * This file contains the tests for the macros in the src/typed directory.
+ * By running this file, you can test the generated data types with the test
+ * cases outputted to the console.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "../src/typed/typed_array_list.h"
+#include "../src/typed/typed_linked_list.h"
+#include "../src/typed/typed_queue.h"
+#include "../src/typed/typed_stack.h"
+
+/**
+ * A small value type used to test the generated data types with structs.
+*/
+typedef struct Point {
+  int x;
+  int y;
+} Point;
+
+/**
+ * Checks if two points are equal, for use as the equality of a generated
+ * data type.
+*/
+#define POINT_EQUALS(a, b) ((a).x == (b).x && (a).y == (b).y)
+
+CADTS_DEFINE_ARRAY_LIST(int32_t, i32)
+CADTS_DEFINE_ARRAY_LIST_WITH(Point, point, POINT_EQUALS)
+CADTS_DEFINE_STACK(int32_t, i32)
+CADTS_DEFINE_QUEUE(int32_t, i32)
+CADTS_DEFINE_LINKED_LIST(int32_t, i32)
+CADTS_DEFINE_LINKED_LIST_WITH(Point, point, POINT_EQUALS)
+
+/**
+ * Test function for new_ArrayList_i32().
+ *
+ * @return true if the test passed, false otherwise.
+*/
+bool test_new_ArrayList_i32() {
+  ArrayList_i32* list = new_ArrayList_i32();
+  if (list == NULL) {
+    return false;
+  }
+
+  if (ArrayList_i32_size(list) != 0 || !ArrayList_i32_isEmpty(list)) {
+    return false;
+  }
+
+  if (ArrayList_i32_size(NULL) != CADTS_NPOS) {
+    return false;
+  }
+
+  if (new_ArrayList_i32WithCapacity(SIZE_MAX) != NULL) {
+    return false;
+  }
+
+  ArrayList_i32_free(list);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_i32_add() and ArrayList_i32_get().
+ *
+ * @return true if the test passed, false otherwise.
+*/
+bool test_ArrayList_i32_add() {
+  ArrayList_i32* list = new_ArrayList_i32();
+  if (list == NULL) {
+    return false;
+  }
+
+  for (int32_t i = 0; i < 1000; i++) {
+    if (!ArrayList_i32_add(list, i * 3)) {
+      return false;
+    }
+  }
+
+  if (ArrayList_i32_size(list) != 1000) {
+    return false;
+  }
+
+  for (size_t i = 0; i < 1000; i++) {
+    int32_t* element = ArrayList_i32_get(list, i);
+    if (element == NULL || *element != (int32_t) i * 3) {
+      return false;
+    }
+  }
+
+  if (ArrayList_i32_get(list, 1000) != NULL || ArrayList_i32_add(NULL, 1)) {
+    return false;
+  }
+
+  ArrayList_i32_free(list);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_i32_insert(), ArrayList_i32_remove(),
+ * ArrayList_i32_swapRemove() and ArrayList_i32_set().
+ *
+ * @return true if the test passed, false otherwise.
+*/
+bool test_ArrayList_i32_modify() {
+  ArrayList_i32* list = new_ArrayList_i32();
+  if (list == NULL) {
+    return false;
+  }
+
+  for (int32_t i = 0; i < 5; i++) {
+    ArrayList_i32_add(list, i);
+  }
+
+  // [0 1 2 3 4] -> [9 0 1 2 3 4] -> [9 1 2 3 4] -> [9 4 2 3] -> [9 4 7 3]
+  if (!ArrayList_i32_insert(list, 0, 9) || !ArrayList_i32_remove(list, 1)) {
+    return false;
+  }
+  if (!ArrayList_i32_swapRemove(list, 1) || !ArrayList_i32_set(list, 2, 7)) {
+    return false;
+  }
+
+  int32_t expected[4] = { 9, 4, 7, 3 };
+  if (ArrayList_i32_size(list) != 4) {
+    return false;
+  }
+  for (size_t i = 0; i < 4; i++) {
+    if (*ArrayList_i32_get(list, i) != expected[i]) {
+      return false;
+    }
+  }
+
+  if (ArrayList_i32_insert(list, 5, 1) || ArrayList_i32_remove(list, 4) || ArrayList_i32_set(list, 4, 1)) {
+    return false;
+  }
+
+  if (!ArrayList_i32_clear(list) || !ArrayList_i32_isEmpty(list)) {
+    return false;
+  }
+
+  ArrayList_i32_free(list);
+  return true;
+}
+
+/**
+ * Test function for ArrayList_i32_indexOf() and ArrayList_point_indexOf(),
+ * which uses a custom equality.
+ *
+ * @return true if the test passed, false otherwise.
+*/
+bool test_ArrayList_indexOf_typed() {
+  ArrayList_i32* list = new_ArrayList_i32();
+  ArrayList_point* points = new_ArrayList_point();
+  if (list == NULL || points == NULL) {
+    return false;
+  }
+
+  for (int32_t i = 0; i < 100; i++) {
+    ArrayList_i32_add(list, i % 10);
+    ArrayList_point_add(points, (Point) { i, -i });
+  }
+
+  if (ArrayList_i32_indexOf(list, 7) != 7 || ArrayList_i32_indexOf(list, 10) != CADTS_NPOS) {
+    return false;
+  }
+
+  if (ArrayList_point_indexOf(points, (Point) { 42, -42 }) != 42) {
+    return false;
+  }
+
+  if (ArrayList_point_contains(points, (Point) { 42, 42 }) || !ArrayList_i32_contains(list, 0)) {
+    return false;
+  }
+
+  ArrayList_point_free(points);
+  ArrayList_i32_free(list);
+  return true;
+}
+
+/**
+ * Test function for Stack_i32_push(), Stack_i32_pop() and Stack_i32_peek().
+ *
+ * @return true if the test passed, false otherwise.
+*/
+bool test_Stack_i32() {
+  Stack_i32* stack = new_Stack_i32();
+  if (stack == NULL) {
+    return false;
+  }
+
+  if (Stack_i32_peek(stack) != NULL || Stack_i32_pop(stack, NULL)) {
+    return false;
+  }
+
+  for (int32_t i = 0; i < 1000; i++) {
+    if (!Stack_i32_push(stack, i)) {
+      return false;
+    }
+  }
+
+  if (Stack_i32_size(stack) != 1000 || *Stack_i32_peek(stack) != 999) {
+    return false;
+  }
+
+  for (int32_t i = 999; i >= 0; i--) {
+    int32_t value;
+    if (!Stack_i32_pop(stack, &value) || value != i) {
+      return false;
+    }
+  }
+
+  if (!Stack_i32_isEmpty(stack) || Stack_i32_size(NULL) != CADTS_NPOS) {
+    return false;
+  }
+
+  Stack_i32_free(stack);
+  return true;
+}
+
+/**
+ * Test function for Queue_i32_enqueue(), Queue_i32_dequeue() and
+ * Queue_i32_peek(), including when the ring buffer wraps around and grows.
+ *
+ * @return true if the test passed, false otherwise.
+*/
+bool test_Queue_i32() {
+  Queue_i32* queue = new_Queue_i32();
+  if (queue == NULL) {
+    return false;
+  }
+
+  if (Queue_i32_peek(queue) != NULL || Queue_i32_dequeue(queue, NULL)) {
+    return false;
+  }
+
+  // Interleave the operations so the elements wrap around the buffer before
+  // it grows.
+  int32_t next_in = 0;
+  int32_t next_out = 0;
+  for (int round = 0; round < 100; round++) {
+    for (int i = 0; i < 7; i++) {
+      if (!Queue_i32_enqueue(queue, next_in++)) {
+        return false;
+      }
+    }
+    for (int i = 0; i < 5; i++) {
+      int32_t value;
+      if (!Queue_i32_dequeue(queue, &value) || value != next_out++) {
+        return false;
+      }
+    }
+  }
+
+  if (Queue_i32_size(queue) != (size_t) (next_in - next_out) || *Queue_i32_peek(queue) != next_out) {
+    return false;
+  }
+
+  while (!Queue_i32_isEmpty(queue)) {
+    int32_t value;
+    if (!Queue_i32_dequeue(queue, &value) || value != next_out++) {
+      return false;
+    }
+  }
+
+  if (next_out != next_in || Queue_i32_size(NULL) != CADTS_NPOS) {
+    return false;
+  }
+
+  Queue_i32_free(queue);
+  return true;
+}
+
+/**
+ * Test function for LinkedList_i32_add(), LinkedList_i32_get() and
+ * LinkedList_i32_remove().
+ *
+ * @return true if the test passed, false otherwise.
+*/
+bool test_LinkedList_i32() {
+  LinkedList_i32* list = new_LinkedList_i32();
+  if (list == NULL) {
+    return false;
+  }
+
+  for (int32_t i = 0; i < 10; i++) {
+    if (!LinkedList_i32_add(list, i)) {
+      return false;
+    }
+  }
+
+  // Removing the last node must move the tail, so adding afterwards works.
+  if (!LinkedList_i32_remove(list, 9) || !LinkedList_i32_remove(list, 0) || !LinkedList_i32_add(list, 42)) {
+    return false;
+  }
+
+  int32_t expected[9] = { 1, 2, 3, 4, 5, 6, 7, 8, 42 };
+  if (LinkedList_i32_size(list) != 9) {
+    return false;
+  }
+  for (size_t i = 0; i < 9; i++) {
+    if (*LinkedList_i32_get(list, i) != expected[i]) {
+      return false;
+    }
+  }
+
+  if (LinkedList_i32_get(list, 9) != NULL || LinkedList_i32_remove(list, 9)) {
+    return false;
+  }
+
+  if (LinkedList_i32_indexOf(list, 42) != 8 || LinkedList_i32_contains(list, 0)) {
+    return false;
+  }
+
+  if (!LinkedList_i32_clear(list) || !LinkedList_i32_isEmpty(list) || !LinkedList_i32_add(list, 1)) {
+    return false;
+  }
+
+  LinkedList_i32_free(list);
+  return true;
+}
+
+/**
+ * Test function for LinkedList_point_indexOf(), which uses a custom equality.
+ *
+ * @return true if the test passed, false otherwise.
+*/
+bool test_LinkedList_point() {
+  LinkedList_point* list = new_LinkedList_point();
+  if (list == NULL) {
+    return false;
+  }
+
+  for (int i = 0; i < 10; i++) {
+    LinkedList_point_add(list, (Point) { i, i * i });
+  }
+
+  if (LinkedList_point_indexOf(list, (Point) { 3, 9 }) != 3) {
+    return false;
+  }
+
+  if (LinkedList_point_contains(list, (Point) { 3, 3 }) || LinkedList_point_get(list, 4)->y != 16) {
+    return false;
+  }
+
+  LinkedList_point_free(list);
+  return true;
+}
+
+/**
+ * Main function used to run the tests.
+*/
+int main() {
+  printf("Running unit tests for the typed data types...\n");
+
+  printf("\ttesting new_ArrayList_i32()...........................%s\n", test_new_ArrayList_i32() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_i32_add()...........................%s\n", test_ArrayList_i32_add() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList_i32 insert, remove and set..........%s\n", test_ArrayList_i32_modify() ? "PASS" : "FAIL");
+  printf("\ttesting ArrayList indexOf() with typed elements.......%s\n", test_ArrayList_indexOf_typed() ? "PASS" : "FAIL");
+
+  printf("\ttesting Stack_i32.....................................%s\n", test_Stack_i32() ? "PASS" : "FAIL");
+
+  printf("\ttesting Queue_i32.....................................%s\n", test_Queue_i32() ? "PASS" : "FAIL");
+
+  printf("\ttesting LinkedList_i32................................%s\n", test_LinkedList_i32() ? "PASS" : "FAIL");
+  printf("\ttesting LinkedList_point..............................%s\n", test_LinkedList_point() ? "PASS" : "FAIL");
+
+  printf("Unit tests complete.\n");
+}
@@ -0,0 +1,372 @@
+/**
+ * @file unrolled_list_test.c
+ * @brief Test file for unrolled_list.c
+ * @author Jonathan E
+ * @date 17-10-2026
+ * 
+ * This file contains the test functions for unrolled_list.c.
+ * By running this file, you can test the functions of unrolled_list.c
+ * with the test cases outputted to the console.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+#include "../src/unrolled_list/unrolled_list.h"
+
+/**
+ * Checks that an unrolled list holds the given elements in order, that its
+ * sizes and tail agree with its nodes, and that every node other than the last
+ * is at least half full.
+ * 
+ * @param UnrolledList* the unrolled list to check.
+ * @param int**         the expected elements.
+ * @param size_t        the number of expected elements.
+ * @return true if the list holds exactly the expected elements.
+*/
+bool holds_elements(UnrolledList* list, int** expected, size_t count) {
+  if (list->size != count) {
+    return false;
+  }
+
+  size_t index = 0;
+  size_t nodes = 0;
+  UnrolledList_Node* last = NULL;
+  for (UnrolledList_Node* node = list->head; node != NULL; node = node->next) {
+    if (node->count == 0 || (node->next != NULL && node->count < UNROLLED_LIST_NODE_CAPACITY / 2)) {
+      return false;
+    }
+    for (size_t i = 0; i < node->count; i++) {
+      if (index >= count || node->data[i] != expected[index++]) {
+        return false;
+      }
+    }
+    last = node;
+    nodes++;
+  }
+
+  return index == count && list->tail == last && list->node_count == nodes;
+}
+
+/**
+ * Test function for new_UnrolledList().
+ * 
+ * @return true if test passed, false otherwise.
+*/
+bool test_new_UnrolledList() {
+  UnrolledList* list = new_UnrolledList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  if (list->size != 0 || list->head != NULL || list->tail != NULL || list->node_count != 0) {
+    return false;
+  }
+
+  UnrolledList_free(list);
+  return true;
+}
+
+/**
+ * Test function for UnrolledList_add() and UnrolledList_get(), which fill each
+ * node before allocating the next.
+ * 
+ * @return true if test passed, false otherwise.
+*/
+bool test_UnrolledList_add() {
+  UnrolledList* list = new_UnrolledList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int elements[100];
+  int* expected[100];
+  for (int i = 0; i < 100; i++) {
+    elements[i] = i;
+    expected[i] = &elements[i];
+    if (!UnrolledList_add(list, &elements[i])) {
+      return false;
+    }
+  }
+
+  size_t capacity = UNROLLED_LIST_NODE_CAPACITY;
+  if (!holds_elements(list, expected, 100) || list->node_count != (100 + capacity - 1) / capacity) {
+    return false;
+  }
+
+  for (size_t i = 0; i < 100; i++) {
+    if (UnrolledList_get(list, i) != &elements[i]) {
+      return false;
+    }
+  }
+
+  if (UnrolledList_get(list, 100) != NULL || UnrolledList_add(NULL, &elements[0])) {
+    return false;
+  }
+
+  UnrolledList_free(list);
+  return true;
+}
+
+/**
+ * Test function for UnrolledList_insert(), including into a full node, which
+ * is split in two.
+ * 
+ * @return true if test passed, false otherwise.
+*/
+bool test_UnrolledList_insert() {
+  UnrolledList* list = new_UnrolledList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  // Fill a single node, then insert into the middle of it.
+  int elements[UNROLLED_LIST_NODE_CAPACITY + 2];
+  int* expected[UNROLLED_LIST_NODE_CAPACITY + 2];
+  for (int i = 0; i < UNROLLED_LIST_NODE_CAPACITY + 2; i++) {
+    elements[i] = i;
+  }
+  for (int i = 0; i < UNROLLED_LIST_NODE_CAPACITY; i++) {
+    UnrolledList_add(list, &elements[i + 1]);
+  }
+
+  if (!UnrolledList_insert(list, 5, &elements[UNROLLED_LIST_NODE_CAPACITY + 1]) || list->node_count != 2) {
+    return false;
+  }
+  if (!UnrolledList_insert(list, 0, &elements[0])) {
+    return false;
+  }
+
+  size_t count = 0;
+  expected[count++] = &elements[0];
+  for (int i = 1; i <= UNROLLED_LIST_NODE_CAPACITY; i++) {
+    if (i == 6) {
+      expected[count++] = &elements[UNROLLED_LIST_NODE_CAPACITY + 1];
+    }
+    expected[count++] = &elements[i];
+  }
+  if (!holds_elements(list, expected, count)) {
+    return false;
+  }
+
+  // Inserting at the size adds to the end, and past it fails.
+  if (!UnrolledList_insert(list, list->size, &elements[0]) || UnrolledList_get(list, list->size - 1) != &elements[0]) {
+    return false;
+  }
+  if (UnrolledList_insert(list, list->size + 1, &elements[0]) || UnrolledList_insert(NULL, 0, &elements[0])) {
+    return false;
+  }
+
+  UnrolledList_free(list);
+  return true;
+}
+
+/**
+ * Test function for UnrolledList_remove(), which merges or refills nodes left
+ * less than half full.
+ * 
+ * @return true if test passed, false otherwise.
+*/
+bool test_UnrolledList_remove() {
+  UnrolledList* list = new_UnrolledList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int elements[200];
+  int* expected[200];
+  size_t count = 200;
+  for (int i = 0; i < 200; i++) {
+    elements[i] = i;
+    expected[i] = &elements[i];
+    UnrolledList_add(list, &elements[i]);
+  }
+
+  // Remove every other element from the front, checking the nodes each time.
+  for (size_t index = 0; index < count; index += 2) {
+    if (!UnrolledList_remove(list, index)) {
+      return false;
+    }
+    for (size_t i = index; i + 1 < count; i++) {
+      expected[i] = expected[i + 1];
+    }
+    count--;
+    if (!holds_elements(list, expected, count)) {
+      return false;
+    }
+  }
+
+  // Empty the list from the end, then from the front.
+  while (list->size > count / 2) {
+    UnrolledList_remove(list, list->size - 1);
+  }
+  while (UnrolledList_remove(list, 0)) {
+  }
+  if (list->head != NULL || list->tail != NULL || list->node_count != 0 || list->size != 0) {
+    return false;
+  }
+
+  if (UnrolledList_remove(list, 0) || UnrolledList_remove(NULL, 0)) {
+    return false;
+  }
+
+  UnrolledList_free(list);
+  return true;
+}
+
+/**
+ * Test function for a long run of random inserts and removes, checked against
+ * an array of the expected elements.
+ * 
+ * @return true if test passed, false otherwise.
+*/
+bool test_UnrolledList_random() {
+  UnrolledList* list = new_UnrolledList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int elements[1000];
+  int* expected[1000];
+  size_t count = 0;
+  srand(23);
+  for (int step = 0; step < 5000; step++) {
+    if (count < 1000 && (count == 0 || rand() % 5 < 3)) {
+      size_t index = (size_t) rand() % (count + 1);
+      int* data = &elements[rand() % 1000];
+      if (!UnrolledList_insert(list, index, data)) {
+        return false;
+      }
+      for (size_t i = count; i > index; i--) {
+        expected[i] = expected[i - 1];
+      }
+      expected[index] = data;
+      count++;
+    } else {
+      size_t index = (size_t) rand() % count;
+      if (!UnrolledList_remove(list, index)) {
+        return false;
+      }
+      for (size_t i = index; i + 1 < count; i++) {
+        expected[i] = expected[i + 1];
+      }
+      count--;
+    }
+  }
+
+  if (!holds_elements(list, expected, count)) {
+    return false;
+  }
+
+  UnrolledList_free(list);
+  return true;
+}
+
+/**
+ * Test function for UnrolledList_contains() and UnrolledList_indexOf().
+ * 
+ * @return true if test passed, false otherwise.
+*/
+bool test_UnrolledList_indexOf() {
+  UnrolledList* list = new_UnrolledList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int elements[101];
+  for (int i = 0; i < 100; i++) {
+    UnrolledList_add(list, &elements[i]);
+  }
+
+  if (UnrolledList_indexOf(list, &elements[70]) != 70 || UnrolledList_indexOf(list, &elements[100]) != UNROLLED_LIST_NPOS) {
+    return false;
+  }
+
+  if (!UnrolledList_contains(list, &elements[99]) || UnrolledList_contains(list, &elements[100]) || UnrolledList_contains(NULL, &elements[0])) {
+    return false;
+  }
+
+  UnrolledList_free(list);
+  return true;
+}
+
+/**
+ * Test function for UnrolledList_clear().
+ * 
+ * @return true if test passed, false otherwise.
+*/
+bool test_UnrolledList_clear() {
+  UnrolledList* list = new_UnrolledList();
+
+  if (list == NULL) {
+    return false;
+  }
+
+  int elements[100];
+  for (int i = 0; i < 100; i++) {
+    UnrolledList_add(list, &elements[i]);
+  }
+
+  if (!UnrolledList_clear(list) || list->head != NULL || list->tail != NULL || !UnrolledList_isEmpty(list)) {
+    return false;
+  }
+
+  // The list can still be used after being cleared.
+  int* expected[] = { &elements[1] };
+  UnrolledList_add(list, &elements[1]);
+  if (!holds_elements(list, expected, 1)) {
+    return false;
+  }
+
+  if (UnrolledList_clear(NULL)) {
+    return false;
+  }
+
+  UnrolledList_free(list);
+  return true;
+}
+
+/**
+ * Test function for the UnrolledList functions given NULL.
+ * 
+ * @return true if test passed, false otherwise.
+*/
+bool test_UnrolledList_null() {
+  if (UnrolledList_size(NULL) != UNROLLED_LIST_NPOS || !UnrolledList_isEmpty(NULL)) {
+    return false;
+  }
+
+  if (UnrolledList_get(NULL, 0) != NULL || UnrolledList_indexOf(NULL, NULL) != UNROLLED_LIST_NPOS) {
+    return false;
+  }
+
+  UnrolledList_free(NULL);
+  return true;
+}
+
+/**
+ * Main function used to run the tests.
+*/
+int main() {
+  printf("Running unit tests for UnrolledList...\n");
+
+  printf("\ttesting new_UnrolledList()....................%s\n", test_new_UnrolledList() ? "PASS" : "FAIL");
+
+  printf("\ttesting UnrolledList_add() and get()..........%s\n", test_UnrolledList_add() ? "PASS" : "FAIL");
+  printf("\ttesting UnrolledList_insert().................%s\n", test_UnrolledList_insert() ? "PASS" : "FAIL");
+  printf("\ttesting UnrolledList_remove().................%s\n", test_UnrolledList_remove() ? "PASS" : "FAIL");
+  printf("\ttesting UnrolledList random insert/remove.....%s\n", test_UnrolledList_random() ? "PASS" : "FAIL");
+
+  printf("\ttesting UnrolledList_indexOf()................%s\n", test_UnrolledList_indexOf() ? "PASS" : "FAIL");
+  printf("\ttesting UnrolledList_clear()..................%s\n", test_UnrolledList_clear() ? "PASS" : "FAIL");
+  printf("\ttesting UnrolledList functions with NULL......%s\n", test_UnrolledList_null() ? "PASS" : "FAIL");
+
+  printf("Unit tests complete.\n");
+}